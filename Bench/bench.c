@@ -0,0 +1,155 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Benchmark helpers
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        bench.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      bench.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Cycle counter of DWT and printing of results on display
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "bench.h"
+
+/** @struct Result */
+typedef struct {
+  // name
+  char *label;
+  // measured value
+  uint32_t value;
+  // unit
+  char *unit;
+} BENCH_Entry;
+
+/** @var Results */
+static BENCH_Entry benchResult[BENCH_RESULTS];
+/** @var Number of results */
+static uint8_t benchCount;
+
+/**
+ * @desc    Enable cycle counter
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void BENCH_Init (void)
+{
+  // enable trace
+  BENCH_DEMCR |= BENCH_TRCENA;
+  // reset counter
+  BENCH_DWT_CYCCNT = 0;
+  // enable counter
+  BENCH_DWT_CTRL |= BENCH_CYCCNTENA;
+}
+
+/**
+ * @desc    Read cycle counter
+ *
+ * @param   void
+ *
+ * @return  uint32_t
+ */
+uint32_t BENCH_Cycles (void)
+{
+  // cycles
+  return BENCH_DWT_CYCCNT;
+}
+
+/**
+ * @desc    Store result - value with unit
+ *
+ * @param   char * label
+ * @param   uint32_t value
+ * @param   char * unit
+ *
+ * @return  void
+ */
+void BENCH_Result (char *label, uint32_t value, char *unit)
+{
+  // table full
+  if (benchCount >= BENCH_RESULTS) {
+    return;
+  }
+  // store
+  benchResult[benchCount].label = label;
+  benchResult[benchCount].value = value;
+  benchResult[benchCount].unit = unit;
+  benchCount++;
+}
+
+/**
+ * @desc    Store result - cycles as microseconds
+ *
+ * @param   char * label
+ * @param   uint32_t cycles
+ *
+ * @return  void
+ */
+void BENCH_Result_Us (char *label, uint32_t cycles)
+{
+  // cycles per microsecond
+  BENCH_Result (label, cycles / (SystemCoreClock / 1000000), " us");
+}
+
+/**
+ * @desc    Show stored results on display, one per text line
+ *          More results than lines - pages shown one after another forever
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void BENCH_Show (ST7735_Display *lcd)
+{
+  // variables
+  char digits[12];
+  uint32_t value;
+  uint8_t first = 0;
+  uint8_t line;
+  uint8_t i;
+
+  // loop through pages
+  do {
+    // clean screen
+    ST7735_ClearScreen (lcd, WHITE);
+    // loop through results of page
+    for (line = 0; (line < BENCH_LINES) && ((first + line) < benchCount); line++) {
+      // value as decimal string from the last digit
+      value = benchResult[first + line].value;
+      i = sizeof (digits) - 1;
+      digits[i] = '\0';
+      do {
+        digits[--i] = '0' + (value % 10);
+        value /= 10;
+      } while ((value > 0) && (i > 0));
+      // label
+      ST7735_SetPosition (lcd, 2, 1 + line * GLYPH_HEIGHT (X1));
+      ST7735_DrawStringRun (lcd, benchResult[first + line].label, BLACK, WHITE, X1);
+      // value and unit right of label
+      ST7735_SetPosition (lcd, 2 + 14 * GLYPH_WIDTH (X1), 1 + line * GLYPH_HEIGHT (X1));
+      ST7735_DrawStringRun (lcd, &digits[i], BLACK, WHITE, X1);
+      ST7735_DrawStringRun (lcd, benchResult[first + line].unit, BLACK, WHITE, X1);
+    }
+    // single page stays
+    if (benchCount <= BENCH_LINES) {
+      return;
+    }
+    // next page, after last one first again
+    Delay_Ms (BENCH_PAGE_MS);
+    first += BENCH_LINES;
+    if (first >= benchCount) {
+      first = 0;
+    }
+  } while (1);
+}
@@ -0,0 +1,88 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Benchmark helpers
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        bench.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Cycle counter of DWT and printing of results on display
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+  #include "../Library/st7735.h"
+
+  // DWT registers
+  // -----------------------------------
+  #define BENCH_DEMCR           (*(volatile uint32_t *) 0xE000EDFC)
+  #define BENCH_DWT_CTRL        (*(volatile uint32_t *) 0xE0001000)
+  #define BENCH_DWT_CYCCNT      (*(volatile uint32_t *) 0xE0001004)
+  #define BENCH_TRCENA          0x01000000
+  #define BENCH_CYCCNTENA       0x00000001
+
+  // Results
+  // -----------------------------------
+  #define BENCH_RESULTS         48                // max stored results
+  #define BENCH_LINES           16                // text lines of one page
+  #define BENCH_PAGE_MS         5000              // time of page, if more pages
+
+  /**
+   * @desc    Enable cycle counter
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void BENCH_Init (void);
+
+  /**
+   * @desc    Read cycle counter
+   *
+   * @param   void
+   *
+   * @return  uint32_t
+   */
+  uint32_t BENCH_Cycles (void);
+
+  /**
+   * @desc    Store result - value with unit
+   *
+   * @param   char * label
+   * @param   uint32_t value
+   * @param   char * unit
+   *
+   * @return  void
+   */
+  void BENCH_Result (char *, uint32_t, char *);
+
+  /**
+   * @desc    Store result - cycles as microseconds
+   *
+   * @param   char * label
+   * @param   uint32_t cycles
+   *
+   * @return  void
+   */
+  void BENCH_Result_Us (char *, uint32_t);
+
+  /**
+   * @desc    Show stored results on display, one per text line, pages in loop
+   *
+   * @param   ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void BENCH_Show (ST7735_Display *);
+
+#endif
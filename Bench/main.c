@@ -0,0 +1,826 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        BENCH - performance measurement of library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        main.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      bench.h, st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Runs benchmarks one after another and shows measured times on display
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+// libraries
+#include "bench.h"
+#include "../Library/dlist.h"
+#include "../Library/scan.h"
+#include "../Library/pattern.h"
+#include "../Library/canvas.h"
+#include "../Library/tile.h"
+#include "../Library/bar.h"
+#include "../Library/console.h"
+#include "../Library/chart.h"
+#include "../Library/arc.h"
+#include "../Library/needle.h"
+#include "../Library/gram.h"
+#include "../Library/sprite.h"
+#include "../Library/map.h"
+
+/** @var Display on SPI1 */
+ST7735_Display lcd = ST7735_DISPLAY_SPI1;
+
+/** @var Buffer of display list */
+static uint8_t listBuffer[4096];
+
+/** @var Strip of canvas, 16 rows */
+static uint8_t stripBuffer[MAX_X * 16 * 2];
+
+/** @var Tiles of screen */
+static TILE_Screen screen;
+
+/** @var Text console */
+static CONSOLE_Console console;
+
+/**
+ * @desc    Static screen drawn by live calls
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Screen (void)
+{
+  // background
+  ST7735_ClearScreen (&lcd, WHITE);
+  // header
+  ST7735_DrawRectangle (&lcd, 0, 160, 0, 11, BLUE);
+  ST7735_SetPosition (&lcd, 4, 2);
+  ST7735_DrawStringRun (&lcd, "STM32F103C8T6", WHITE, BLUE, X1);
+  // footer
+  ST7735_DrawRectangle (&lcd, 0, 160, 118, 129, BLUE);
+  ST7735_SetPosition (&lcd, 4, 120);
+  ST7735_DrawStringRun (&lcd, "BLACKPILL <=> LCD ST7735", WHITE, BLUE, X1);
+  // frame of field
+  ST7735_DrawRectangle (&lcd, 30, 130, 30, 31, BLACK);
+  ST7735_DrawRectangle (&lcd, 30, 130, 60, 61, BLACK);
+  ST7735_DrawLine (&lcd, 30, 30, 30, 61, BLACK);
+  ST7735_DrawLine (&lcd, 130, 130, 30, 61, BLACK);
+  // finish last burst
+  ST7735_Sync (&lcd);
+}
+
+/**
+ * @desc    Display list - live calls vs recorded list replay
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_DisplayList (void)
+{
+  // variables
+  DLIST_List list;
+  uint32_t start;
+
+  // live calls
+  start = BENCH_Cycles ();
+  Bench_Screen ();
+  BENCH_Result_Us ("DLIST live", BENCH_Cycles () - start);
+
+  // record
+  DLIST_Init (&list, listBuffer, sizeof (listBuffer));
+  DLIST_Begin (&lcd, &list);
+  Bench_Screen ();
+  DLIST_End (&lcd);
+  BENCH_Result ("DLIST size", list.length, " B");
+
+  // replay
+  start = BENCH_Cycles ();
+  DLIST_Replay (&lcd, list.data);
+  ST7735_Sync (&lcd);
+  BENCH_Result_Us ("DLIST replay", BENCH_Cycles () - start);
+}
+
+/**
+ * @desc    Procedural background - color from position, RGB565 MSB first
+ *
+ * @param   void * context
+ * @param   uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width
+ *
+ * @return  void
+ */
+static void Bench_Raster (void *context, uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+  // variables
+  uint16_t color;
+
+  // loop through columns
+  while (width--) {
+    // red by column, green by row, blue by diagonal
+    color = ((x >> 3) << 11) | ((y >> 2) << 5) | (((x + y) >> 4) & 0x1F);
+    *line++ = (uint8_t) (color >> 8);
+    *line++ = (uint8_t) color;
+    x++;
+  }
+}
+
+/**
+ * @desc    Scanline pipeline - rasterization overlapped with DMA
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Scanline (void)
+{
+  // variables
+  ST7735_Rect area = { 0, lcd.width - 1, 0, lcd.height - 1 };
+  SCAN_Stats stats;
+
+  // whole screen
+  SCAN_Render (&lcd, &area, Bench_Raster, NULL, &stats);
+  // timing
+  BENCH_Result_Us ("SCAN frame", stats.frame);
+  BENCH_Result_Us ("SCAN render", stats.render);
+  BENCH_Result_Us ("SCAN overlap", stats.overlap);
+  BENCH_Result_Us ("SCAN wait", stats.wait);
+}
+
+/**
+ * @desc    Solid fill - polled pixels vs DMA fill with fence
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Fill (void)
+{
+  // variables
+  uint32_t fence;
+  uint32_t start;
+
+  // polled, pixel by pixel
+  start = BENCH_Cycles ();
+  ST7735_SetWindow (&lcd, 0, lcd.width - 1, 0, lcd.height - 1);
+  ST7735_SendColor565 (&lcd, BLACK, (uint32_t) lcd.width * lcd.height);
+  BENCH_Result_Us ("FILL polled", BENCH_Cycles () - start);
+
+  // DMA, CPU free after return
+  start = BENCH_Cycles ();
+  fence = ST7735_FillRect (&lcd, 0, lcd.width - 1, 0, lcd.height - 1, WHITE);
+  BENCH_Result_Us ("FILL issue", BENCH_Cycles () - start);
+  // completion
+  while (!ST7735_Done (&lcd, fence));
+  BENCH_Result_Us ("FILL DMA", BENCH_Cycles () - start);
+}
+
+/**
+ * @desc    Pattern fills - whole screen streamed in one window
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Pattern (void)
+{
+  // variables
+  ST7735_Rect area = { 0, lcd.width - 1, 0, lcd.height - 1 };
+  uint32_t start;
+
+  // dithered gradient
+  start = BENCH_Cycles ();
+  PATTERN_Gradient (&lcd, &area, BLUE, WHITE, PATTERN_VERTICAL);
+  ST7735_Sync (&lcd);
+  BENCH_Result_Us ("PATT gradient", BENCH_Cycles () - start);
+
+  // checkerboard
+  start = BENCH_Cycles ();
+  PATTERN_Checker (&lcd, &area, BLACK, WHITE, 8);
+  ST7735_Sync (&lcd);
+  BENCH_Result_Us ("PATT checker", BENCH_Cycles () - start);
+}
+
+/**
+ * @desc    Scene drawn through canvas
+ *
+ * @param   CANVAS_Canvas * canvas
+ *
+ * @return  void
+ */
+static void Bench_Canvas_Scene (CANVAS_Canvas *canvas)
+{
+  // variables
+  int16_t i;
+
+  // background and header
+  CANVAS_FillRect (canvas, 0, MAX_X - 1, 0, MAX_Y - 1, WHITE);
+  CANVAS_FillRect (canvas, 0, MAX_X - 1, 0, 11, BLUE);
+  CANVAS_DrawText (canvas, 4, 2, "STM32F103C8T6", WHITE, BLUE, CANVAS_X1);
+  // fan of lines
+  for (i = 0; i <= 60; i += 10) {
+    CANVAS_DrawLine (canvas, 10, 70, 20, 20 + i, RED);
+  }
+  // frame
+  CANVAS_DrawFrame (canvas, 80, 140, 20, 60, BLACK);
+}
+
+/**
+ * @desc    Canvas - immediate on display vs buffered in RAM strips
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Canvas (void)
+{
+  // variables
+  CANVAS_Canvas canvas;
+  int16_t origin;
+  uint32_t start;
+
+  // immediate
+  start = BENCH_Cycles ();
+  ST7735_Canvas_Init (&canvas, &lcd);
+  Bench_Canvas_Scene (&canvas);
+  ST7735_Sync (&lcd);
+  BENCH_Result_Us ("CANV direct", BENCH_Cycles () - start);
+
+  // buffered, strip sent by DMA while nothing else is drawn into it
+  start = BENCH_Cycles ();
+  CANVAS_RAM_Init (&canvas, stripBuffer, lcd.width, lcd.height, 16);
+  for (origin = 0; origin < lcd.height; origin += 16) {
+    ST7735_Sync (&lcd);
+    CANVAS_RAM_Move (&canvas, origin);
+    Bench_Canvas_Scene (&canvas);
+    ST7735_Canvas_Flush (&lcd, &canvas);
+  }
+  ST7735_Sync (&lcd);
+  BENCH_Result_Us ("CANV strip", BENCH_Cycles () - start);
+}
+
+/**
+ * @desc    12 bit pixel format - time of fill and bitmap relative to 16 bit
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Color444 (void)
+{
+  // variables
+  CANVAS_Canvas canvas;
+  uint32_t time[2][2];
+  uint32_t start;
+  uint8_t mode;
+
+  // bitmap of 16 rows
+  CANVAS_RAM_Init (&canvas, stripBuffer, lcd.width, lcd.height, 16);
+  Bench_Canvas_Scene (&canvas);
+  // 16 bit, then 12 bit
+  for (mode = 0; mode < 2; mode++) {
+    ST7735_SetColorMode (&lcd, mode ? ST7735_COLMOD_12 : ST7735_COLMOD_16);
+    // solid fill of screen
+    start = BENCH_Cycles ();
+    ST7735_FillRect (&lcd, 0, lcd.width - 1, 0, lcd.height - 1, RED);
+    ST7735_Sync (&lcd);
+    time[mode][0] = BENCH_Cycles () - start;
+    // bitmap from RAM
+    start = BENCH_Cycles ();
+    ST7735_Canvas_Flush (&lcd, &canvas);
+    ST7735_Sync (&lcd);
+    time[mode][1] = BENCH_Cycles () - start;
+  }
+  ST7735_SetColorMode (&lcd, ST7735_COLMOD_16);
+  // percent of 16 bit time
+  BENCH_Result ("444 fill", time[1][0] * 100 / time[0][0], " %");
+  BENCH_Result ("444 bitmap", time[1][1] * 100 / time[0][1], " %");
+}
+
+/**
+ * @desc    Dashboard drawn into tile - value as bar and number
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   void * context - value 0 - 100
+ *
+ * @return  void
+ */
+static void Bench_Tile_Scene (CANVAS_Canvas *canvas, void *context)
+{
+  // variables
+  uint8_t value = *(uint8_t *) context;
+  char number[4] = { '0' + value / 100, '0' + (value / 10) % 10, '0' + value % 10, '\0' };
+
+  // static part
+  Bench_Canvas_Scene (canvas);
+  // value
+  CANVAS_FillRect (canvas, 10, 10 + value, 90, 100, GREEN);
+  CANVAS_DrawText (canvas, 10, 106, number, RED, WHITE, CANVAS_X2);
+}
+
+/**
+ * @desc    Tiles - whole frame vs frame with changed value, only changed tiles sent
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Tile (void)
+{
+  // variables
+  uint8_t value = 40;
+  uint32_t start;
+
+  // first frame - every tile sent
+  TILE_Init (&screen, &lcd);
+  start = BENCH_Cycles ();
+  TILE_Render (&screen, Bench_Tile_Scene, &value);
+  ST7735_Sync (&lcd);
+  BENCH_Result_Us ("TILE full", BENCH_Cycles () - start);
+
+  // changed value - tiles drawn and hashed, few sent
+  value = 47;
+  start = BENCH_Cycles ();
+  TILE_Render (&screen, Bench_Tile_Scene, &value);
+  ST7735_Sync (&lcd);
+  BENCH_Result_Us ("TILE delta", BENCH_Cycles () - start);
+  BENCH_Result ("TILE sent", screen.stats.sent, " tiles");
+  BENCH_Result ("TILE bytes", screen.stats.bytes, " B");
+}
+
+/**
+ * @desc    Loading bar - growing rectangle redrawn every step vs delta of bar widget
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Bar (void)
+{
+  // variables
+  ST7735_Rect area = { 30, 130, 30, 40 };
+  BAR_Bar bar;
+  uint32_t start;
+  uint8_t i;
+
+  // whole bar every step
+  ST7735_ClearScreen (&lcd, WHITE);
+  start = BENCH_Cycles ();
+  for (i = area.xs; i <= area.xe; i++) {
+    ST7735_DrawRectangle (&lcd, area.xs, i, area.ys, area.ye, RED);
+  }
+  ST7735_Sync (&lcd);
+  BENCH_Result_Us ("BAR redraw", BENCH_Cycles () - start);
+
+  // only new column every step
+  ST7735_ClearScreen (&lcd, WHITE);
+  BAR_Init (&bar, &lcd, &area, BAR_PROGRESS, BAR_RIGHT, area.xe - area.xs + 1, RED, WHITE);
+  start = BENCH_Cycles ();
+  for (i = 1; i <= area.xe - area.xs + 1; i++) {
+    BAR_Set (&bar, i);
+  }
+  ST7735_Sync (&lcd);
+  BENCH_Result_Us ("BAR delta", BENCH_Cycles () - start);
+  BENCH_Result ("BAR bytes", bar.stats.bytes, " B");
+}
+
+/**
+ * @desc    Console - full page of 16 rows, refresh of page with one changed value
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Console (void)
+{
+  // variables
+  uint32_t start;
+  uint8_t row;
+  uint8_t pass;
+
+  // whole page sent, then same page with other value of first row
+  CONSOLE_Init (&console, &lcd, 2, 1);
+  for (pass = 0; pass < 2; pass++) {
+    start = BENCH_Cycles ();
+    for (row = 0; row < CONSOLE_ROWS; row++) {
+      CONSOLE_SetCursor (&console, 0, row);
+      CONSOLE_Printf (&console, "ROW %2u VALUE %5u", row, row ? row * 100 : 1000 + pass);
+    }
+    CONSOLE_Flush (&console);
+    ST7735_Sync (&lcd);
+    BENCH_Result_Us (pass ? "CONS refresh" : "CONS page", BENCH_Cycles () - start);
+  }
+  BENCH_Result ("CONS bytes", console.stats.bytes, " B");
+}
+
+/**
+ * @desc    Strip chart - time of one sample in sweep and scroll mode
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Chart (void)
+{
+  // variables
+  ST7735_Rect area = { 0, lcd.width - 1, 0, lcd.height - 1 };
+  CHART_Chart chart;
+  uint32_t start;
+  uint8_t mode;
+  uint8_t i;
+
+  // whole screen, grid
+  CHART_Init (&chart, &lcd, &area, 0, 255, YELLOW, BLACK);
+  CHART_SetGrid (&chart, 20, 16, BLUE);
+  // sweep, then hardware scroll
+  for (mode = CHART_SWEEP; mode <= CHART_SCROLL; mode++) {
+    CHART_SetMode (&chart, mode);
+    start = BENCH_Cycles ();
+    for (i = 0; i < 200; i++) {
+      CHART_Push (&chart, (i * 37) & 0xFF);
+    }
+    ST7735_Sync (&lcd);
+    BENCH_Result_Us (mode ? "CHRT scroll" : "CHRT sweep", (BENCH_Cycles () - start) / 200);
+  }
+  // content as written
+  ST7735_Scroll_Stop (&lcd);
+}
+
+/**
+ * @desc    Dial face - gray disc with black rim, radius 50 around center of screen
+ *
+ * @param   void * context
+ * @param   uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width in pixels
+ *
+ * @return  void
+ */
+static void Bench_Dial (void *context, uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+  // variables
+  int32_t dy = y - (lcd.height >> 1);
+  int32_t dx, d2;
+  uint16_t color;
+
+  // loop through pixels
+  for (; width > 0; width--, x++) {
+    dx = x - (lcd.width >> 1);
+    d2 = dx * dx + dy * dy;
+    // outside, rim, face
+    color = (d2 > 50 * 51) ? WHITE : ((d2 > 47 * 48) ? BLACK : 0xDEFB);
+    // MSB first
+    *line++ = (uint8_t) (color >> 8);
+    *line++ = (uint8_t) color;
+  }
+}
+
+/**
+ * @desc    Needle - dial redrawn every step against restore of pixels under old needle
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Needle (void)
+{
+  // variables
+  ST7735_Rect dial = { (lcd.width >> 1) - 50, (lcd.width >> 1) + 50, (lcd.height >> 1) - 50, (lcd.height >> 1) + 50 };
+  NEEDLE_Needle needle;
+  uint32_t start;
+  uint8_t pass;
+  uint8_t i;
+
+  // needle of 270 degrees on dial face
+  ST7735_ClearScreen (&lcd, WHITE);
+  NEEDLE_Init (&needle, &lcd, lcd.width >> 1, lcd.height >> 1, 44, 5, 100, RED, WHITE);
+  NEEDLE_SetSweep (&needle, ARC_DEGREE (225), ARC_DEGREE (270));
+  NEEDLE_SetFace (&needle, Bench_Dial, NULL);
+  // whole dial and needle every step, then only difference
+  for (pass = 0; pass < 2; pass++) {
+    SCAN_Render (&lcd, &dial, Bench_Dial, NULL, NULL);
+    NEEDLE_Draw (&needle);
+    needle.stats.pixels = 0;
+    start = BENCH_Cycles ();
+    for (i = 0; i <= 100; i++) {
+      if (pass) {
+        NEEDLE_Set (&needle, i);
+      } else {
+        needle.value = i;
+        SCAN_Render (&lcd, &dial, Bench_Dial, NULL, NULL);
+        NEEDLE_Draw (&needle);
+      }
+    }
+    ST7735_Sync (&lcd);
+    BENCH_Result_Us (pass ? "NDL delta" : "NDL redraw", (BENCH_Cycles () - start) / 101);
+  }
+  BENCH_Result ("NDL pixels", needle.stats.pixels / 101, " px");
+}
+
+/**
+ * @desc    Ring gauge - time of one step, whole ring against slice between values
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Arc (void)
+{
+  // variables
+  ARC_Ring ring;
+  uint32_t start;
+  uint8_t pass;
+  uint8_t i;
+
+  // gauge of 270 degrees in middle of screen
+  ST7735_ClearScreen (&lcd, WHITE);
+  ARC_Init (&ring, &lcd, lcd.width >> 1, lcd.height >> 1, 50, 38, 100, RED, BLACK);
+  ARC_SetSweep (&ring, ARC_DEGREE (225), ARC_DEGREE (270));
+  // redraw of whole ring every step, then only slice
+  for (pass = 0; pass < 2; pass++) {
+    start = BENCH_Cycles ();
+    for (i = 0; i <= 100; i++) {
+      if (pass) {
+        ARC_Set (&ring, i);
+      } else {
+        ring.value = i;
+        ARC_Draw (&ring);
+      }
+    }
+    ST7735_Sync (&lcd);
+    BENCH_Result_Us (pass ? "ARC slice" : "ARC redraw", (BENCH_Cycles () - start) / 101);
+  }
+}
+
+/** @var Overlay of readback benchmark, 40 x 20 in middle of screen */
+static ST7735_Rect overlay = { 60, 99, 55, 74 };
+
+/**
+ * @desc    Dial face with overlay of black at half alpha composed by rasterizer
+ *
+ * @param   void * context
+ * @param   uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width in pixels
+ *
+ * @return  void
+ */
+static void Bench_Overlay (void *context, uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+  // variables
+  uint16_t color;
+
+  // background
+  Bench_Dial (context, line, y, x, width);
+  // row outside of overlay
+  if ((y < overlay.ys) || (y > overlay.ye)) {
+    return;
+  }
+  // loop through pixels of overlay
+  for (line += (overlay.xs - x) << 1, x = overlay.xs; x <= overlay.xe; x++) {
+    // channels halved - black at half alpha
+    color = (line[0] << 8) | line[1];
+    color = (color >> 1) & 0x7BEF;
+    // MSB first
+    *line++ = (uint8_t) (color >> 8);
+    *line++ = (uint8_t) color;
+  }
+}
+
+/**
+ * @desc    Sink of screenshot - rows dropped
+ *
+ * @param   void * context
+ * @param   const uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width in pixels
+ *
+ * @return  void
+ */
+static void Bench_Sink (void *context, const uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+}
+
+/**
+ * @desc    Readback - overlay by full redraw against readback and blend, screenshot
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Gram (void)
+{
+  // variables
+  ST7735_Rect all = { 0, lcd.width - 1, 0, lcd.height - 1 };
+  GRAM_Stats stats = { 0, 0, 0 };
+  uint32_t start;
+
+  // whole screen composed with overlay
+  start = BENCH_Cycles ();
+  SCAN_Render (&lcd, &all, Bench_Overlay, NULL, NULL);
+  ST7735_Sync (&lcd);
+  BENCH_Result_Us ("GRAM redraw", BENCH_Cycles () - start);
+  // background, then only overlay read, blended and written back
+  SCAN_Render (&lcd, &all, Bench_Dial, NULL, NULL);
+  ST7735_Sync (&lcd);
+  start = BENCH_Cycles ();
+  GRAM_Blend (&lcd, &overlay, BLACK, 128, &stats);
+  ST7735_Sync (&lcd);
+  BENCH_Result_Us ("GRAM blend", BENCH_Cycles () - start);
+  BENCH_Result ("GRAM bytes", stats.bytes, " B");
+  // whole screen read
+  start = BENCH_Cycles ();
+  GRAM_Screenshot (&lcd, NULL, Bench_Sink, NULL, NULL);
+  BENCH_Result_Us ("GRAM shot", BENCH_Cycles () - start);
+}
+
+/** @var Sprites of benchmark - save-under buffers are part of sprites */
+static SPRITE_Sprite sprites[4];
+
+/** @var Layer of sprites */
+static SPRITE_Layer layer;
+
+/** @var Bitmap of sprites 16 x 16 */
+static uint8_t spriteBitmap[16 * 16 * 2];
+
+/**
+ * @desc    Sprites - one frame of 4 sprites 16 x 16 moved by 2 pixels, save-under by readback
+ *          against background made by rasterizer
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Sprite (void)
+{
+  // variables
+  uint32_t start;
+  uint16_t i;
+  uint8_t pass;
+  uint8_t k;
+
+  // square with transparent frame
+  for (i = 0; i < 16 * 16; i++) {
+    k = ((i & 15) == 0) || ((i & 15) == 15) || (i < 16) || (i >= 240);
+    spriteBitmap[i << 1] = k ? (uint8_t) (SPRITE_KEY >> 8) : (uint8_t) (RED >> 8);
+    spriteBitmap[(i << 1) + 1] = k ? (uint8_t) SPRITE_KEY : (uint8_t) RED;
+  }
+  // readback, then rasterizer of dial
+  for (pass = 0; pass < 2; pass++) {
+    ST7735_ClearScreen (&lcd, WHITE);
+    SPRITE_Init (&layer, &lcd);
+    if (pass) {
+      SPRITE_SetBackground (&layer, Bench_Dial, NULL);
+    }
+    for (k = 0; k < 4; k++) {
+      SPRITE_Add (&layer, &sprites[k], spriteBitmap, 16, 16, SPRITE_KEY);
+      SPRITE_Show (&layer, &sprites[k], 10 + k * 30, 10 + k * 20);
+    }
+    layer.stats.bytes = 0;
+    ST7735_Sync (&lcd);
+    start = BENCH_Cycles ();
+    for (i = 0; i < 30; i++) {
+      for (k = 0; k < 4; k++) {
+        SPRITE_Move (&layer, &sprites[k], sprites[k].x + 2, sprites[k].y + 1);
+      }
+    }
+    ST7735_Sync (&lcd);
+    BENCH_Result_Us (pass ? "SPR raster" : "SPR readback", (BENCH_Cycles () - start) / 30);
+    BENCH_Result (pass ? "SPR rs bytes" : "SPR rb bytes", layer.stats.bytes / 30, " B");
+  }
+}
+
+/** @const Palette of tilemap - sky, ground, bricks, sprite */
+static const uint16_t mapPalette[16] = {
+  0x0000, 0x5D1F, 0x7E9F, 0xFFFF, 0x8200, 0xA3A5, 0x2444, 0x07E0,
+  0xC800, 0xF9E7, 0x8410, 0xFFE0, 0xFD20, 0x001F, 0xF81F, 0x4208
+};
+
+/** @var Tile set - 4 tiles */
+static uint8_t mapTiles[4 * MAP_TILE_BYTES];
+
+/** @var Bitmap of sprite 16 x 16 */
+static uint8_t mapSprite[16 * 8];
+
+/** @var Tilemap */
+static MAP_Map map;
+
+/**
+ * @desc    Tilemap - full screen frames of scrolled tile layer with 4 sprites 16 x 16
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Bench_Map (void)
+{
+  // variables
+  MAP_Sprite sprites[4];
+  SCAN_Stats stats;
+  uint32_t start;
+  uint32_t elapsed;
+  uint16_t i;
+  uint8_t col;
+  uint8_t row;
+
+  // tiles - sky, ground, bricks with mortar, checker
+  for (i = 0; i < MAP_TILE_BYTES; i++) {
+    mapTiles[i] = 0x11;
+    mapTiles[MAP_TILE_BYTES + i] = (i & 4) ? 0x45 : 0x54;
+    mapTiles[2 * MAP_TILE_BYTES + i] = ((i & 12) == 12) ? 0xAA : 0x88;
+    mapTiles[3 * MAP_TILE_BYTES + i] = (i & 4) ? 0x67 : 0x76;
+  }
+  // sprite - square with transparent border
+  for (i = 0; i < 16 * 8; i++) {
+    mapSprite[i] = (((i & 7) > 1) && ((i & 7) < 6) && (i > 16) && (i < 112)) ? 0xCC : 0x00;
+  }
+  // sky over ground, bricks and checker scattered
+  MAP_Init (&map, &lcd, mapTiles, mapPalette);
+  for (row = 0; row < MAP_ROWS; row++) {
+    for (col = 0; col < MAP_COLS; col++) {
+      MAP_SetTile (&map, col, row, (row > 11) ? 1 : (((row * 7 + col * 3) % 11) == 0) ? 2 : (((col + row) % 9) == 0) ? 3 : 0);
+    }
+  }
+  for (i = 0; i < 4; i++) {
+    MAP_AddSprite (&map, &sprites[i], mapSprite, 16, 16);
+  }
+  // frames of scrolled map and moved sprites
+  start = BENCH_Cycles ();
+  for (i = 0; i < 30; i++) {
+    MAP_Scroll (&map, i * 2, i);
+    for (row = 0; row < 4; row++) {
+      sprites[row].x = 10 + row * 36 + i;
+      sprites[row].y = 20 + row * 20;
+    }
+    MAP_Render (&map, &stats);
+  }
+  ST7735_Sync (&lcd);
+  elapsed = BENCH_Cycles () - start;
+  // frame rate limited by bus, rasterization hidden behind DMA
+  BENCH_Result_Us ("MAP frame", elapsed / 30);
+  BENCH_Result_Us ("MAP render", stats.render);
+  BENCH_Result ("MAP rate", SystemCoreClock / (elapsed / 30), " fps");
+}
+
+/**
+ * @desc    Main
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+int main (void)
+{
+  // st7735
+  // -------------------------------------------------------
+  ST7735_Init (&lcd);
+  // cycle counter
+  BENCH_Init ();
+
+  // benchmarks
+  // -------------------------------------------------------
+  Bench_Fill ();
+  Bench_Pattern ();
+  Bench_Canvas ();
+  Bench_DisplayList ();
+  Bench_Scanline ();
+  Bench_Color444 ();
+  Bench_Tile ();
+  Bench_Bar ();
+  Bench_Console ();
+  Bench_Chart ();
+  Bench_Arc ();
+  Bench_Needle ();
+  Bench_Gram ();
+  Bench_Sprite ();
+  Bench_Map ();
+
+  // results
+  // -------------------------------------------------------
+  BENCH_Show (&lcd);
+
+  // return
+  // -------------------------------------------------------
+  return SUCCESS;
+}
+
+#ifdef USE_FULL_ASSERT
+  void assert_failed(uint8_t* file, uint32_t line)
+  {
+    // Use GDB to find out why we're here
+    while (1);
+  }
+#endif
@@ -0,0 +1,501 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Arc / ring gauge Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        arc.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      arc.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Slice is cut at quarters into pieces of at most 90 degrees, piece is then wedge
+ *              of two half planes and its part of row is one interval got by integer division.
+ *              Ring of row (x^2 + y^2 <= r^2 + r, one or two intervals) is intersected with
+ *              wedges of pieces, adjacent intervals are merged, so filled disc costs one span
+ *              per row. Pixel belongs to slice if from <= angle < to, center pixel of filled
+ *              sector to slice containing angle 0.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      https://en.wikipedia.org/wiki/Binary_angular_measurement
+ */
+
+/** @includes */
+#include "arc.h"
+
+// Pieces of slice below full turn - part, 3 quarters, part
+// -----------------------------------
+#define ARC_PIECES              5
+// Intervals of row - 2 of ring for every piece, center pixel
+// -----------------------------------
+#define ARC_INTERVALS           (2 * ARC_PIECES + 1)
+
+/** @array Sine of first quarter in Q15, ARC_QUARTER + 1 entries */
+static const int16_t ARC_SINE[ARC_QUARTER + 1] = {
+      0,   201,   402,   603,   804,  1005,  1206,  1407,  1608,  1809,  2009,  2210,
+   2410,  2611,  2811,  3012,  3212,  3412,  3612,  3811,  4011,  4210,  4410,  4609,
+   4808,  5007,  5205,  5404,  5602,  5800,  5998,  6195,  6393,  6590,  6786,  6983,
+   7179,  7375,  7571,  7767,  7962,  8157,  8351,  8545,  8739,  8933,  9126,  9319,
+   9512,  9704,  9896, 10087, 10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605,
+  11793, 11980, 12167, 12353, 12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828,
+  14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269, 15446, 15623, 15800, 15976,
+  16151, 16325, 16499, 16673, 16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037,
+  18204, 18371, 18537, 18703, 18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000,
+  20159, 20317, 20475, 20631, 20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856,
+  22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027, 23170, 23311, 23452, 23592,
+  23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680, 24811, 24942, 25072, 25201,
+  25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198, 26319, 26438, 26556, 26674,
+  26790, 26905, 27019, 27133, 27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001,
+  28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803, 28898, 28992, 29085, 29177,
+  29268, 29358, 29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+  30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783, 30852, 30919, 30985, 31050,
+  31113, 31176, 31237, 31297, 31356, 31414, 31470, 31526, 31580, 31633, 31685, 31736,
+  31785, 31833, 31880, 31926, 31971, 32014, 32057, 32098, 32137, 32176, 32213, 32250,
+  32285, 32318, 32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+  32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737, 32745, 32752,
+  32757, 32761, 32765, 32766, 32767
+};
+
+/** @struct Piece of slice - half planes a * x + b * y >= 0 and > 0 */
+typedef struct {
+  // from side, inclusive
+  int32_t a0, b0;
+  // to side, exclusive
+  int32_t a1, b1;
+} ARC_Piece;
+
+/**
+ * @desc    Sine in Q15
+ *
+ * @param   uint16_t angle, ARC_FULL units of turn
+ *
+ * @return  int16_t
+ */
+int16_t ARC_Sin (uint16_t angle)
+{
+  // variables
+  uint16_t index = angle & (ARC_QUARTER - 1);
+
+  // quarter of turn
+  switch ((angle & (ARC_FULL - 1)) / ARC_QUARTER) {
+    case 0:
+      return ARC_SINE[index];
+    case 1:
+      return ARC_SINE[ARC_QUARTER - index];
+    case 2:
+      return -ARC_SINE[index];
+    default:
+      return -ARC_SINE[ARC_QUARTER - index];
+  }
+}
+
+/**
+ * @desc    Cosine in Q15
+ *
+ * @param   uint16_t angle, ARC_FULL units of turn
+ *
+ * @return  int16_t
+ */
+int16_t ARC_Cos (uint16_t angle)
+{
+  // shifted sine
+  return ARC_Sin (angle + ARC_QUARTER);
+}
+
+/**
+ * @desc    Integer square root, rounded down
+ *
+ * @param   uint32_t value
+ *
+ * @return  int16_t
+ */
+static int16_t ARC_Sqrt (uint32_t value)
+{
+  // variables
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+
+  // highest power of 4 not above value
+  while (bit > value) {
+    bit >>= 2;
+  }
+  // digit by digit
+  while (bit) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  // root
+  return (int16_t) root;
+}
+
+/**
+ * @desc    Division rounded towards minus infinity
+ *
+ * @param   int32_t numerator
+ * @param   int32_t denominator > 0
+ *
+ * @return  int32_t
+ */
+static int32_t ARC_Floor (int32_t n, int32_t d)
+{
+  // C division rounds towards zero
+  return (n >= 0) ? (n / d) : -((-n + d - 1) / d);
+}
+
+/**
+ * @desc    Narrow interval of row to a * x + b >= 0
+ *
+ * @param   int32_t a
+ * @param   int32_t b
+ * @param   int32_t * lo
+ * @param   int32_t * hi
+ *
+ * @return  void
+ */
+static void ARC_Bound (int32_t a, int32_t b, int32_t *lo, int32_t *hi)
+{
+  // variables
+  int32_t bound;
+
+  // x >= ceil (-b / a)
+  if (a > 0) {
+    bound = -ARC_Floor (b, a);
+    if (bound > *lo) *lo = bound;
+  // x <= floor (b / -a)
+  } else if (a < 0) {
+    bound = ARC_Floor (b, -a);
+    if (bound < *hi) *hi = bound;
+  // whole row or nothing
+  } else if (b < 0) {
+    *lo = 1;
+    *hi = 0;
+  }
+}
+
+/**
+ * @desc    Fill span of row by color, counts traffic
+ *
+ * @param   ST7735_Display * lcd
+ * @param   int16_t x start
+ * @param   int16_t x end
+ * @param   uint8_t y
+ * @param   uint16_t color
+ * @param   ARC_Stats * traffic
+ *
+ * @return  uint8_t 1 - span sent
+ */
+static uint8_t ARC_Span (ST7735_Display *lcd, int16_t xs, int16_t xe, uint8_t y, uint16_t color, ARC_Stats *stats)
+{
+  // variables
+  ST7735_Rect rect;
+  uint32_t bytes = lcd->bytes;
+
+  // columns of screen
+  if (xs < 0) xs = 0;
+  if (xe > (lcd->width - 1)) xe = lcd->width - 1;
+  if (xs > xe) {
+    return 0;
+  }
+  // visible part, same clipping as fill
+  rect.xs = xs;
+  rect.xe = xe;
+  rect.ys = y;
+  rect.ye = y;
+  if (ST7735_Clip_Rect (lcd, &rect) == ST7735_ERROR) {
+    return 0;
+  }
+  // fill by DMA
+  ST7735_FillRect (lcd, rect.xs, rect.xe, rect.ys, rect.ye, color);
+  // traffic, CASET and RASET skipped by cache of window
+  if (stats != NULL) {
+    stats->bytes += lcd->bytes - bytes;
+    stats->pixels += rect.xe - rect.xs + 1;
+    stats->spans++;
+  }
+
+  // sent
+  return 1;
+}
+
+/**
+ * @desc    Fill slice [from, to) of ring, angles clockwise from 12 o'clock
+ *          Slice of ARC_FULL or more is whole ring, inner 0 - filled sector
+ *
+ * @param   ST7735_Display * lcd
+ * @param   int16_t x of center
+ * @param   int16_t y of center
+ * @param   uint8_t outer radius
+ * @param   uint8_t inner radius
+ * @param   uint16_t from angle
+ * @param   uint16_t to angle, counted from from angle modulo 2^16
+ * @param   uint16_t color
+ * @param   ARC_Stats * traffic, NULL - not counted
+ *
+ * @return  uint16_t number of spans
+ */
+uint16_t ARC_Fill (ST7735_Display *lcd, int16_t x, int16_t y, uint8_t outer, uint8_t inner, uint16_t from, uint16_t to, uint16_t color, ARC_Stats *stats)
+{
+  // variables
+  ARC_Piece pieces[ARC_PIECES];
+  int16_t los[ARC_INTERVALS];
+  int16_t his[ARC_INTERVALS];
+  int16_t ring[2][2];
+  uint16_t length = to - from;
+  uint16_t angle = from;
+  uint16_t step;
+  uint16_t spans = 0;
+  uint8_t count = 0;
+  uint8_t rings;
+  uint8_t full = (length >= ARC_FULL);
+  uint8_t zero = 0;
+  uint8_t n, i, j, k;
+  int32_t outer2 = (int32_t) outer * outer + outer;
+  int32_t inner2 = (int32_t) inner * inner + inner;
+  int32_t lo, hi;
+  int16_t dy;
+  int16_t slo, shi;
+
+  // empty slice or ring
+  if ((length == 0) || (inner >= outer)) {
+    return 0;
+  }
+  // pieces within quarters, wedges below 180 degrees
+  while (!full && (angle != to)) {
+    // to next quarter or end
+    step = ARC_QUARTER - (angle & (ARC_QUARTER - 1));
+    if (step > (uint16_t) (to - angle)) {
+      step = to - angle;
+    }
+    // cross product of ray and pixel, from side >= 0, to side > 0
+    pieces[count].a0 = ARC_Cos (angle);
+    pieces[count].b0 = ARC_Sin (angle);
+    pieces[count].a1 = -ARC_Cos (angle + step);
+    pieces[count].b1 = -ARC_Sin (angle + step);
+    // piece starts at angle 0
+    zero |= ((angle & (ARC_FULL - 1)) == 0);
+    angle += step;
+    count++;
+  }
+  // loop through rows of ring
+  for (dy = -outer; dy <= outer; dy++) {
+    // rows of screen
+    if (((y + dy) < 0) || ((y + dy) > (lcd->height - 1))) {
+      continue;
+    }
+    // ring of row - whole chord or two parts beside hole
+    ring[0][1] = ARC_Sqrt (outer2 - (int32_t) dy * dy);
+    ring[0][0] = -ring[0][1];
+    rings = 1;
+    if (inner && ((int32_t) dy * dy <= inner2)) {
+      ring[1][1] = ring[0][1];
+      ring[1][0] = ARC_Sqrt (inner2 - (int32_t) dy * dy) + 1;
+      ring[0][1] = -ring[1][0];
+      rings = 2;
+    }
+    // intervals of row
+    n = 0;
+    for (i = 0; i < (full ? 1 : count); i++) {
+      // wedge of piece
+      lo = -outer;
+      hi = outer;
+      if (!full) {
+        ARC_Bound (pieces[i].a0, pieces[i].b0 * dy, &lo, &hi);
+        ARC_Bound (pieces[i].a1, pieces[i].b1 * dy - 1, &lo, &hi);
+      }
+      // parts of ring within wedge
+      for (j = 0; j < rings; j++) {
+        slo = (lo > ring[j][0]) ? (int16_t) lo : ring[j][0];
+        shi = (hi < ring[j][1]) ? (int16_t) hi : ring[j][1];
+        // empty
+        if (slo > shi) {
+          continue;
+        }
+        // sorted by start
+        for (k = n; (k > 0) && (los[k - 1] > slo); k--) {
+          los[k] = los[k - 1];
+          his[k] = his[k - 1];
+        }
+        los[k] = slo;
+        his[k] = shi;
+        n++;
+      }
+    }
+    // center pixel, excluded by wedges, by slice containing angle 0
+    if ((dy == 0) && (inner == 0) && zero) {
+      for (k = n; (k > 0) && (los[k - 1] > 0); k--) {
+        los[k] = los[k - 1];
+        his[k] = his[k - 1];
+      }
+      los[k] = 0;
+      his[k] = 0;
+      n++;
+    }
+    // adjacent intervals merged into spans
+    for (i = 0; i < n; i = j) {
+      shi = his[i];
+      for (j = i + 1; (j < n) && (los[j] <= shi + 1); j++) {
+        if (his[j] > shi) shi = his[j];
+      }
+      spans += ARC_Span (lcd, x + los[i], x + shi, y + dy, color, stats);
+    }
+  }
+
+  // spans
+  return spans;
+}
+
+/**
+ * @desc    Value scaled to angle from start
+ *
+ * @param   ARC_Ring * ring
+ * @param   uint16_t value
+ *
+ * @return  uint16_t
+ */
+static uint16_t ARC_Angle (ARC_Ring *ring, uint16_t value)
+{
+  // rounded down, full sweep only at max
+  return (uint16_t) (((uint32_t) ring->sweep * value) / ring->max);
+}
+
+/**
+ * @desc    Init ring gauge of full turn from 12 o'clock, nothing drawn till first set / draw
+ *
+ * @param   ARC_Ring * ring
+ * @param   ST7735_Display * lcd
+ * @param   int16_t x of center
+ * @param   int16_t y of center
+ * @param   uint8_t outer radius
+ * @param   uint8_t inner radius
+ * @param   uint16_t max value
+ * @param   uint16_t color
+ * @param   uint16_t background
+ *
+ * @return  uint8_t
+ */
+uint8_t ARC_Init (ARC_Ring *ring, ST7735_Display *lcd, int16_t x, int16_t y, uint8_t outer, uint8_t inner, uint16_t max, uint16_t color, uint16_t background)
+{
+  // check arguments
+  if ((inner >= outer) || (max == 0)) {
+    // invalid
+    return ST7735_ERROR;
+  }
+  // ring
+  ring->lcd = lcd;
+  ring->x = x;
+  ring->y = y;
+  ring->outer = outer;
+  ring->inner = inner;
+  ring->max = max;
+  ring->color = color;
+  ring->background = background;
+  // full turn from 12 o'clock
+  ring->start = 0;
+  ring->sweep = ARC_FULL;
+  // empty, not drawn
+  ring->value = 0;
+  ring->angle = 0;
+  ring->drawn = 0;
+  // no traffic
+  ring->stats.updates = 0;
+  ring->stats.spans = 0;
+  ring->stats.pixels = 0;
+  ring->stats.bytes = 0;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Angle of zero value and angle of full scale, ring redrawn on next set
+ *          Part of old sweep outside new one is not erased
+ *
+ * @param   ARC_Ring * ring
+ * @param   uint16_t start angle
+ * @param   uint16_t sweep, 1 ... ARC_FULL
+ *
+ * @return  uint8_t
+ */
+uint8_t ARC_SetSweep (ARC_Ring *ring, uint16_t start, uint16_t sweep)
+{
+  // within one turn
+  if ((sweep == 0) || (sweep > ARC_FULL)) {
+    // invalid
+    return ST7735_ERROR;
+  }
+  // sweep
+  ring->start = start & (ARC_FULL - 1);
+  ring->sweep = sweep;
+  // whole ring on next set
+  ring->drawn = 0;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Draw whole ring with current value - fill and background
+ *
+ * @param   ARC_Ring * ring
+ *
+ * @return  void
+ */
+void ARC_Draw (ARC_Ring *ring)
+{
+  // variables
+  uint16_t angle = ARC_Angle (ring, ring->value);
+  uint16_t start = ring->start;
+
+  // fill and rest of sweep
+  ARC_Fill (ring->lcd, ring->x, ring->y, ring->outer, ring->inner, start, start + angle, ring->color, &ring->stats);
+  ARC_Fill (ring->lcd, ring->x, ring->y, ring->outer, ring->inner, start + angle, start + ring->sweep, ring->background, &ring->stats);
+  // drawn
+  ring->angle = angle;
+  ring->drawn = 1;
+}
+
+/**
+ * @desc    Set value, draws only slice between drawn and new angle
+ *
+ * @param   ARC_Ring * ring
+ * @param   uint16_t value, saturated to max
+ *
+ * @return  void
+ */
+void ARC_Set (ARC_Ring *ring, uint16_t value)
+{
+  // variables
+  uint16_t angle;
+  uint16_t start = ring->start;
+
+  // saturate
+  if (value > ring->max) {
+    value = ring->max;
+  }
+  ring->value = value;
+  ring->stats.updates++;
+  // first time whole ring
+  if (!ring->drawn) {
+    ARC_Draw (ring);
+    return;
+  }
+  // new end of fill
+  angle = ARC_Angle (ring, value);
+  // grows
+  if (angle > ring->angle) {
+    ARC_Fill (ring->lcd, ring->x, ring->y, ring->outer, ring->inner, start + ring->angle, start + angle, ring->color, &ring->stats);
+  // shrinks
+  } else if (angle < ring->angle) {
+    ARC_Fill (ring->lcd, ring->x, ring->y, ring->outer, ring->inner, start + angle, start + ring->angle, ring->background, &ring->stats);
+  }
+  // drawn
+  ring->angle = angle;
+}
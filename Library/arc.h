@@ -0,0 +1,159 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Arc / ring gauge Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        arc.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Filled arcs and rings without floating point - Q15 sine table of quarter wave,
+ *              angles in 1/1024 of turn clockwise from 12 o'clock. Arc is rasterized row by row
+ *              into horizontal spans sent by DMA fill. Slices [from, to) are half open, so
+ *              neighbouring slices cover every pixel exactly once and ring gauge updates only
+ *              slice between previous and new value.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      https://en.wikipedia.org/wiki/Binary_angular_measurement
+ */
+
+#ifndef __ARC_H__
+#define __ARC_H__
+
+  #include "st7735.h"
+
+  // Angles - binary angular measurement
+  // -----------------------------------
+  #define ARC_FULL              1024              // units of full turn
+  #define ARC_QUARTER           256               // units of quarter, entries of sine table - 1
+  #define ARC_DEGREE(d)         ((uint16_t) (((uint32_t) (d) * ARC_FULL) / 360))
+
+  /** @struct Traffic since init */
+  typedef struct {
+    // calls of ARC_Set
+    uint32_t updates;
+    // filled spans
+    uint32_t spans;
+    // sent pixels
+    uint32_t pixels;
+    // bytes on bus - headers and pixels
+    uint32_t bytes;
+  } ARC_Stats;
+
+  /** @struct Ring gauge */
+  typedef struct {
+    // display
+    ST7735_Display *lcd;
+    // center, may lie off screen
+    int16_t x;
+    int16_t y;
+    // radii, inner 0 - filled sector
+    uint8_t outer;
+    uint8_t inner;
+    // angle of zero value and angle of full scale
+    uint16_t start;
+    uint16_t sweep;
+    // value of full scale
+    uint16_t max;
+    // colors
+    uint16_t color;
+    uint16_t background;
+    // current value
+    uint16_t value;
+    // drawn angle from start
+    uint16_t angle;
+    // drawn on display, otherwise next set draws whole ring
+    uint8_t drawn;
+    // traffic
+    ARC_Stats stats;
+  } ARC_Ring;
+
+  /**
+   * @desc    Sine in Q15
+   *
+   * @param   uint16_t angle, ARC_FULL units of turn
+   *
+   * @return  int16_t
+   */
+  int16_t ARC_Sin (uint16_t);
+
+  /**
+   * @desc    Cosine in Q15
+   *
+   * @param   uint16_t angle, ARC_FULL units of turn
+   *
+   * @return  int16_t
+   */
+  int16_t ARC_Cos (uint16_t);
+
+  /**
+   * @desc    Fill slice [from, to) of ring, angles clockwise from 12 o'clock
+   *          Slice of ARC_FULL or more is whole ring, inner 0 - filled sector
+   *
+   * @param   ST7735_Display * lcd
+   * @param   int16_t x of center
+   * @param   int16_t y of center
+   * @param   uint8_t outer radius
+   * @param   uint8_t inner radius
+   * @param   uint16_t from angle
+   * @param   uint16_t to angle, counted from from angle modulo 2^16
+   * @param   uint16_t color
+   * @param   ARC_Stats * traffic, NULL - not counted
+   *
+   * @return  uint16_t number of spans
+   */
+  uint16_t ARC_Fill (ST7735_Display *, int16_t, int16_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t, ARC_Stats *);
+
+  /**
+   * @desc    Init ring gauge of full turn from 12 o'clock, nothing drawn till first set / draw
+   *
+   * @param   ARC_Ring * ring
+   * @param   ST7735_Display * lcd
+   * @param   int16_t x of center
+   * @param   int16_t y of center
+   * @param   uint8_t outer radius
+   * @param   uint8_t inner radius
+   * @param   uint16_t max value
+   * @param   uint16_t color
+   * @param   uint16_t background
+   *
+   * @return  uint8_t
+   */
+  uint8_t ARC_Init (ARC_Ring *, ST7735_Display *, int16_t, int16_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Angle of zero value and angle of full scale, ring redrawn on next set
+   *
+   * @param   ARC_Ring * ring
+   * @param   uint16_t start angle
+   * @param   uint16_t sweep, 1 ... ARC_FULL
+   *
+   * @return  uint8_t
+   */
+  uint8_t ARC_SetSweep (ARC_Ring *, uint16_t, uint16_t);
+
+  /**
+   * @desc    Draw whole ring with current value - fill and background
+   *
+   * @param   ARC_Ring * ring
+   *
+   * @return  void
+   */
+  void ARC_Draw (ARC_Ring *);
+
+  /**
+   * @desc    Set value, draws only slice between drawn and new angle
+   *
+   * @param   ARC_Ring * ring
+   * @param   uint16_t value, saturated to max
+   *
+   * @return  void
+   */
+  void ARC_Set (ARC_Ring *, uint16_t);
+
+#endif
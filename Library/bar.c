@@ -0,0 +1,372 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Bar widget Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        bar.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      bar.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Fill of widget is described by length along direction of growth - pixels of
+ *              solid bar or lit segments of meter. Change of value fills span between old and
+ *              new length by DMA (ST7735_FillRect), so updates of many widgets are cheap and
+ *              cost of whole animation is linear with its length.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "bar.h"
+
+/**
+ * @desc    Pixels along direction of growth
+ *
+ * @param   BAR_Bar * bar
+ *
+ * @return  uint16_t
+ */
+static uint16_t BAR_Size (BAR_Bar *bar)
+{
+  // horizontal
+  if ((bar->direction == BAR_RIGHT) || (bar->direction == BAR_LEFT)) {
+    return bar->area.xe - bar->area.xs + 1;
+  }
+  // vertical
+  return bar->area.ye - bar->area.ys + 1;
+}
+
+/**
+ * @desc    Number of segments of meter
+ *
+ * @param   BAR_Bar * bar
+ *
+ * @return  uint16_t
+ */
+static uint16_t BAR_Segments (BAR_Bar *bar)
+{
+  // last segment has no gap after it
+  return (BAR_Size (bar) + bar->gap) / (bar->segment + bar->gap);
+}
+
+/**
+ * @desc    Value scaled to length - pixels / segments
+ *
+ * @param   BAR_Bar * bar
+ * @param   uint16_t value
+ *
+ * @return  uint16_t
+ */
+static uint16_t BAR_Length (BAR_Bar *bar, uint16_t value)
+{
+  // full length
+  uint32_t full = (bar->kind == BAR_METER) ? BAR_Segments (bar) : BAR_Size (bar);
+
+  // rounded down, full only at max
+  return (uint16_t) ((full * value) / bar->max);
+}
+
+/**
+ * @desc    Fill span of length by color, counts bytes on bus
+ *
+ * @param   BAR_Bar * bar
+ * @param   uint16_t from - first pixel from start edge
+ * @param   uint16_t to - pixel after last one
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+static void BAR_Span (BAR_Bar *bar, uint16_t from, uint16_t to, uint16_t color)
+{
+  // variables
+  ST7735_Display *lcd = bar->lcd;
+  ST7735_Rect rect = bar->area;
+  uint32_t bytes = lcd->bytes;
+
+  // empty span
+  if (from >= to) {
+    return;
+  }
+  // span as rectangle of area
+  switch (bar->direction) {
+    case BAR_RIGHT:
+      rect.xe = rect.xs + to - 1;
+      rect.xs = rect.xs + from;
+      break;
+    case BAR_LEFT:
+      rect.xs = rect.xe - to + 1;
+      rect.xe = rect.xe - from;
+      break;
+    case BAR_UP:
+      rect.ys = rect.ye - to + 1;
+      rect.ye = rect.ye - from;
+      break;
+    default:
+      rect.ye = rect.ys + to - 1;
+      rect.ys = rect.ys + from;
+      break;
+  }
+  // visible part, same clipping as fill
+  if (ST7735_Clip_Rect (lcd, &rect) == ST7735_ERROR) {
+    return;
+  }
+  // fill by DMA
+  ST7735_FillRect (lcd, rect.xs, rect.xe, rect.ys, rect.ye, color);
+  // traffic, CASET and RASET skipped by cache of window
+  bar->stats.bytes += lcd->bytes - bytes;
+  bar->stats.rects++;
+}
+
+/**
+ * @desc    Paint part of fill between lengths
+ *
+ * @param   BAR_Bar * bar
+ * @param   uint16_t from length
+ * @param   uint16_t to length
+ *
+ * @return  void
+ */
+static void BAR_Paint (BAR_Bar *bar, uint16_t from, uint16_t to)
+{
+  // variables
+  uint16_t pitch = bar->segment + bar->gap;
+  uint16_t split;
+
+  // gauge - one color of whole fill
+  if (bar->kind == BAR_GAUGE) {
+    BAR_Span (bar, from, to, bar->fill);
+    return;
+  }
+  // first length in alarm color
+  split = bar->alarm ? BAR_Length (bar, bar->alarm) : 0xFFFF;
+  // progress - part before split and part after it
+  if (bar->kind == BAR_PROGRESS) {
+    BAR_Span (bar, from, (to < split) ? to : split, bar->color);
+    BAR_Span (bar, (from > split) ? from : split, to, bar->alarmColor);
+    return;
+  }
+  // meter - loop through segments
+  for (; from < to; from++) {
+    BAR_Span (bar, from * pitch, from * pitch + bar->segment, (from < split) ? bar->color : bar->alarmColor);
+  }
+}
+
+/**
+ * @desc    Erase part of fill between lengths by background
+ *
+ * @param   BAR_Bar * bar
+ * @param   uint16_t from length
+ * @param   uint16_t to length
+ *
+ * @return  void
+ */
+static void BAR_Erase (BAR_Bar *bar, uint16_t from, uint16_t to)
+{
+  // variables
+  uint16_t pitch = bar->segment + bar->gap;
+
+  // nothing to erase
+  if (from >= to) {
+    return;
+  }
+  // meter - segments with gaps between them as one span
+  if (bar->kind == BAR_METER) {
+    BAR_Span (bar, from * pitch, (to - 1) * pitch + bar->segment, bar->background);
+    return;
+  }
+  // solid
+  BAR_Span (bar, from, to, bar->background);
+}
+
+/**
+ * @desc    Color of fill by value - only gauge changes it
+ *
+ * @param   BAR_Bar * bar
+ * @param   uint16_t value
+ *
+ * @return  uint16_t
+ */
+static uint16_t BAR_Color (BAR_Bar *bar, uint16_t value)
+{
+  // gauge reached alarm
+  if ((bar->kind == BAR_GAUGE) && bar->alarm && (value >= bar->alarm)) {
+    return bar->alarmColor;
+  }
+  // normal
+  return bar->color;
+}
+
+/**
+ * @desc    Init widget, nothing drawn till first BAR_Set / BAR_Draw
+ *
+ * @param   BAR_Bar * bar
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area
+ * @param   uint8_t kind
+ * @param   uint8_t direction
+ * @param   uint16_t max value
+ * @param   uint16_t color
+ * @param   uint16_t background
+ *
+ * @return  uint8_t
+ */
+uint8_t BAR_Init (BAR_Bar *bar, ST7735_Display *lcd, const ST7735_Rect *area, uint8_t kind, uint8_t direction, uint16_t max, uint16_t color, uint16_t background)
+{
+  // check arguments
+  if ((area->xs > area->xe) ||
+      (area->ys > area->ye) ||
+      (kind > BAR_METER)    ||
+      (direction > BAR_DOWN) ||
+      (max == 0)) {
+    // invalid
+    return ST7735_ERROR;
+  }
+  // widget
+  bar->lcd = lcd;
+  bar->area = *area;
+  bar->kind = kind;
+  bar->direction = direction;
+  bar->max = max;
+  bar->color = color;
+  bar->background = background;
+  // no alarm
+  bar->alarm = 0;
+  bar->alarmColor = color;
+  // default segments, solid bar has no gap
+  bar->segment = (kind == BAR_METER) ? 4 : 1;
+  bar->gap = (kind == BAR_METER) ? 1 : 0;
+  // empty, not drawn
+  bar->value = 0;
+  bar->length = 0;
+  bar->fill = color;
+  bar->drawn = 0;
+  // no traffic
+  bar->stats.updates = 0;
+  bar->stats.rects = 0;
+  bar->stats.bytes = 0;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Alarm value and color, 0 switches alarm off
+ *          Colors of drawn fill may change - widget redrawn on next set
+ *
+ * @param   BAR_Bar * bar
+ * @param   uint16_t alarm value
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void BAR_SetAlarm (BAR_Bar *bar, uint16_t alarm, uint16_t color)
+{
+  // alarm
+  bar->alarm = alarm;
+  bar->alarmColor = color;
+  // whole widget on next set
+  bar->drawn = 0;
+}
+
+/**
+ * @desc    Segments of meter, default 4 pixels with 1 pixel gap
+ *          Widget redrawn on next set
+ *
+ * @param   BAR_Bar * bar
+ * @param   uint8_t pixels of segment
+ * @param   uint8_t pixels of gap
+ *
+ * @return  uint8_t
+ */
+uint8_t BAR_SetSegments (BAR_Bar *bar, uint8_t segment, uint8_t gap)
+{
+  // only meter, at least one segment
+  if ((bar->kind != BAR_METER) || (segment == 0) || (segment > BAR_Size (bar))) {
+    // invalid
+    return ST7735_ERROR;
+  }
+  // segments
+  bar->segment = segment;
+  bar->gap = gap;
+  // whole widget on next set
+  bar->drawn = 0;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Draw whole widget with current value - background and fill
+ *
+ * @param   BAR_Bar * bar
+ *
+ * @return  void
+ */
+void BAR_Draw (BAR_Bar *bar)
+{
+  // variables
+  uint16_t length = BAR_Length (bar, bar->value);
+
+  // meter - background with gaps, then lit segments
+  bar->fill = BAR_Color (bar, bar->value);
+  if (bar->kind == BAR_METER) {
+    BAR_Span (bar, 0, BAR_Size (bar), bar->background);
+    BAR_Paint (bar, 0, length);
+  // solid - fill and rest of background
+  } else {
+    BAR_Paint (bar, 0, length);
+    BAR_Span (bar, length, BAR_Size (bar), bar->background);
+  }
+  // drawn
+  bar->length = length;
+  bar->drawn = 1;
+}
+
+/**
+ * @desc    Set value, draws only difference against last drawn value
+ *
+ * @param   BAR_Bar * bar
+ * @param   uint16_t value, saturated to max
+ *
+ * @return  void
+ */
+void BAR_Set (BAR_Bar *bar, uint16_t value)
+{
+  // variables
+  uint16_t length;
+  uint16_t fill;
+
+  // saturate
+  if (value > bar->max) {
+    value = bar->max;
+  }
+  bar->value = value;
+  bar->stats.updates++;
+  // first time whole widget
+  if (!bar->drawn) {
+    BAR_Draw (bar);
+    return;
+  }
+  // new end of fill
+  length = BAR_Length (bar, value);
+  fill = BAR_Color (bar, value);
+  // gauge crossed alarm - whole fill in new color
+  if (fill != bar->fill) {
+    bar->fill = fill;
+    BAR_Paint (bar, 0, length);
+    BAR_Erase (bar, length, bar->length);
+  // grows
+  } else if (length > bar->length) {
+    BAR_Paint (bar, bar->length, length);
+  // shrinks
+  } else {
+    BAR_Erase (bar, length, bar->length);
+  }
+  // drawn
+  bar->length = length;
+}
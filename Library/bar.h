@@ -0,0 +1,144 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Bar widget Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        bar.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Progress bar, gauge fill and segmented level meter remembering last value - new
+ *              value sends only rectangle between old and new end of fill, decrease is erased
+ *              by background. Every widget counts bytes it sent on bus.
+ *
+ *              BAR_PROGRESS  ... solid fill, part beyond alarm position in alarm color
+ *              BAR_GAUGE     ... solid fill, whole fill in alarm color if value reached alarm
+ *              BAR_METER     ... segments with gaps, segments beyond alarm position in alarm color
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __BAR_H__
+#define __BAR_H__
+
+  #include "st7735.h"
+
+  // Kind of widget
+  // -----------------------------------
+  #define BAR_PROGRESS          0                 // solid, color by position
+  #define BAR_GAUGE             1                 // solid, color by value
+  #define BAR_METER             2                 // segmented, color by position
+
+  // Direction of growth
+  // -----------------------------------
+  #define BAR_RIGHT             0                 // from left edge
+  #define BAR_LEFT              1                 // from right edge
+  #define BAR_UP                2                 // from bottom edge
+  #define BAR_DOWN              3                 // from top edge
+
+  /** @struct Traffic of widget since init */
+  typedef struct {
+    // calls of BAR_Set
+    uint32_t updates;
+    // filled rectangles
+    uint32_t rects;
+    // bytes on bus - headers and pixels
+    uint32_t bytes;
+  } BAR_Stats;
+
+  /** @struct Widget */
+  typedef struct {
+    // display
+    ST7735_Display *lcd;
+    // area of widget
+    ST7735_Rect area;
+    // BAR_PROGRESS / BAR_GAUGE / BAR_METER
+    uint8_t kind;
+    // BAR_RIGHT / BAR_LEFT / BAR_UP / BAR_DOWN
+    uint8_t direction;
+    // value of full bar
+    uint16_t max;
+    // colors
+    uint16_t color;
+    uint16_t background;
+    // alarm value, 0 - no alarm
+    uint16_t alarm;
+    uint16_t alarmColor;
+    // meter - pixels of segment and gap
+    uint8_t segment;
+    uint8_t gap;
+    // current value
+    uint16_t value;
+    // drawn length - pixels / lit segments, color of fill
+    uint16_t length;
+    uint16_t fill;
+    // drawn on display, otherwise next set draws whole widget
+    uint8_t drawn;
+    // traffic
+    BAR_Stats stats;
+  } BAR_Bar;
+
+  /**
+   * @desc    Init widget, nothing drawn till first BAR_Set / BAR_Draw
+   *
+   * @param   BAR_Bar * bar
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * area
+   * @param   uint8_t kind
+   * @param   uint8_t direction
+   * @param   uint16_t max value
+   * @param   uint16_t color
+   * @param   uint16_t background
+   *
+   * @return  uint8_t
+   */
+  uint8_t BAR_Init (BAR_Bar *, ST7735_Display *, const ST7735_Rect *, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Alarm value and color, 0 switches alarm off
+   *
+   * @param   BAR_Bar * bar
+   * @param   uint16_t alarm value
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void BAR_SetAlarm (BAR_Bar *, uint16_t, uint16_t);
+
+  /**
+   * @desc    Segments of meter, default 4 pixels with 1 pixel gap
+   *
+   * @param   BAR_Bar * bar
+   * @param   uint8_t pixels of segment
+   * @param   uint8_t pixels of gap
+   *
+   * @return  uint8_t
+   */
+  uint8_t BAR_SetSegments (BAR_Bar *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Draw whole widget with current value - background and fill
+   *
+   * @param   BAR_Bar * bar
+   *
+   * @return  void
+   */
+  void BAR_Draw (BAR_Bar *);
+
+  /**
+   * @desc    Set value, draws only difference against last drawn value
+   *
+   * @param   BAR_Bar * bar
+   * @param   uint16_t value
+   *
+   * @return  void
+   */
+  void BAR_Set (BAR_Bar *, uint16_t);
+
+#endif
@@ -0,0 +1,661 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Canvas Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        canvas.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      canvas.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Drawing primitives written once against small backend interface - set window,
+ *              fill span of one color and blit span of pixels. Every primitive is clipped
+ *              before window is set, so backends never see coordinates outside of memory.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include <string.h>
+#include "canvas.h"
+
+/** @def Outcodes of Cohen-Sutherland clipping */
+#define CANVAS_CLIP_LEFT        0x01
+#define CANVAS_CLIP_RIGHT       0x02
+#define CANVAS_CLIP_TOP         0x04
+#define CANVAS_CLIP_BOTTOM      0x08
+
+/**
+ * @desc    Font columns of character, out of range characters as space
+ *
+ * @param   char character
+ *
+ * @return  const uint8_t *
+ */
+static const uint8_t * CANVAS_Font (char character)
+{
+  // check if character is out of range
+  if (((uint8_t) character < 0x20) ||
+      ((uint8_t) character > 0x7f)) {
+    // space
+    return FONTS[0];
+  }
+  // columns of character
+  return FONTS[(uint8_t) character - 32];
+}
+
+/**
+ * @desc    Intersect rectangle with clip rectangle and area in memory
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   CANVAS_Rect * rectangle, clipped in place
+ *
+ * @return  uint8_t 1 visible, 0 fully clipped
+ */
+static uint8_t CANVAS_Clip (CANVAS_Canvas *canvas, CANVAS_Rect *rect)
+{
+  // variables
+  int16_t last = canvas->origin + canvas->rows - 1;
+  int16_t right = canvas->left + canvas->columns - 1;
+
+  // clip rectangle
+  if (rect->xs < canvas->clip.xs) rect->xs = canvas->clip.xs;
+  if (rect->xe > canvas->clip.xe) rect->xe = canvas->clip.xe;
+  if (rect->ys < canvas->clip.ys) rect->ys = canvas->clip.ys;
+  if (rect->ye > canvas->clip.ye) rect->ye = canvas->clip.ye;
+  // rows of strip
+  if (rect->ys < canvas->origin) rect->ys = canvas->origin;
+  if (rect->ye > last) rect->ye = last;
+  // columns of tile
+  if (rect->xs < canvas->left) rect->xs = canvas->left;
+  if (rect->xe > right) rect->xe = right;
+
+  // something left
+  return (rect->xs <= rect->xe) && (rect->ys <= rect->ye);
+}
+
+/**
+ * @desc    Outcode of point against clip rectangle
+ *
+ * @param   const CANVAS_Rect * clip
+ * @param   int16_t x
+ * @param   int16_t y
+ *
+ * @return  uint8_t
+ */
+static uint8_t CANVAS_Clip_Code (const CANVAS_Rect *clip, int16_t x, int16_t y)
+{
+  // variables
+  uint8_t code = 0;
+
+  // horizontal
+  if (x < clip->xs) {
+    code |= CANVAS_CLIP_LEFT;
+  } else if (x > clip->xe) {
+    code |= CANVAS_CLIP_RIGHT;
+  }
+  // vertical
+  if (y < clip->ys) {
+    code |= CANVAS_CLIP_TOP;
+  } else if (y > clip->ye) {
+    code |= CANVAS_CLIP_BOTTOM;
+  }
+
+  // outcode
+  return code;
+}
+
+/**
+ * @desc    Clip line by Cohen-Sutherland algorithm to clip rectangle
+ *          Same end points as ST7735_Clip_Line, area in memory is not used,
+ *          so line crossing strips or tiles keeps its pixels
+ *
+ * @param   const CANVAS_Canvas * canvas
+ * @param   int16_t * x start position
+ * @param   int16_t * y start position
+ * @param   int16_t * x end position
+ * @param   int16_t * y end position
+ *
+ * @return  uint8_t 1 visible, 0 fully clipped
+ */
+static uint8_t CANVAS_Clip_Line (const CANVAS_Canvas *canvas, int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1)
+{
+  // variables
+  const CANVAS_Rect *clip = &canvas->clip;
+  uint8_t code0, code1, code;
+  int32_t x, y;
+
+  // empty clip rectangle
+  if ((clip->xs > clip->xe) || (clip->ys > clip->ye)) {
+    return 0;
+  }
+  // outcodes of end points
+  code0 = CANVAS_Clip_Code (clip, *x0, *y0);
+  code1 = CANVAS_Clip_Code (clip, *x1, *y1);
+
+  // loop till trivially accepted or rejected
+  while (code0 | code1) {
+    // both points on the same outer side
+    if (code0 & code1) {
+      return 0;
+    }
+    // outer point
+    code = code0 ? code0 : code1;
+    // intersection with edge
+    if (code & CANVAS_CLIP_TOP) {
+      x = *x0 + (int32_t) (*x1 - *x0) * (clip->ys - *y0) / (*y1 - *y0);
+      y = clip->ys;
+    } else if (code & CANVAS_CLIP_BOTTOM) {
+      x = *x0 + (int32_t) (*x1 - *x0) * (clip->ye - *y0) / (*y1 - *y0);
+      y = clip->ye;
+    } else if (code & CANVAS_CLIP_RIGHT) {
+      y = *y0 + (int32_t) (*y1 - *y0) * (clip->xe - *x0) / (*x1 - *x0);
+      x = clip->xe;
+    } else {
+      y = *y0 + (int32_t) (*y1 - *y0) * (clip->xs - *x0) / (*x1 - *x0);
+      x = clip->xs;
+    }
+    // move outer point
+    if (code == code0) {
+      *x0 = x;
+      *y0 = y;
+      code0 = CANVAS_Clip_Code (clip, *x0, *y0);
+    } else {
+      *x1 = x;
+      *y1 = y;
+      code1 = CANVAS_Clip_Code (clip, *x1, *y1);
+    }
+  }
+
+  // visible part
+  return 1;
+}
+
+/**
+ * @desc    RAM backend - set window
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   const CANVAS_Rect * window
+ *
+ * @return  void
+ */
+static void CANVAS_RAM_Window (CANVAS_Canvas *canvas, const CANVAS_Rect *window)
+{
+  // window
+  canvas->window = *window;
+  // write position to left-up corner
+  canvas->x = window->xs;
+  canvas->y = window->ys;
+}
+
+/**
+ * @desc    RAM backend - next run of pixels in row of window
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   uint32_t number of pixels wanted
+ * @param   uint8_t ** address of run in memory
+ *
+ * @return  uint16_t pixels of run, 0 window full
+ */
+static uint16_t CANVAS_RAM_Run (CANVAS_Canvas *canvas, uint32_t count, uint8_t **pixel)
+{
+  // variables
+  uint16_t run;
+
+  // window full
+  if (canvas->y > canvas->window.ye) {
+    return 0;
+  }
+  // rest of row
+  run = canvas->window.xe - canvas->x + 1;
+  if (run > count) {
+    run = count;
+  }
+  // address
+  *pixel = (uint8_t *) canvas->target + ((((canvas->y - canvas->origin) * canvas->columns) + canvas->x - canvas->left) << 1);
+  // move write position
+  canvas->x += run;
+  if (canvas->x > canvas->window.xe) {
+    canvas->x = canvas->window.xs;
+    canvas->y++;
+  }
+
+  // pixels of run
+  return run;
+}
+
+/**
+ * @desc    RAM backend - span of one color
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   uint16_t color
+ * @param   uint32_t number of pixels
+ *
+ * @return  void
+ */
+static void CANVAS_RAM_Fill (CANVAS_Canvas *canvas, uint16_t color, uint32_t count)
+{
+  // variables
+  uint8_t *pixel;
+  uint16_t run;
+
+  // loop through rows of window
+  while ((count > 0) && ((run = CANVAS_RAM_Run (canvas, count, &pixel)) > 0)) {
+    // rest
+    count -= run;
+    // MSB first
+    while (run--) {
+      *pixel++ = (uint8_t) (color >> 8);
+      *pixel++ = (uint8_t) color;
+    }
+  }
+}
+
+/**
+ * @desc    RAM backend - span of pixels
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   const uint8_t * pixels
+ * @param   uint16_t number of pixels
+ *
+ * @return  void
+ */
+static void CANVAS_RAM_Blit (CANVAS_Canvas *canvas, const uint8_t *pixels, uint16_t count)
+{
+  // variables
+  uint8_t *pixel;
+  uint16_t run;
+
+  // loop through rows of window
+  while ((count > 0) && ((run = CANVAS_RAM_Run (canvas, count, &pixel)) > 0)) {
+    // copy
+    memcpy (pixel, pixels, run << 1);
+    // rest
+    pixels += run << 1;
+    count -= run;
+  }
+}
+
+/** @const RAM backend */
+static const CANVAS_Ops canvasRAM = {
+  CANVAS_RAM_Window,
+  CANVAS_RAM_Fill,
+  CANVAS_RAM_Blit
+};
+
+/**
+ * @desc    Init canvas with backend, clip to whole canvas
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   const CANVAS_Ops * backend
+ * @param   void * target
+ * @param   int16_t width
+ * @param   int16_t height
+ *
+ * @return  void
+ */
+void CANVAS_Init (CANVAS_Canvas *canvas, const CANVAS_Ops *ops, void *target, int16_t width, int16_t height)
+{
+  // backend
+  canvas->ops = ops;
+  canvas->target = target;
+  // size
+  canvas->width = width;
+  canvas->height = height;
+  // all rows and columns
+  canvas->origin = 0;
+  canvas->rows = height;
+  canvas->left = 0;
+  canvas->columns = width;
+  // whole canvas
+  CANVAS_SetClip (canvas, NULL);
+}
+
+/**
+ * @desc    Init RAM canvas - framebuffer if rows equal height, otherwise strip
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   uint8_t * pixels RGB565 MSB first, width * rows * 2 bytes
+ * @param   int16_t width
+ * @param   int16_t height
+ * @param   int16_t rows in memory
+ *
+ * @return  void
+ */
+void CANVAS_RAM_Init (CANVAS_Canvas *canvas, uint8_t *pixels, int16_t width, int16_t height, int16_t rows)
+{
+  // memory backend
+  CANVAS_Init (canvas, &canvasRAM, pixels, width, height);
+  // rows in memory
+  canvas->rows = rows;
+}
+
+/**
+ * @desc    Move strip to first row, drawing outside strip is clipped
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   int16_t first row
+ *
+ * @return  void
+ */
+void CANVAS_RAM_Move (CANVAS_Canvas *canvas, int16_t origin)
+{
+  // first row in memory
+  canvas->origin = origin;
+}
+
+/**
+ * @desc    Place tile - area held in memory, drawing outside it is clipped
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   const CANVAS_Rect * area, memory holds its width * height pixels
+ *
+ * @return  void
+ */
+void CANVAS_RAM_Place (CANVAS_Canvas *canvas, const CANVAS_Rect *area)
+{
+  // rows in memory
+  canvas->origin = area->ys;
+  canvas->rows = area->ye - area->ys + 1;
+  // columns in memory, rows packed without gap
+  canvas->left = area->xs;
+  canvas->columns = area->xe - area->xs + 1;
+}
+
+/**
+ * @desc    Set clip rectangle, NULL for whole canvas
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   const CANVAS_Rect * clip
+ *
+ * @return  void
+ */
+void CANVAS_SetClip (CANVAS_Canvas *canvas, const CANVAS_Rect *clip)
+{
+  // whole canvas
+  canvas->clip.xs = 0;
+  canvas->clip.xe = canvas->width - 1;
+  canvas->clip.ys = 0;
+  canvas->clip.ye = canvas->height - 1;
+  // intersection
+  if (clip != NULL) {
+    if (canvas->clip.xs < clip->xs) canvas->clip.xs = clip->xs;
+    if (canvas->clip.xe > clip->xe) canvas->clip.xe = clip->xe;
+    if (canvas->clip.ys < clip->ys) canvas->clip.ys = clip->ys;
+    if (canvas->clip.ye > clip->ye) canvas->clip.ye = clip->ye;
+  }
+}
+
+/**
+ * @desc    Fill rectangle
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   int16_t x start position
+ * @param   int16_t x end position
+ * @param   int16_t y start position
+ * @param   int16_t y end position
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void CANVAS_FillRect (CANVAS_Canvas *canvas, int16_t xs, int16_t xe, int16_t ys, int16_t ye, uint16_t color)
+{
+  // variables
+  CANVAS_Rect rect;
+
+  // ordered corners
+  rect.xs = (xs < xe) ? xs : xe;
+  rect.xe = (xs < xe) ? xe : xs;
+  rect.ys = (ys < ye) ? ys : ye;
+  rect.ye = (ys < ye) ? ye : ys;
+  // fully clipped
+  if (!CANVAS_Clip (canvas, &rect)) {
+    return;
+  }
+  // one window, one span
+  canvas->ops->window (canvas, &rect);
+  canvas->ops->fill (canvas, color, (uint32_t) (rect.xe - rect.xs + 1) * (rect.ye - rect.ys + 1));
+}
+
+/**
+ * @desc    Draw pixel
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   int16_t x position
+ * @param   int16_t y position
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void CANVAS_DrawPixel (CANVAS_Canvas *canvas, int16_t x, int16_t y, uint16_t color)
+{
+  // one pixel rectangle
+  CANVAS_FillRect (canvas, x, x, y, y, color);
+}
+
+/**
+ * @desc    Draw line by Bresenham algorithm, straight runs as spans
+ *          End points clipped first, so same pixels as ST7735_DrawLine with the same
+ *          clip rectangle (end points 0 - 255), one window per run instead of per pixel
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   int16_t x start position
+ * @param   int16_t x end position
+ * @param   int16_t y start position
+ * @param   int16_t y end position
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void CANVAS_DrawLine (CANVAS_Canvas *canvas, int16_t xs, int16_t xe, int16_t ys, int16_t ye, uint16_t color)
+{
+  // variables
+  int16_t delta_x;
+  int16_t delta_y;
+  int16_t trace_x = 1, trace_y = 1;
+  int16_t D;
+  int16_t run;
+
+  // visible part of line
+  if (!CANVAS_Clip_Line (canvas, &xs, &ys, &xe, &ye)) {
+    return;
+  }
+  // deltas of clipped line
+  delta_x = xe - xs;
+  delta_y = ye - ys;
+
+  // negative directions
+  if (delta_x < 0) {
+    delta_x = -delta_x;
+    trace_x = -1;
+  }
+  if (delta_y < 0) {
+    delta_y = -delta_y;
+    trace_y = -1;
+  }
+
+  // m < 1 - horizontal runs
+  if (delta_y < delta_x) {
+    // calculate determinant
+    D = (delta_y << 1) - delta_x;
+    // first pixel of run
+    run = xs;
+    // loop through columns
+    while (xs != xe) {
+      // next pixel in next row, run finished
+      if (D >= 0) {
+        CANVAS_FillRect (canvas, run, xs, ys, ys, color);
+        ys += trace_y;
+        D -= delta_x << 1;
+        run = xs + trace_x;
+      }
+      // next column
+      D += delta_y << 1;
+      xs += trace_x;
+    }
+    // last run
+    CANVAS_FillRect (canvas, run, xs, ys, ys, color);
+  // m >= 1 - vertical runs
+  } else {
+    // calculate determinant
+    D = delta_y - (delta_x << 1);
+    // first pixel of run
+    run = ys;
+    // loop through rows
+    while (ys != ye) {
+      // next pixel in next column, run finished
+      if (D <= 0) {
+        CANVAS_FillRect (canvas, xs, xs, run, ys, color);
+        xs += trace_x;
+        D += delta_y << 1;
+        run = ys + trace_y;
+      }
+      // next row
+      D -= delta_x << 1;
+      ys += trace_y;
+    }
+    // last run
+    CANVAS_FillRect (canvas, xs, xs, run, ys, color);
+  }
+}
+
+/**
+ * @desc    Draw frame of rectangle
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   int16_t x start position
+ * @param   int16_t x end position
+ * @param   int16_t y start position
+ * @param   int16_t y end position
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void CANVAS_DrawFrame (CANVAS_Canvas *canvas, int16_t xs, int16_t xe, int16_t ys, int16_t ye, uint16_t color)
+{
+  // top and bottom
+  CANVAS_FillRect (canvas, xs, xe, ys, ys, color);
+  CANVAS_FillRect (canvas, xs, xe, ye, ye, color);
+  // left and right
+  CANVAS_FillRect (canvas, xs, xs, ys, ye, color);
+  CANVAS_FillRect (canvas, xe, xe, ys, ye, color);
+}
+
+/**
+ * @desc    Draw opaque text in one window
+ *          Cells include spacing column, rows are generated across all characters
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   int16_t x position
+ * @param   int16_t y position
+ * @param   const char * string
+ * @param   uint16_t color
+ * @param   uint16_t background
+ * @param   uint8_t size (CANVAS_X1, CANVAS_X2, CANVAS_X3)
+ *
+ * @return  void
+ */
+void CANVAS_DrawText (CANVAS_Canvas *canvas, int16_t x, int16_t y, const char *str, uint16_t color, uint16_t background, uint8_t size)
+{
+  // variables
+  uint8_t line[CANVAS_SPAN << 1];
+  uint8_t *pixel;
+  const uint8_t *glyph;
+  uint8_t shift_x = CANVAS_SCALE_X (size) - 1;
+  uint8_t shift_y = CANVAS_SCALE_Y (size) - 1;
+  uint8_t width = CANVAS_CHAR_WIDTH (size);
+  uint8_t within;
+  uint8_t column;
+  uint8_t mask;
+  uint16_t index;
+  uint16_t first;
+  int16_t col, row;
+  CANVAS_Rect rect;
+
+  // whole run
+  rect.xs = x;
+  rect.xe = x + strlen (str) * width - 1;
+  rect.ys = y;
+  rect.ye = y + CANVAS_CHAR_HEIGHT (size) - 1;
+  // fully clipped or empty string
+  if (!CANVAS_Clip (canvas, &rect)) {
+    return;
+  }
+  // first visible character
+  first = (rect.xs - x) / width;
+
+  // one window
+  canvas->ops->window (canvas, &rect);
+  // loop through rows
+  for (row = rect.ys; row <= rect.ye; row++) {
+    // bit of row
+    mask = 1 << ((row - y) >> shift_y);
+    // first visible character and column within its cell
+    index = first;
+    within = (rect.xs - x) - first * width;
+    glyph = CANVAS_Font (str[index]);
+    pixel = line;
+    // loop through columns
+    for (col = rect.xs; col <= rect.xe; col++) {
+      // next cell
+      if (within == width) {
+        within = 0;
+        glyph = CANVAS_Font (str[++index]);
+      }
+      // column of character, last one is spacing
+      column = within++ >> shift_x;
+      // write color MSB first
+      if ((column < CHARS_COLS_LENGTH) && (glyph[column] & mask)) {
+        *pixel++ = (uint8_t) (color >> 8);
+        *pixel++ = (uint8_t) color;
+      } else {
+        *pixel++ = (uint8_t) (background >> 8);
+        *pixel++ = (uint8_t) background;
+      }
+      // span buffer full
+      if (pixel == &line[sizeof (line)]) {
+        canvas->ops->blit (canvas, line, CANVAS_SPAN);
+        pixel = line;
+      }
+    }
+    // rest of row
+    if (pixel != line) {
+      canvas->ops->blit (canvas, line, (pixel - line) >> 1);
+    }
+  }
+}
+
+/**
+ * @desc    Draw bitmap RGB565 MSB first
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   int16_t x position
+ * @param   int16_t y position
+ * @param   int16_t width
+ * @param   int16_t height
+ * @param   const uint8_t * pixels
+ *
+ * @return  void
+ */
+void CANVAS_DrawBitmap (CANVAS_Canvas *canvas, int16_t x, int16_t y, int16_t width, int16_t height, const uint8_t *pixels)
+{
+  // variables
+  CANVAS_Rect rect = { x, x + width - 1, y, y + height - 1 };
+  int16_t row;
+
+  // fully clipped
+  if (!CANVAS_Clip (canvas, &rect)) {
+    return;
+  }
+  // one window
+  canvas->ops->window (canvas, &rect);
+  // visible part of every row
+  for (row = rect.ys; row <= rect.ye; row++) {
+    canvas->ops->blit (canvas, &pixels[(((row - y) * width) + (rect.xs - x)) << 1], rect.xe - rect.xs + 1);
+  }
+}
@@ -0,0 +1,236 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Canvas Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        canvas.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      font.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Drawing primitives written once against small backend interface - set window,
+ *              fill span of one color and blit span of pixels. Backends are display
+ *              (ST7735_Canvas_Init), RAM framebuffer / strip / tile (CANVAS_RAM_Init) and host PPM
+ *              image (Tools/canvas). Library has no hardware dependency, compiles on host.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __CANVAS_H__
+#define __CANVAS_H__
+
+  #include <stdint.h>
+  #include <stddef.h>
+  #include "font.h"
+
+  // Text sizes - same values as enum Size of st7735.h
+  // -----------------------------------
+  #define CANVAS_X1             0x00              // 1x high & 1x wide
+  #define CANVAS_X2             0x80              // 2x high & 1x wide
+  #define CANVAS_X3             0x81              // 2x high & 2x wide
+  #define CANVAS_SCALE_X(size)  (((size) & 0x0F) + 1)
+  #define CANVAS_SCALE_Y(size)  (((size) >> 7) + 1)
+  #define CANVAS_CHAR_WIDTH(size)   (CHARS_COLS_LENGTH * CANVAS_SCALE_X(size) + 1)
+  #define CANVAS_CHAR_HEIGHT(size)  (8 * CANVAS_SCALE_Y(size))
+
+  // Longest span of pixels rendered on stack
+  // -----------------------------------
+  #ifndef CANVAS_SPAN
+    #define CANVAS_SPAN         161
+  #endif
+
+  /** @struct Rectangle - inclusive start / end coordinates */
+  typedef struct {
+    // x start position
+    int16_t xs;
+    // x end position
+    int16_t xe;
+    // y start position
+    int16_t ys;
+    // y end position
+    int16_t ye;
+  } CANVAS_Rect;
+
+  /** @struct Canvas */
+  typedef struct CANVAS_Canvas CANVAS_Canvas;
+
+  /** @struct Backend - window is inside canvas, spans fill it row by row */
+  typedef struct {
+    // set window, clipped already
+    void (*window) (CANVAS_Canvas *, const CANVAS_Rect *);
+    // span of one color
+    void (*fill) (CANVAS_Canvas *, uint16_t, uint32_t);
+    // span of pixels RGB565 MSB first, buffer may be reused after return
+    void (*blit) (CANVAS_Canvas *, const uint8_t *, uint16_t);
+  } CANVAS_Ops;
+
+  /** @struct Canvas - backend and its state */
+  struct CANVAS_Canvas {
+    // backend
+    const CANVAS_Ops *ops;
+    // display / pixel memory
+    void *target;
+    // size of whole canvas
+    int16_t width;
+    int16_t height;
+    // first row held in memory (strip / tile)
+    int16_t origin;
+    // number of rows held in memory
+    int16_t rows;
+    // first column held in memory (tile)
+    int16_t left;
+    // number of columns held in memory, stride of rows
+    int16_t columns;
+    // clip rectangle
+    CANVAS_Rect clip;
+    // RAM backend - window and write position
+    CANVAS_Rect window;
+    int16_t x;
+    int16_t y;
+  };
+
+  /**
+   * @desc    Init canvas with backend, clip to whole canvas
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   const CANVAS_Ops * backend
+   * @param   void * target
+   * @param   int16_t width
+   * @param   int16_t height
+   *
+   * @return  void
+   */
+  void CANVAS_Init (CANVAS_Canvas *, const CANVAS_Ops *, void *, int16_t, int16_t);
+
+  /**
+   * @desc    Init RAM canvas - framebuffer if rows equal height, otherwise strip
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   uint8_t * pixels RGB565 MSB first, width * rows * 2 bytes
+   * @param   int16_t width
+   * @param   int16_t height
+   * @param   int16_t rows in memory
+   *
+   * @return  void
+   */
+  void CANVAS_RAM_Init (CANVAS_Canvas *, uint8_t *, int16_t, int16_t, int16_t);
+
+  /**
+   * @desc    Move strip to first row, drawing outside strip is clipped
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   int16_t first row
+   *
+   * @return  void
+   */
+  void CANVAS_RAM_Move (CANVAS_Canvas *, int16_t);
+
+  /**
+   * @desc    Place tile - area held in memory, drawing outside it is clipped
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   const CANVAS_Rect * area, memory holds its width * height pixels
+   *
+   * @return  void
+   */
+  void CANVAS_RAM_Place (CANVAS_Canvas *, const CANVAS_Rect *);
+
+  /**
+   * @desc    Set clip rectangle, NULL for whole canvas
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   const CANVAS_Rect * clip
+   *
+   * @return  void
+   */
+  void CANVAS_SetClip (CANVAS_Canvas *, const CANVAS_Rect *);
+
+  /**
+   * @desc    Fill rectangle
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   int16_t x start position
+   * @param   int16_t x end position
+   * @param   int16_t y start position
+   * @param   int16_t y end position
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void CANVAS_FillRect (CANVAS_Canvas *, int16_t, int16_t, int16_t, int16_t, uint16_t);
+
+  /**
+   * @desc    Draw pixel
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   int16_t x position
+   * @param   int16_t y position
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void CANVAS_DrawPixel (CANVAS_Canvas *, int16_t, int16_t, uint16_t);
+
+  /**
+   * @desc    Draw line by Bresenham algorithm, straight runs as spans
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   int16_t x start position
+   * @param   int16_t x end position
+   * @param   int16_t y start position
+   * @param   int16_t y end position
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void CANVAS_DrawLine (CANVAS_Canvas *, int16_t, int16_t, int16_t, int16_t, uint16_t);
+
+  /**
+   * @desc    Draw frame of rectangle
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   int16_t x start position
+   * @param   int16_t x end position
+   * @param   int16_t y start position
+   * @param   int16_t y end position
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void CANVAS_DrawFrame (CANVAS_Canvas *, int16_t, int16_t, int16_t, int16_t, uint16_t);
+
+  /**
+   * @desc    Draw opaque text in one window
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   int16_t x position
+   * @param   int16_t y position
+   * @param   const char * string
+   * @param   uint16_t color
+   * @param   uint16_t background
+   * @param   uint8_t size (CANVAS_X1, CANVAS_X2, CANVAS_X3)
+   *
+   * @return  void
+   */
+  void CANVAS_DrawText (CANVAS_Canvas *, int16_t, int16_t, const char *, uint16_t, uint16_t, uint8_t);
+
+  /**
+   * @desc    Draw bitmap RGB565 MSB first
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   int16_t x position
+   * @param   int16_t y position
+   * @param   int16_t width
+   * @param   int16_t height
+   * @param   const uint8_t * pixels
+   *
+   * @return  void
+   */
+  void CANVAS_DrawBitmap (CANVAS_Canvas *, int16_t, int16_t, int16_t, int16_t, const uint8_t *);
+
+#endif
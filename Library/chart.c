@@ -0,0 +1,311 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Strip chart Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        chart.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      chart.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Column is rendered into line buffer bank not sent by last burst, whole column
+ *              of 130 rows fits into one bank. Scroll mode - column i of chart shows memory
+ *              column (i + offset) % width, new sample overwrites oldest column and offset
+ *              moves by one, so newest column appears at right edge. Vertical gridlines of
+ *              scroll mode follow sample sequence and move with samples.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      https://en.wikipedia.org/wiki/Strip_chart
+ */
+
+/** @includes */
+#include "chart.h"
+
+/**
+ * @desc    Columns of chart
+ *
+ * @param   CHART_Chart * chart
+ *
+ * @return  uint8_t
+ */
+static uint8_t CHART_Width (CHART_Chart *chart)
+{
+  // columns
+  return chart->area.xe - chart->area.xs + 1;
+}
+
+/**
+ * @desc    Row of value, saturated to area
+ *
+ * @param   CHART_Chart * chart
+ * @param   int16_t value
+ *
+ * @return  int16_t
+ */
+static int16_t CHART_Row (CHART_Chart *chart, int16_t value)
+{
+  // variables
+  int32_t height = chart->area.ye - chart->area.ys;
+
+  // saturate
+  if (value < chart->min) value = chart->min;
+  if (value > chart->max) value = chart->max;
+  // bottom row is min
+  return chart->area.ye - (int16_t) (((int32_t) (value - chart->min) * height) / (chart->max - chart->min));
+}
+
+/**
+ * @desc    Gridline column - sweep by position, scroll by sequence of sample
+ *
+ * @param   CHART_Chart * chart
+ * @param   int32_t position / sequence
+ *
+ * @return  uint8_t
+ */
+static uint8_t CHART_Gridline (CHART_Chart *chart, int32_t index)
+{
+  // no vertical grid
+  if (chart->gridX == 0) {
+    return 0;
+  }
+  // sequence before first sample is negative
+  return ((index % chart->gridX) + chart->gridX) % chart->gridX == 0;
+}
+
+/**
+ * @desc    Send one column - background, gridlines and segment between rows
+ *
+ * @param   CHART_Chart * chart
+ * @param   uint8_t x of column
+ * @param   uint8_t vertical gridline
+ * @param   int16_t row of sample, -1 empty column
+ * @param   int16_t row of previous sample, -1 none
+ *
+ * @return  void
+ */
+static void CHART_Column (CHART_Chart *chart, uint8_t x, uint8_t gridline, int16_t row, int16_t previous)
+{
+  // variables
+  ST7735_Display *lcd = chart->lcd;
+  uint8_t *buffer = lcd->buffer[(lcd->xfer.buffer == lcd->buffer[0]) ? 1 : 0];
+  uint8_t *pixel = buffer;
+  uint16_t color;
+  int16_t from, to;
+  int16_t y;
+  ST7735_Rect rect = { x, x, chart->area.ys, chart->area.ye };
+
+  // visible part of column, same clipping as fill
+  if ((ST7735_Clip_Rect (lcd, &rect) == ST7735_ERROR) ||
+      (ST7735_SetWindow (lcd, rect.xs, rect.xe, rect.ys, rect.ye) == ST7735_ERROR)) {
+    // clipped or off screen
+    return;
+  }
+  // segment from previous sample
+  from = to = row;
+  if (previous >= 0) {
+    from = (previous < row) ? previous : row;
+    to = (previous > row) ? previous : row;
+  }
+  // loop through visible rows
+  for (y = rect.ys; y <= rect.ye; y++) {
+    // line, gridline or background
+    if ((row >= 0) && (y >= from) && (y <= to)) {
+      color = chart->color;
+    } else if (gridline || (chart->gridY && (((chart->area.ye - y) % chart->gridY) == 0))) {
+      color = chart->grid;
+    } else {
+      color = chart->background;
+    }
+    // MSB first
+    *pixel++ = (uint8_t) (color >> 8);
+    *pixel++ = (uint8_t) color;
+  }
+  // RAMWR of visible rows
+  ST7735_Burst_Begin (lcd);
+  ST7735_Burst_Write (lcd, buffer, pixel - buffer);
+  ST7735_Burst_End (lcd);
+}
+
+/**
+ * @desc    Init chart in sweep mode without grid, nothing drawn till CHART_Draw / push
+ *
+ * @param   CHART_Chart * chart
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area
+ * @param   int16_t value of bottom row
+ * @param   int16_t value of top row
+ * @param   uint16_t color of line
+ * @param   uint16_t background
+ *
+ * @return  uint8_t
+ */
+uint8_t CHART_Init (CHART_Chart *chart, ST7735_Display *lcd, const ST7735_Rect *area, int16_t min, int16_t max, uint16_t color, uint16_t background)
+{
+  // check arguments
+  if ((area->xs < 0) || (area->xs > area->xe) || (area->xe > (lcd->width - 1)) ||
+      (area->ys < 0) || (area->ys > area->ye) || (area->ye > (lcd->height - 1)) ||
+      (min >= max)) {
+    // invalid
+    return ST7735_ERROR;
+  }
+  // chart
+  chart->lcd = lcd;
+  chart->area = *area;
+  chart->min = min;
+  chart->max = max;
+  chart->color = color;
+  chart->background = background;
+  // no grid
+  chart->grid = background;
+  chart->gridX = 0;
+  chart->gridY = 0;
+  // sweep from left
+  chart->mode = CHART_SWEEP;
+  chart->column = 0;
+  // empty ring
+  chart->head = 0;
+  chart->count = 0;
+  chart->total = 0;
+  chart->last = -1;
+  // no traffic
+  chart->stats.samples = 0;
+  chart->stats.bytes = 0;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Gridlines every gx columns and gy rows, 0 - none
+ *
+ * @param   CHART_Chart * chart
+ * @param   uint8_t gx
+ * @param   uint8_t gy
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void CHART_SetGrid (CHART_Chart *chart, uint8_t gx, uint8_t gy, uint16_t color)
+{
+  // grid of next columns
+  chart->gridX = gx;
+  chart->gridY = gy;
+  chart->grid = color;
+}
+
+/**
+ * @desc    Sweep / scroll mode, redraws chart
+ *          Scroll moves whole height of columns of chart, only rotations with MV = 1
+ *
+ * @param   CHART_Chart * chart
+ * @param   uint8_t CHART_SWEEP / CHART_SCROLL
+ *
+ * @return  uint8_t
+ */
+uint8_t CHART_SetMode (CHART_Chart *chart, uint8_t mode)
+{
+  // scroll needs columns along memory rows
+  if ((mode > CHART_SCROLL) ||
+      ((mode == CHART_SCROLL) && (ST7735_Scroll (chart->lcd, chart->area.xs, chart->area.xe, 0) == ST7735_ERROR))) {
+    // not supported
+    return ST7735_ERROR;
+  }
+  // content shown as written
+  if (mode == CHART_SWEEP) {
+    ST7735_Scroll_Stop (chart->lcd);
+  }
+  chart->mode = mode;
+  // samples at places of new mode
+  CHART_Draw (chart);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Draw whole chart from ring - empty columns, then samples oldest first
+ *          Sweep - samples from left edge, scroll - newest sample at right edge
+ *
+ * @param   CHART_Chart * chart
+ *
+ * @return  void
+ */
+void CHART_Draw (CHART_Chart *chart)
+{
+  // variables
+  uint8_t width = CHART_Width (chart);
+  uint8_t first = (chart->mode == CHART_SCROLL) ? width - chart->count : 0;
+  uint8_t index = (chart->head + width - chart->count) % width;
+  uint32_t bytes = chart->lcd->bytes;
+  uint8_t i;
+  int16_t row;
+
+  // no scroll offset
+  if (chart->mode == CHART_SCROLL) {
+    ST7735_Scroll (chart->lcd, chart->area.xs, chart->area.xe, 0);
+  }
+  chart->last = -1;
+  // loop through columns
+  for (i = 0; i < width; i++) {
+    // empty column
+    if ((i < first) || (i >= first + chart->count)) {
+      row = -1;
+    // sample of ring
+    } else {
+      row = CHART_Row (chart, chart->samples[index]);
+      index = (index + 1) % width;
+    }
+    // gridline by position / sequence of sample
+    CHART_Column (chart, chart->area.xs + i, CHART_Gridline (chart, (chart->mode == CHART_SCROLL) ? (int32_t) (chart->total - width + i) : i), row, chart->last);
+    chart->last = row;
+  }
+  // next column after samples
+  chart->column = (chart->mode == CHART_SCROLL) ? 0 : (chart->count % width);
+  // traffic - columns and scroll
+  chart->stats.bytes += chart->lcd->bytes - bytes;
+}
+
+/**
+ * @desc    Push sample, one column sent
+ *
+ * @param   CHART_Chart * chart
+ * @param   int16_t value
+ *
+ * @return  void
+ */
+void CHART_Push (CHART_Chart *chart, int16_t value)
+{
+  // variables
+  uint8_t width = CHART_Width (chart);
+  int16_t row = CHART_Row (chart, value);
+  uint32_t bytes = chart->lcd->bytes;
+  uint8_t x;
+
+  // ring, oldest sample dropped
+  chart->samples[chart->head] = value;
+  chart->head = (chart->head + 1) % width;
+  if (chart->count < width) {
+    chart->count++;
+  }
+  chart->total++;
+  chart->stats.samples++;
+  // scroll - oldest column overwritten, then shown at right edge
+  if (chart->mode == CHART_SCROLL) {
+    x = chart->area.xs + chart->column;
+    chart->column = (chart->column + 1) % width;
+    CHART_Column (chart, x, CHART_Gridline (chart, (int32_t) (chart->total - 1)), row, chart->last);
+    ST7735_Scroll (chart->lcd, chart->area.xs, chart->area.xe, chart->column);
+  // sweep - next column from left
+  } else {
+    x = chart->area.xs + chart->column;
+    CHART_Column (chart, x, CHART_Gridline (chart, chart->column), row, chart->last);
+    chart->column = (chart->column + 1) % width;
+  }
+  chart->last = row;
+  // traffic - column and scroll
+  chart->stats.bytes += chart->lcd->bytes - bytes;
+}
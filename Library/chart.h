@@ -0,0 +1,136 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Strip chart Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        chart.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Streaming plot of samples kept in ring buffer. New sample updates one column -
+ *              background, gridline pixels and segment from previous sample sent as one
+ *              vertical window burst. Sweep mode overwrites columns left to right like
+ *              oscilloscope, scroll mode moves chart left by hardware vertical scroll of panel
+ *              (VSCRDEF, VSCRSADD), so only one column is sent per sample in both modes.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __CHART_H__
+#define __CHART_H__
+
+  #include "st7735.h"
+
+  // Chart definition
+  // -----------------------------------
+  #define CHART_SAMPLES         MAX_X             // ring capacity, max width of chart
+
+  // Modes
+  // -----------------------------------
+  #define CHART_SWEEP           0                 // columns overwritten left to right
+  #define CHART_SCROLL          1                 // newest column right, hardware scroll
+
+  /** @struct Traffic since init */
+  typedef struct {
+    // pushed samples
+    uint32_t samples;
+    // bytes on bus - headers, pixels, scroll
+    uint32_t bytes;
+  } CHART_Stats;
+
+  /** @struct Chart */
+  typedef struct {
+    // display
+    ST7735_Display *lcd;
+    // plot area
+    ST7735_Rect area;
+    // values of bottom and top row
+    int16_t min;
+    int16_t max;
+    // colors
+    uint16_t color;
+    uint16_t background;
+    uint16_t grid;
+    // pixels between gridlines, 0 - none
+    uint8_t gridX;
+    uint8_t gridY;
+    // CHART_SWEEP / CHART_SCROLL
+    uint8_t mode;
+    // sweep - next column, scroll - offset of hardware scroll
+    uint8_t column;
+    // ring of samples, last width samples kept
+    int16_t samples[CHART_SAMPLES];
+    uint8_t head;
+    uint8_t count;
+    // all pushed samples, phase of moving gridlines
+    uint32_t total;
+    // row of previous sample, -1 none
+    int16_t last;
+    // traffic
+    CHART_Stats stats;
+  } CHART_Chart;
+
+  /**
+   * @desc    Init chart in sweep mode without grid, nothing drawn till CHART_Draw / push
+   *
+   * @param   CHART_Chart * chart
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * area
+   * @param   int16_t value of bottom row
+   * @param   int16_t value of top row
+   * @param   uint16_t color of line
+   * @param   uint16_t background
+   *
+   * @return  uint8_t
+   */
+  uint8_t CHART_Init (CHART_Chart *, ST7735_Display *, const ST7735_Rect *, int16_t, int16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Gridlines every gx columns and gy rows, 0 - none
+   *
+   * @param   CHART_Chart * chart
+   * @param   uint8_t gx
+   * @param   uint8_t gy
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void CHART_SetGrid (CHART_Chart *, uint8_t, uint8_t, uint16_t);
+
+  /**
+   * @desc    Sweep / scroll mode, redraws chart
+   *          Scroll moves whole height of columns of chart, only rotations with MV = 1
+   *
+   * @param   CHART_Chart * chart
+   * @param   uint8_t CHART_SWEEP / CHART_SCROLL
+   *
+   * @return  uint8_t
+   */
+  uint8_t CHART_SetMode (CHART_Chart *, uint8_t);
+
+  /**
+   * @desc    Draw whole chart from ring - empty columns, then samples oldest first
+   *
+   * @param   CHART_Chart * chart
+   *
+   * @return  void
+   */
+  void CHART_Draw (CHART_Chart *);
+
+  /**
+   * @desc    Push sample, one column sent
+   *
+   * @param   CHART_Chart * chart
+   * @param   int16_t value
+   *
+   * @return  void
+   */
+  void CHART_Push (CHART_Chart *, int16_t);
+
+#endif
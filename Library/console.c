@@ -0,0 +1,464 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Text console Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        console.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      console.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Write compares new cell with shadow and marks it dirty only if it differs, so
+ *              unchanged text rewritten every refresh sends nothing. Flush finds runs of dirty
+ *              bits in every row, run is one window and its pixel rows are rendered into line
+ *              buffer banks of display - one row sent by DMA while next one is rendered.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include <stdio.h>
+#include <stdarg.h>
+#include "console.h"
+
+/** @const All columns of row */
+#define CONSOLE_ROW_MASK        ((uint32_t) ((1UL << CONSOLE_COLS) - 1))
+
+/**
+ * @desc    Columns of character
+ *
+ * @param   char character
+ *
+ * @return  const uint8_t *
+ */
+static const uint8_t * CONSOLE_Font (char character)
+{
+  // check if character is out of range
+  if (((uint8_t) character < 0x20) ||
+      ((uint8_t) character > 0x7f)) {
+    // space
+    return FONTS[0];
+  }
+  // columns of character
+  return FONTS[(uint8_t) character - 32];
+}
+
+/**
+ * @desc    Write cell of shadow, dirty only if changed
+ *
+ * @param   CONSOLE_Console * console
+ * @param   uint8_t column
+ * @param   uint8_t row
+ * @param   char character
+ * @param   uint8_t attribute
+ *
+ * @return  void
+ */
+static void CONSOLE_Cell_Set (CONSOLE_Console *console, uint8_t col, uint8_t row, char character, uint8_t attribute)
+{
+  // variables
+  CONSOLE_Cell *cell = &console->cells[row][col];
+
+  // same as before
+  if ((cell->character == character) && (cell->attribute == attribute)) {
+    return;
+  }
+  // new content
+  cell->character = character;
+  cell->attribute = attribute;
+  console->dirty[row] |= 1UL << col;
+}
+
+/**
+ * @desc    Scroll shadow one row up, last row cleared
+ *
+ * @param   CONSOLE_Console * console
+ *
+ * @return  void
+ */
+static void CONSOLE_Scroll (CONSOLE_Console *console)
+{
+  // variables
+  uint8_t col, row;
+
+  // loop through rows, cell by cell so only changed cells are dirty
+  for (row = 0; row < CONSOLE_ROWS - 1; row++) {
+    for (col = 0; col < CONSOLE_COLS; col++) {
+      CONSOLE_Cell_Set (console, col, row, console->cells[row + 1][col].character, console->cells[row + 1][col].attribute);
+    }
+  }
+  // empty last row
+  for (col = 0; col < CONSOLE_COLS; col++) {
+    CONSOLE_Cell_Set (console, col, CONSOLE_ROWS - 1, ' ', console->attribute);
+  }
+}
+
+/**
+ * @desc    Send run of cells in one window burst
+ *
+ * @param   CONSOLE_Console * console
+ * @param   uint8_t row
+ * @param   uint8_t first column
+ * @param   uint8_t number of cells
+ *
+ * @return  void
+ */
+static void CONSOLE_Run (CONSOLE_Console *console, uint8_t row, uint8_t first, uint8_t count)
+{
+  // variables
+  ST7735_Display *lcd = console->lcd;
+  const CONSOLE_Cell *cell;
+  const uint8_t *glyph;
+  uint8_t *buffer;
+  uint16_t color, background;
+  uint8_t line, col, index;
+  uint8_t bank = 0;
+  uint8_t mask;
+  uint8_t x = console->x + first * CONSOLE_CELL_WIDTH;
+  uint8_t y = console->y + row * CONSOLE_CELL_HEIGHT;
+  uint8_t px;
+  uint32_t bytes = lcd->bytes;
+  ST7735_Rect rect = { x, x + count * CONSOLE_CELL_WIDTH - 1, y, y + CONSOLE_CELL_HEIGHT - 1 };
+
+  // visible part of run, same clipping as fill
+  if ((ST7735_Clip_Rect (lcd, &rect) == ST7735_ERROR) ||
+      (ST7735_SetWindow (lcd, rect.xs, rect.xe, rect.ys, rect.ye) == ST7735_ERROR)) {
+    // clipped or off screen
+    return;
+  }
+  // RAMWR and hold chip select
+  ST7735_Burst_Begin (lcd);
+  // loop through visible pixel rows
+  for (line = rect.ys - y; line <= rect.ye - y; line++) {
+    // line buffer not sent by DMA
+    buffer = lcd->buffer[bank];
+    // bit of pixel row
+    mask = 1 << line;
+    // loop through cells of run
+    for (index = 0, px = x, cell = &console->cells[row][first]; index < count; index++, cell++) {
+      // colors and columns of cell
+      color = console->palette[cell->attribute >> 4];
+      background = console->palette[cell->attribute & 0x0F];
+      glyph = CONSOLE_Font (cell->character);
+      // loop through columns, last one is spacing
+      for (col = 0; col < CONSOLE_CELL_WIDTH; col++, px++) {
+        // clipped column
+        if ((px < rect.xs) || (px > rect.xe)) {
+          continue;
+        }
+        // write color MSB first
+        if ((col < CHARS_COLS_LEN) && (glyph[col] & mask)) {
+          *buffer++ = (uint8_t) (color >> 8);
+          *buffer++ = (uint8_t) color;
+        } else {
+          *buffer++ = (uint8_t) (background >> 8);
+          *buffer++ = (uint8_t) background;
+        }
+      }
+    }
+    // send row, meanwhile next row is rendered into other bank
+    ST7735_Burst_Write (lcd, lcd->buffer[bank], buffer - lcd->buffer[bank]);
+    // switch bank
+    bank ^= 1;
+  }
+  // release chip select
+  ST7735_Burst_End (lcd);
+  // traffic, CASET and RASET skipped by cache of window
+  console->stats.runs++;
+  console->stats.cells += count;
+  console->stats.bytes += lcd->bytes - bytes;
+}
+
+/**
+ * @desc    Init console - grid of spaces white on black, cursor home, all cells dirty
+ *
+ * @param   CONSOLE_Console * console
+ * @param   ST7735_Display * lcd
+ * @param   uint8_t x of left top corner
+ * @param   uint8_t y of left top corner
+ *
+ * @return  uint8_t
+ */
+uint8_t CONSOLE_Init (CONSOLE_Console *console, ST7735_Display *lcd, uint8_t x, uint8_t y)
+{
+  // variables
+  static const uint16_t palette[CONSOLE_COLORS] = {
+    BLACK, WHITE, RED, GREEN, BLUE, YELLOW, 0x8410, 0x07FF,
+    0xF81F, 0xFC00, 0x0010, 0x0400, 0x8000, 0x4208, 0xC618, 0x8400
+  };
+  uint8_t i;
+
+  // grid on screen
+  if (((x + CONSOLE_COLS * CONSOLE_CELL_WIDTH) > lcd->width) ||
+      ((y + CONSOLE_ROWS * CONSOLE_CELL_HEIGHT) > lcd->height)) {
+    // out of range
+    return ST7735_ERROR;
+  }
+  // display and position
+  console->lcd = lcd;
+  console->x = x;
+  console->y = y;
+  // default palette
+  for (i = 0; i < CONSOLE_COLORS; i++) {
+    console->palette[i] = palette[i];
+  }
+  // white on black
+  CONSOLE_SetColor (console, CONSOLE_WHITE, CONSOLE_BLACK);
+  // spaces, content of display unknown
+  CONSOLE_Clear (console);
+  CONSOLE_Invalidate (console);
+  // no traffic
+  console->stats.runs = 0;
+  console->stats.cells = 0;
+  console->stats.bytes = 0;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Set color of palette entry, cells using it are redrawn by next flush
+ *
+ * @param   CONSOLE_Console * console
+ * @param   uint8_t index
+ * @param   uint16_t color RGB565
+ *
+ * @return  void
+ */
+void CONSOLE_SetPalette (CONSOLE_Console *console, uint8_t index, uint16_t color)
+{
+  // variables
+  uint8_t col, row;
+  uint8_t attribute;
+
+  // out of range or same color
+  if ((index >= CONSOLE_COLORS) || (console->palette[index] == color)) {
+    return;
+  }
+  console->palette[index] = color;
+  // loop through cells using entry
+  for (row = 0; row < CONSOLE_ROWS; row++) {
+    for (col = 0; col < CONSOLE_COLS; col++) {
+      attribute = console->cells[row][col].attribute;
+      if (((attribute >> 4) == index) || ((attribute & 0x0F) == index)) {
+        console->dirty[row] |= 1UL << col;
+      }
+    }
+  }
+}
+
+/**
+ * @desc    Set colors of next written characters
+ *
+ * @param   CONSOLE_Console * console
+ * @param   uint8_t foreground palette index
+ * @param   uint8_t background palette index
+ *
+ * @return  void
+ */
+void CONSOLE_SetColor (CONSOLE_Console *console, uint8_t foreground, uint8_t background)
+{
+  // foreground in high nibble
+  console->attribute = (uint8_t) ((foreground & 0x0F) << 4) | (background & 0x0F);
+}
+
+/**
+ * @desc    Move cursor, saturated to grid
+ *
+ * @param   CONSOLE_Console * console
+ * @param   uint8_t column
+ * @param   uint8_t row
+ *
+ * @return  void
+ */
+void CONSOLE_SetCursor (CONSOLE_Console *console, uint8_t col, uint8_t row)
+{
+  // inside grid
+  console->col = (col < CONSOLE_COLS) ? col : CONSOLE_COLS - 1;
+  console->row = (row < CONSOLE_ROWS) ? row : CONSOLE_ROWS - 1;
+}
+
+/**
+ * @desc    Write character at cursor - '\n' new line, '\r' start of row
+ *          Cursor wraps at end of row, grid scrolls up below last row
+ *
+ * @param   CONSOLE_Console * console
+ * @param   char character
+ *
+ * @return  void
+ */
+void CONSOLE_Putc (CONSOLE_Console *console, char character)
+{
+  // start of row
+  if (character == '\r') {
+    console->col = 0;
+    return;
+  }
+  // printable character, cursor right
+  if (character != '\n') {
+    // wrapped row
+    if (console->col >= CONSOLE_COLS) {
+      console->col = 0;
+      console->row++;
+    }
+    // below last row
+    if (console->row >= CONSOLE_ROWS) {
+      CONSOLE_Scroll (console);
+      console->row = CONSOLE_ROWS - 1;
+    }
+    CONSOLE_Cell_Set (console, console->col++, console->row, character, console->attribute);
+    return;
+  }
+  // new line
+  console->col = 0;
+  console->row++;
+  // below last row
+  if (console->row >= CONSOLE_ROWS) {
+    CONSOLE_Scroll (console);
+    console->row = CONSOLE_ROWS - 1;
+  }
+}
+
+/**
+ * @desc    Write string at cursor
+ *
+ * @param   CONSOLE_Console * console
+ * @param   const char * string
+ *
+ * @return  void
+ */
+void CONSOLE_Puts (CONSOLE_Console *console, const char *str)
+{
+  // loop through characters
+  while (*str) {
+    CONSOLE_Putc (console, *str++);
+  }
+}
+
+/**
+ * @desc    Write formatted string at cursor, max CONSOLE_PRINTF_SIZE - 1 characters
+ *
+ * @param   CONSOLE_Console * console
+ * @param   const char * format
+ * @param   ... arguments
+ *
+ * @return  void
+ */
+void CONSOLE_Printf (CONSOLE_Console *console, const char *format, ...)
+{
+  // variables
+  char text[CONSOLE_PRINTF_SIZE];
+  va_list args;
+
+  // format, longer text truncated
+  va_start (args, format);
+  vsnprintf (text, sizeof (text), format, args);
+  va_end (args);
+  // write
+  CONSOLE_Puts (console, text);
+}
+
+/**
+ * @desc    Clear from cursor to end of row, cursor stays
+ *
+ * @param   CONSOLE_Console * console
+ *
+ * @return  void
+ */
+void CONSOLE_ClearEol (CONSOLE_Console *console)
+{
+  // variables
+  uint8_t col;
+
+  // cursor wrapped, nothing left of row
+  if (console->row >= CONSOLE_ROWS) {
+    return;
+  }
+  // loop through rest of row
+  for (col = console->col; col < CONSOLE_COLS; col++) {
+    CONSOLE_Cell_Set (console, col, console->row, ' ', console->attribute);
+  }
+}
+
+/**
+ * @desc    Clear grid by current colors, cursor home
+ *
+ * @param   CONSOLE_Console * console
+ *
+ * @return  void
+ */
+void CONSOLE_Clear (CONSOLE_Console *console)
+{
+  // loop through rows
+  for (console->row = 0; console->row < CONSOLE_ROWS; console->row++) {
+    console->col = 0;
+    CONSOLE_ClearEol (console);
+  }
+  // home
+  CONSOLE_SetCursor (console, 0, 0);
+}
+
+/**
+ * @desc    Mark all cells dirty - display changed by other drawing
+ *
+ * @param   CONSOLE_Console * console
+ *
+ * @return  void
+ */
+void CONSOLE_Invalidate (CONSOLE_Console *console)
+{
+  // variables
+  uint8_t row;
+
+  // all columns of all rows
+  for (row = 0; row < CONSOLE_ROWS; row++) {
+    console->dirty[row] = CONSOLE_ROW_MASK;
+  }
+}
+
+/**
+ * @desc    Send changed cells, adjacent cells of row in one window burst
+ *
+ * @param   CONSOLE_Console * console
+ *
+ * @return  uint16_t number of sent cells
+ */
+uint16_t CONSOLE_Flush (CONSOLE_Console *console)
+{
+  // variables
+  uint32_t dirty;
+  uint16_t sent = 0;
+  uint8_t first, count;
+  uint8_t row;
+
+  // loop through rows
+  for (row = 0; row < CONSOLE_ROWS; row++) {
+    dirty = console->dirty[row];
+    console->dirty[row] = 0;
+    first = 0;
+    // loop through runs of dirty bits
+    while (dirty) {
+      // skip clean cells
+      while (!(dirty & 1)) {
+        dirty >>= 1;
+        first++;
+      }
+      // count dirty cells
+      for (count = 0; dirty & 1; count++) {
+        dirty >>= 1;
+      }
+      // one burst
+      CONSOLE_Run (console, row, first, count);
+      first += count;
+      sent += count;
+    }
+  }
+
+  // sent cells
+  return sent;
+}
@@ -0,0 +1,201 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Text console Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        console.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Character grid 26 x 16 of font X1 with shadow cells in RAM (character, colors
+ *              of 16 color palette) - writes update only shadow, flush sends only changed cells,
+ *              horizontally adjacent ones in one window burst. Page rewritten wholesale costs
+ *              only cells which really changed.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __CONSOLE_H__
+#define __CONSOLE_H__
+
+  #include "st7735.h"
+
+  // Grid
+  // -----------------------------------
+  #define CONSOLE_COLS          26                                    // characters of row
+  #define CONSOLE_ROWS          16                                    // rows
+  #define CONSOLE_CELL_WIDTH    GLYPH_WIDTH (X1)                      // pixels incl. spacing
+  #define CONSOLE_CELL_HEIGHT   GLYPH_HEIGHT (X1)                     // pixels
+  #define CONSOLE_COLORS        16                                    // entries of palette
+  #define CONSOLE_PRINTF_SIZE   (CONSOLE_COLS * 2 + 1)                // formatted characters
+
+  // Default palette
+  // -----------------------------------
+  #define CONSOLE_BLACK         0
+  #define CONSOLE_WHITE         1
+  #define CONSOLE_RED           2
+  #define CONSOLE_GREEN         3
+  #define CONSOLE_BLUE          4
+  #define CONSOLE_YELLOW        5
+  #define CONSOLE_GRAY          6
+
+  /** @struct Cell - character and colors, foreground in high nibble */
+  typedef struct {
+    // character
+    char character;
+    // palette indexes, foreground << 4 | background
+    uint8_t attribute;
+  } CONSOLE_Cell;
+
+  /** @struct Traffic of flushes since init */
+  typedef struct {
+    // window bursts
+    uint32_t runs;
+    // sent cells
+    uint32_t cells;
+    // bytes on bus - headers and pixels
+    uint32_t bytes;
+  } CONSOLE_Stats;
+
+  /** @struct Console */
+  typedef struct {
+    // display
+    ST7735_Display *lcd;
+    // left top corner of grid
+    uint8_t x;
+    uint8_t y;
+    // shadow of grid
+    CONSOLE_Cell cells[CONSOLE_ROWS][CONSOLE_COLS];
+    // changed cells not sent yet, bit per column
+    uint32_t dirty[CONSOLE_ROWS];
+    // colors of attribute indexes
+    uint16_t palette[CONSOLE_COLORS];
+    // cursor
+    uint8_t col;
+    uint8_t row;
+    // attribute of next written character
+    uint8_t attribute;
+    // traffic
+    CONSOLE_Stats stats;
+  } CONSOLE_Console;
+
+  /**
+   * @desc    Init console - grid of spaces white on black, cursor home, all cells dirty
+   *
+   * @param   CONSOLE_Console * console
+   * @param   ST7735_Display * lcd
+   * @param   uint8_t x of left top corner
+   * @param   uint8_t y of left top corner
+   *
+   * @return  uint8_t
+   */
+  uint8_t CONSOLE_Init (CONSOLE_Console *, ST7735_Display *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Set color of palette entry, cells using it are redrawn by next flush
+   *
+   * @param   CONSOLE_Console * console
+   * @param   uint8_t index
+   * @param   uint16_t color RGB565
+   *
+   * @return  void
+   */
+  void CONSOLE_SetPalette (CONSOLE_Console *, uint8_t, uint16_t);
+
+  /**
+   * @desc    Set colors of next written characters
+   *
+   * @param   CONSOLE_Console * console
+   * @param   uint8_t foreground palette index
+   * @param   uint8_t background palette index
+   *
+   * @return  void
+   */
+  void CONSOLE_SetColor (CONSOLE_Console *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Move cursor, saturated to grid
+   *
+   * @param   CONSOLE_Console * console
+   * @param   uint8_t column
+   * @param   uint8_t row
+   *
+   * @return  void
+   */
+  void CONSOLE_SetCursor (CONSOLE_Console *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Write character at cursor - '\n' new line, '\r' start of row
+   *          Cursor wraps at end of row, grid scrolls up below last row
+   *
+   * @param   CONSOLE_Console * console
+   * @param   char character
+   *
+   * @return  void
+   */
+  void CONSOLE_Putc (CONSOLE_Console *, char);
+
+  /**
+   * @desc    Write string at cursor
+   *
+   * @param   CONSOLE_Console * console
+   * @param   const char * string
+   *
+   * @return  void
+   */
+  void CONSOLE_Puts (CONSOLE_Console *, const char *);
+
+  /**
+   * @desc    Write formatted string at cursor, max CONSOLE_PRINTF_SIZE - 1 characters
+   *
+   * @param   CONSOLE_Console * console
+   * @param   const char * format
+   * @param   ... arguments
+   *
+   * @return  void
+   */
+  void CONSOLE_Printf (CONSOLE_Console *, const char *, ...);
+
+  /**
+   * @desc    Clear from cursor to end of row, cursor stays
+   *
+   * @param   CONSOLE_Console * console
+   *
+   * @return  void
+   */
+  void CONSOLE_ClearEol (CONSOLE_Console *);
+
+  /**
+   * @desc    Clear grid by current colors, cursor home
+   *
+   * @param   CONSOLE_Console * console
+   *
+   * @return  void
+   */
+  void CONSOLE_Clear (CONSOLE_Console *);
+
+  /**
+   * @desc    Mark all cells dirty - display changed by other drawing
+   *
+   * @param   CONSOLE_Console * console
+   *
+   * @return  void
+   */
+  void CONSOLE_Invalidate (CONSOLE_Console *);
+
+  /**
+   * @desc    Send changed cells, adjacent cells of row in one window burst
+   *
+   * @param   CONSOLE_Console * console
+   *
+   * @return  uint16_t number of sent cells
+   */
+  uint16_t CONSOLE_Flush (CONSOLE_Console *);
+
+#endif
@@ -0,0 +1,463 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Display list Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        dlist.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      dlist.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Display lists - drawing calls between DLIST_Begin and DLIST_End are recorded
+ *              into compact binary list instead of being sent. Replay streams pre-encoded
+ *              windows and pixel data (DMA directly from RAM / flash) without argument checks.
+ *              Lists can be built offline by Tools/dlist.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "dlist.h"
+
+/**
+ * @desc    Check free space, one byte always kept for DLIST_END
+ *
+ * @param   DLIST_List * list
+ * @param   uint16_t number of bytes
+ *
+ * @return  uint8_t
+ */
+static uint8_t DLIST_Reserve (DLIST_List *list, uint16_t count)
+{
+  // already full
+  if (list->overflow) {
+    return ST7735_ERROR;
+  }
+  // not enough space
+  if ((uint32_t) list->length + count >= list->size) {
+    // list invalid
+    list->overflow = 1;
+    return ST7735_ERROR;
+  }
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Store 16 bit value MSB first
+ *
+ * @param   uint8_t * data
+ * @param   uint16_t value
+ *
+ * @return  void
+ */
+static void DLIST_Put16 (uint8_t *data, uint16_t value)
+{
+  // MSB
+  data[0] = (uint8_t) (value >> 8);
+  // LSB
+  data[1] = (uint8_t) value;
+}
+
+/**
+ * @desc    Read 16 bit value MSB first
+ *
+ * @param   const uint8_t * data
+ *
+ * @return  uint16_t
+ */
+static uint16_t DLIST_Get16 (const uint8_t *data)
+{
+  // MSB, LSB
+  return ((uint16_t) data[0] << 8) | data[1];
+}
+
+/**
+ * @desc    Open fill record
+ *
+ * @param   DLIST_List * list
+ * @param   uint16_t color
+ * @param   uint16_t count
+ *
+ * @return  void
+ */
+static void DLIST_Open_Fill (DLIST_List *list, uint16_t color, uint16_t count)
+{
+  // no space
+  if (DLIST_Reserve (list, 5) == ST7735_ERROR) {
+    return;
+  }
+  // header
+  list->record = list->length;
+  list->data[list->length++] = DLIST_FILL;
+  DLIST_Put16 (&list->data[list->length], color);
+  DLIST_Put16 (&list->data[list->length + 2], count);
+  list->length += 4;
+  // open record
+  list->type = DLIST_FILL;
+  list->count = count;
+  list->last = color;
+}
+
+/**
+ * @desc    Record one pixel of RAM write
+ *          Runs of DLIST_RUN_MIN equal pixels are turned into fill record
+ *
+ * @param   DLIST_List * list
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+static void DLIST_Pixel (DLIST_List *list, uint16_t color)
+{
+  // extend fill
+  if ((list->type == DLIST_FILL) && (list->last == color) && (list->count < 0xFFFF)) {
+    // one more
+    list->count++;
+    DLIST_Put16 (&list->data[list->record + 3], list->count);
+    return;
+  }
+  // extend pixels
+  if ((list->type == DLIST_PIXELS) && (list->count < 0xFFFF)) {
+    // no space
+    if (DLIST_Reserve (list, 2) == ST7735_ERROR) {
+      return;
+    }
+    // append pixel
+    DLIST_Put16 (&list->data[list->length], color);
+    list->length += 2;
+    list->count++;
+    // equal pixels at end
+    list->run = (list->last == color) ? list->run + 1 : 1;
+    list->last = color;
+    // run long enough for fill
+    if (list->run == DLIST_RUN_MIN) {
+      // remove run from pixels
+      list->length -= DLIST_RUN_MIN << 1;
+      list->count -= DLIST_RUN_MIN;
+      // pixels record empty
+      if (list->count == 0) {
+        list->length = list->record;
+      } else {
+        DLIST_Put16 (&list->data[list->record + 1], list->count);
+      }
+      // continue as fill
+      DLIST_Open_Fill (list, color, DLIST_RUN_MIN);
+      return;
+    }
+    // new count
+    DLIST_Put16 (&list->data[list->record + 1], list->count);
+    return;
+  }
+  // no space
+  if (DLIST_Reserve (list, 5) == ST7735_ERROR) {
+    return;
+  }
+  // new pixels record
+  list->record = list->length;
+  list->data[list->length++] = DLIST_PIXELS;
+  DLIST_Put16 (&list->data[list->length], 1);
+  DLIST_Put16 (&list->data[list->length + 2], color);
+  list->length += 4;
+  // open record
+  list->type = DLIST_PIXELS;
+  list->count = 1;
+  list->last = color;
+  list->run = 1;
+}
+
+/**
+ * @desc    Init empty list in buffer
+ *
+ * @param   DLIST_List * list
+ * @param   uint8_t * buffer
+ * @param   uint16_t size of buffer
+ *
+ * @return  void
+ */
+void DLIST_Init (DLIST_List *list, uint8_t *buffer, uint16_t size)
+{
+  // buffer
+  list->data = buffer;
+  list->size = size;
+  // empty list
+  list->length = 0;
+  list->overflow = (size == 0);
+  list->type = DLIST_END;
+  list->command = NOP;
+  // terminated
+  if (size > 0) {
+    buffer[0] = DLIST_END;
+  }
+}
+
+/**
+ * @desc    Start recording - drawing calls of display go into list
+ *
+ * @param   ST7735_Display * lcd
+ * @param   DLIST_List * list
+ *
+ * @return  void
+ */
+void DLIST_Begin (ST7735_Display *lcd, DLIST_List *list)
+{
+  // finish pending burst
+  ST7735_Sync (lcd);
+  // empty list
+  DLIST_Init (list, list->data, list->size);
+  // first window must be recorded
+  ST7735_InvalidateWindow (lcd);
+  // record
+  lcd->record = list;
+}
+
+/**
+ * @desc    Stop recording, terminate list
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  uint8_t
+ */
+uint8_t DLIST_End (ST7735_Display *lcd)
+{
+  // list
+  DLIST_List *list = lcd->record;
+
+  // not recording
+  if (list == NULL) {
+    return ST7735_ERROR;
+  }
+  // stop recording
+  lcd->record = NULL;
+  // window of display unknown
+  ST7735_InvalidateWindow (lcd);
+  // terminate, space reserved
+  if (list->size > 0) {
+    list->data[list->length] = DLIST_END;
+  }
+  // list complete
+  return list->overflow ? ST7735_ERROR : ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Record command - called by ST7735_Command
+ *
+ * @param   DLIST_List * list
+ * @param   uint8_t command
+ *
+ * @return  void
+ */
+void DLIST_Record_Command (DLIST_List *list, uint8_t command)
+{
+  // close open record
+  list->type = DLIST_END;
+  // new command
+  list->command = command;
+  list->nargs = 0;
+  list->pending = 0;
+
+  // window encoded by own record
+  if ((command == CASET) || (command == RASET)) {
+    return;
+  }
+  // RAM write - every RAMWR starts again at window origin, also with cached window
+  if (command == RAMWR) {
+    if (DLIST_Reserve (list, 1) == ST7735_SUCCESS) {
+      list->data[list->length++] = DLIST_WRITE;
+    }
+    return;
+  }
+  // no space
+  if (DLIST_Reserve (list, 3) == ST7735_ERROR) {
+    return;
+  }
+  // command with parameters
+  list->record = list->length;
+  list->data[list->length++] = DLIST_COMMAND;
+  list->data[list->length++] = command;
+  list->data[list->length++] = 0;
+  // open record
+  list->type = DLIST_COMMAND;
+  list->count = 0;
+}
+
+/**
+ * @desc    Record data bytes - called by ST7735_Data8b / Data16b / Burst_Write
+ *
+ * @param   DLIST_List * list
+ * @param   const uint8_t * data
+ * @param   uint16_t number of bytes
+ *
+ * @return  void
+ */
+void DLIST_Record_Data (DLIST_List *list, const uint8_t *data, uint16_t count)
+{
+  // variables
+  uint8_t byte;
+
+  // loop through bytes
+  while (count--) {
+    // byte
+    byte = *data++;
+    // decode by last command
+    switch (list->command) {
+      // window
+      case CASET:
+      case RASET:
+        // parameters start MSB, start LSB, end MSB, end LSB
+        if (list->nargs < 4) {
+          list->args[list->nargs++] = byte;
+        }
+        // all parameters received
+        if (list->nargs == 4) {
+          // columns
+          if (list->command == CASET) {
+            list->x0 = list->args[1];
+            list->x1 = list->args[3];
+          // rows, window complete
+          } else if (DLIST_Reserve (list, 5) == ST7735_SUCCESS) {
+            list->data[list->length++] = DLIST_WINDOW;
+            list->data[list->length++] = list->x0;
+            list->data[list->length++] = list->x1;
+            list->data[list->length++] = list->args[1];
+            list->data[list->length++] = list->args[3];
+          }
+          // further bytes ignored
+          list->nargs++;
+        }
+        break;
+      // pixels MSB first
+      case RAMWR:
+        // upper byte
+        if (!list->pending) {
+          list->half = byte;
+          list->pending = 1;
+        // whole pixel
+        } else {
+          DLIST_Pixel (list, ((uint16_t) list->half << 8) | byte);
+          list->pending = 0;
+        }
+        break;
+      // parameter of other command
+      default:
+        // append to open command
+        if ((list->type == DLIST_COMMAND) &&
+            (list->count < 0xFF) &&
+            (DLIST_Reserve (list, 1) == ST7735_SUCCESS)) {
+          list->data[list->length++] = byte;
+          list->data[list->record + 2] = (uint8_t) ++list->count;
+        }
+        break;
+    }
+  }
+}
+
+/**
+ * @desc    Replay list from RAM or flash
+ *          Records are not checked, window cache of display follows list
+ *          Fill and pixels records after write record are parts of one RAM write - RAMWR
+ *          sent by write record, rest continue the burst
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const uint8_t * records
+ *
+ * @return  uint8_t
+ */
+uint8_t DLIST_Replay (ST7735_Display *lcd, const uint8_t *record)
+{
+  // variables
+  uint32_t bytes;
+  uint16_t chunk;
+  uint8_t burst = 0;
+  uint8_t i;
+
+  // loop through records
+  while (*record != DLIST_END) {
+    // window, command or next write ends RAM write
+    if (burst && ((*record == DLIST_WINDOW) || (*record == DLIST_COMMAND) || (*record == DLIST_WRITE))) {
+      ST7735_Burst_End (lcd);
+      burst = 0;
+    // pixels without write record, RAMWR sent by first of them
+    } else if (!burst && ((*record == DLIST_FILL) || (*record == DLIST_PIXELS))) {
+      ST7735_Burst_Begin (lcd);
+      burst = 1;
+    }
+    // decode
+    switch (*record) {
+      // CASET / RASET
+      case DLIST_WINDOW:
+        // column address set
+        ST7735_Command (lcd, CASET);
+        ST7735_Data16b (lcd, record[1]);
+        ST7735_Data16b (lcd, record[2]);
+        // row address set
+        ST7735_Command (lcd, RASET);
+        ST7735_Data16b (lcd, record[3]);
+        ST7735_Data16b (lcd, record[4]);
+        // remember window
+        lcd->window.xs = record[1];
+        lcd->window.xe = record[2];
+        lcd->window.ys = record[3];
+        lcd->window.ye = record[4];
+        // next record
+        record += 5;
+        break;
+      // RAMWR, burst from window origin
+      case DLIST_WRITE:
+        ST7735_Burst_Begin (lcd);
+        burst = 1;
+        // next record
+        record += 1;
+        break;
+      // one color inside RAM write
+      case DLIST_FILL:
+        // one color repeated by DMA
+        ST7735_Burst_Fill (lcd, DLIST_Get16 (&record[1]), DLIST_Get16 (&record[3]));
+        // next record
+        record += 5;
+        break;
+      // pixels inside RAM write
+      case DLIST_PIXELS:
+        // bytes of pixels
+        bytes = (uint32_t) DLIST_Get16 (&record[1]) << 1;
+        record += 3;
+        // DMA directly from list
+        while (bytes > 0) {
+          // chunk
+          chunk = (bytes > 0xFFFE) ? 0xFFFE : bytes;
+          // send
+          ST7735_Burst_Write (lcd, record, chunk);
+          // rest
+          record += chunk;
+          bytes -= chunk;
+        }
+        break;
+      // other command
+      case DLIST_COMMAND:
+        // command
+        ST7735_Command (lcd, record[1]);
+        // parameters
+        for (i = 0; i < record[2]; i++) {
+          ST7735_Data8b (lcd, record[3 + i]);
+        }
+        // next record
+        record += 3 + record[2];
+        break;
+      // unknown record
+      default:
+        return ST7735_ERROR;
+    }
+  }
+  // last RAM write, finished in background
+  if (burst) {
+    ST7735_Burst_End (lcd);
+  }
+
+  // success
+  return ST7735_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Display list Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        dlist.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Display lists - drawing calls between DLIST_Begin and DLIST_End are recorded
+ *              into compact binary list instead of being sent. Replay streams pixel data by DMA
+ *              directly from RAM / flash without argument checks, windows are sent as short
+ *              CASET / RASET commands. Lists can be built offline by Tools/dlist.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __DLIST_H__
+#define __DLIST_H__
+
+  #include "st7735.h"
+
+  // Records - first byte
+  // -----------------------------------
+  // END     - end of list
+  // WINDOW  - x0, x1, y0, y1                          - CASET / RASET
+  // WRITE   -                                         - RAMWR, write from window origin
+  // FILL    - color MSB, LSB, count MSB, LSB          - color repeated count times
+  // PIXELS  - count MSB, LSB, count * color MSB, LSB  - pixels
+  // COMMAND - command, n, n bytes                     - other command with parameters
+  // FILL / PIXELS records following each other are parts of RAM write of last WRITE
+  #define DLIST_END             0x00
+  #define DLIST_WINDOW          0x01
+  #define DLIST_FILL            0x02
+  #define DLIST_PIXELS          0x03
+  #define DLIST_COMMAND         0x04
+  #define DLIST_WRITE           0x05
+
+  // Recorder definition
+  // -----------------------------------
+  #define DLIST_RUN_MIN         4                 // equal pixels turned into fill
+
+  /** @struct Display list in RAM with recorder state */
+  typedef struct DLIST_List {
+    // records
+    uint8_t *data;
+    // size of buffer
+    uint16_t size;
+    // used bytes
+    uint16_t length;
+    // buffer too small, list invalid
+    uint8_t overflow;
+    // last command
+    uint8_t command;
+    // parameters of CASET / RASET
+    uint8_t args[4];
+    // number of received parameters
+    uint8_t nargs;
+    // x start / end of CASET
+    uint8_t x0, x1;
+    // upper byte of pixel received
+    uint8_t half;
+    // pixel byte pending
+    uint8_t pending;
+    // offset of open record header
+    uint16_t record;
+    // open record - DLIST_FILL, DLIST_PIXELS, DLIST_COMMAND / DLIST_END none
+    uint8_t type;
+    // items in open record
+    uint16_t count;
+    // last pixel color
+    uint16_t last;
+    // equal pixels at end of open record
+    uint8_t run;
+  } DLIST_List;
+
+  /**
+   * @desc    Init empty list in buffer
+   *
+   * @param   DLIST_List * list
+   * @param   uint8_t * buffer
+   * @param   uint16_t size of buffer
+   *
+   * @return  void
+   */
+  void DLIST_Init (DLIST_List *, uint8_t *, uint16_t);
+
+  /**
+   * @desc    Start recording - drawing calls of display go into list
+   *
+   * @param   ST7735_Display * lcd
+   * @param   DLIST_List * list
+   *
+   * @return  void
+   */
+  void DLIST_Begin (ST7735_Display *, DLIST_List *);
+
+  /**
+   * @desc    Stop recording, terminate list
+   *
+   * @param   ST7735_Display * lcd
+   *
+   * @return  uint8_t
+   */
+  uint8_t DLIST_End (ST7735_Display *);
+
+  /**
+   * @desc    Replay list from RAM or flash
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const uint8_t * records
+   *
+   * @return  uint8_t
+   */
+  uint8_t DLIST_Replay (ST7735_Display *, const uint8_t *);
+
+  /**
+   * @desc    Record command - called by ST7735_Command
+   *
+   * @param   DLIST_List * list
+   * @param   uint8_t command
+   *
+   * @return  void
+   */
+  void DLIST_Record_Command (DLIST_List *, uint8_t);
+
+  /**
+   * @desc    Record data bytes - called by ST7735_Data8b / Data16b / Burst_Write
+   *
+   * @param   DLIST_List * list
+   * @param   const uint8_t * data
+   * @param   uint16_t number of bytes
+   *
+   * @return  void
+   */
+  void DLIST_Record_Data (DLIST_List *, const uint8_t *, uint16_t);
+
+#endif
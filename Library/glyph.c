@@ -0,0 +1,322 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Glyph cache Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        glyph.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      glyph.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       LRU cache of pre-expanded RGB565 character cells keyed by character, size,
+ *              color and background. Hits are sent by DMA directly from RAM. Budget is split
+ *              into units of X1 cell, cell takes units by its size (X1 - 1, X2 - 2, X3 - 4)
+ *              in block aligned to its size.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "glyph.h"
+
+/** @struct Cache slot - cell starting at unit */
+typedef struct {
+  // last use
+  uint32_t stamp;
+  // color
+  uint16_t color;
+  // background
+  uint16_t background;
+  // character
+  char character;
+  // font size
+  enum Size size;
+} GLYPH_Slot;
+
+/** @var Statistics */
+GLYPH_Stats glyphStats;
+
+/** @var Slots by first unit of cell */
+static GLYPH_Slot glyphSlot[GLYPH_CACHE_UNITS];
+/** @var First unit of cell covering unit + 1, 0 - free unit */
+static uint8_t glyphOwner[GLYPH_CACHE_UNITS];
+/** @var Expanded cells, MSB first */
+static uint8_t glyphCell[GLYPH_CACHE_UNITS][GLYPH_CACHE_UNIT];
+/** @var Use counter */
+static uint32_t glyphClock;
+
+/**
+ * @desc    Units of cell - power of 2 covering its bytes
+ *
+ * @param   enum Size (X1, X2, X3)
+ *
+ * @return  uint8_t
+ */
+static uint8_t GLYPH_Units (enum Size size)
+{
+  // variables
+  uint16_t bytes = GLYPH_WIDTH (size) * GLYPH_HEIGHT (size) * 2;
+  uint8_t units = 1;
+
+  // X1 - 1, X2 - 2, X3 - 4
+  while ((uint16_t) units * GLYPH_CACHE_UNIT < bytes) {
+    units <<= 1;
+  }
+  // units of cell
+  return units;
+}
+
+/**
+ * @desc    Expand character from font into cell
+ *
+ * @param   uint8_t * cell
+ * @param   char character
+ * @param   uint16_t color
+ * @param   uint16_t background
+ * @param   enum Size (X1, X2, X3)
+ *
+ * @return  void
+ */
+static void GLYPH_Expand (uint8_t *cell, char character, uint16_t color, uint16_t background, enum Size size)
+{
+  // variables
+  const uint8_t *glyph = FONTS[character - 32];
+  uint8_t shift_x = GLYPH_SCALE_X (size) - 1;
+  uint8_t shift_y = GLYPH_SCALE_Y (size) - 1;
+  uint8_t idxCol;
+  uint8_t mask;
+  uint8_t col, row;
+
+  // loop through rows
+  for (row = 0; row < GLYPH_HEIGHT (size); row++) {
+    // bit of row
+    mask = 1 << (row >> shift_y);
+    // loop through columns incl. spacing column
+    for (col = 0; col < GLYPH_WIDTH (size); col++) {
+      // column of character
+      idxCol = col >> shift_x;
+      // write color MSB first
+      if ((idxCol < CHARS_COLS_LEN) && (glyph[idxCol] & mask)) {
+        *cell++ = (uint8_t) (color >> 8);
+        *cell++ = (uint8_t) color;
+      } else {
+        *cell++ = (uint8_t) (background >> 8);
+        *cell++ = (uint8_t) background;
+      }
+    }
+  }
+}
+
+/**
+ * @desc    Free units of cell
+ *
+ * @param   uint8_t first unit of cell
+ *
+ * @return  void
+ */
+static void GLYPH_Evict (uint8_t first)
+{
+  // variables
+  uint8_t units = GLYPH_Units (glyphSlot[first].size);
+  uint8_t i;
+
+  // statistics
+  glyphStats.evictions++;
+  // empty slot
+  glyphSlot[first].stamp = 0;
+  // free units
+  for (i = first; i < first + units; i++) {
+    glyphOwner[i] = 0;
+  }
+}
+
+/**
+ * @desc    Find cell in cache or expand it into least recently used block of units
+ *
+ * @param   char character
+ * @param   uint16_t color
+ * @param   uint16_t background
+ * @param   enum Size (X1, X2, X3)
+ *
+ * @return  uint8_t * cell / NULL - cell bigger than budget
+ */
+static uint8_t * GLYPH_Lookup (char character, uint16_t color, uint16_t background, enum Size size)
+{
+  // variables
+  GLYPH_Slot *slot;
+  uint8_t units = GLYPH_Units (size);
+  uint8_t victim = 0;
+  uint32_t oldest = 0xFFFFFFFF;
+  uint32_t stamp;
+  uint8_t i, j;
+
+  // loop through cells
+  for (i = 0; i < GLYPH_CACHE_UNITS; i++) {
+    // slot
+    slot = &glyphSlot[i];
+    // hit
+    if ((glyphOwner[i] == i + 1)        &&
+        (slot->character == character)  &&
+        (slot->size == size)            &&
+        (slot->color == color)          &&
+        (slot->background == background)) {
+      // mark as recently used
+      slot->stamp = ++glyphClock;
+      // statistics
+      glyphStats.hits++;
+      // found
+      return glyphCell[i];
+    }
+  }
+
+  // miss - loop through aligned blocks
+  for (i = 0; i + units <= GLYPH_CACHE_UNITS; i += units) {
+    // last use of cells in block, free units 0
+    stamp = 0;
+    for (j = i; j < i + units; j++) {
+      if ((glyphOwner[j] != 0) && (glyphSlot[glyphOwner[j] - 1].stamp > stamp)) {
+        stamp = glyphSlot[glyphOwner[j] - 1].stamp;
+      }
+    }
+    // least recently used block
+    if (stamp < oldest) {
+      victim = i;
+      oldest = stamp;
+    }
+  }
+  // cell does not fit budget
+  if (units > GLYPH_CACHE_UNITS) {
+    return NULL;
+  }
+  // statistics
+  glyphStats.misses++;
+  // cells overlapping block
+  for (j = victim; j < victim + units; j++) {
+    if (glyphOwner[j] != 0) {
+      GLYPH_Evict (glyphOwner[j] - 1);
+    }
+  }
+  // units of cell
+  for (j = victim; j < victim + units; j++) {
+    glyphOwner[j] = victim + 1;
+  }
+  // new key
+  slot = &glyphSlot[victim];
+  slot->stamp = ++glyphClock;
+  slot->character = character;
+  slot->size = size;
+  slot->color = color;
+  slot->background = background;
+  // expand from font, cell continues in following units
+  GLYPH_Expand (glyphCell[victim], character, color, background, size);
+
+  // cell
+  return glyphCell[victim];
+}
+
+/**
+ * @desc    Draw opaque character cell through cache
+ *          Partially visible cells bypass cache
+ *
+ * @param   ST7735_Display * lcd
+ * @param   int16_t x position
+ * @param   int16_t y position
+ * @param   char character
+ * @param   uint16_t color
+ * @param   uint16_t background
+ * @param   enum Size (X1, X2, X3)
+ *
+ * @return  uint8_t
+ */
+uint8_t GLYPH_Draw (ST7735_Display *lcd, int16_t x, int16_t y, char character, uint16_t color, uint16_t background, enum Size size)
+{
+  // variables
+  int16_t xe = x + GLYPH_WIDTH (size) - 1;
+  int16_t ye = y + GLYPH_HEIGHT (size) - 1;
+  const uint8_t *cell;
+
+  // check if character is out of range
+  if (((uint8_t) character < 0x20) ||
+      ((uint8_t) character > 0x7f)) {
+    // out of range
+    return ST7735_ERROR;
+  }
+  // cell not whole inside clip rectangle
+  if ((x < lcd->clip.xs) || (xe > lcd->clip.xe) || (y < lcd->clip.ys) || (ye > lcd->clip.ye)) {
+    // draw clipped cell directly
+    return ST7735_DrawGlyph (lcd, x, y, character, color, background, size, NULL);
+  }
+
+  // previous cell may still be sent by DMA - miss can expand into it
+  ST7735_Sync (lcd);
+  // find or expand cell
+  cell = GLYPH_Lookup (character, color, background, size);
+  // cell bigger than budget
+  if (cell == NULL) {
+    // draw cell directly
+    return ST7735_DrawGlyph (lcd, x, y, character, color, background, size, NULL);
+  }
+  // set window of cell
+  ST7735_SetWindow (lcd, x, xe, y, ye);
+  // send cell from RAM
+  ST7735_Burst_Begin (lcd);
+  ST7735_Burst_Write (lcd, cell, GLYPH_WIDTH (size) * GLYPH_HEIGHT (size) * 2);
+  ST7735_Burst_End (lcd);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Draw opaque string through cache
+ *
+ * @param   ST7735_Display * lcd
+ * @param   int16_t x position
+ * @param   int16_t y position
+ * @param   const char * string
+ * @param   uint16_t color
+ * @param   uint16_t background
+ * @param   enum Size (X1, X2, X3)
+ *
+ * @return  void
+ */
+void GLYPH_DrawString (ST7735_Display *lcd, int16_t x, int16_t y, const char *str, uint16_t color, uint16_t background, enum Size size)
+{
+  // loop through characters
+  while (*str != '\0') {
+    // draw cell
+    GLYPH_Draw (lcd, x, y, *str++, color, background, size);
+    // next position
+    x += GLYPH_WIDTH (size);
+  }
+}
+
+/**
+ * @desc    Invalidate all cells and reset statistics
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void GLYPH_Flush (void)
+{
+  // variables
+  uint8_t i;
+
+  // loop through units
+  for (i = 0; i < GLYPH_CACHE_UNITS; i++) {
+    // empty slot, free unit
+    glyphSlot[i].stamp = 0;
+    glyphOwner[i] = 0;
+  }
+  // reset counters
+  glyphClock = 0;
+  glyphStats.hits = 0;
+  glyphStats.misses = 0;
+  glyphStats.evictions = 0;
+}
@@ -0,0 +1,89 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Glyph cache Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        glyph.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       LRU cache of pre-expanded RGB565 character cells keyed by character, size,
+ *              color and background. Hits are sent by DMA directly from RAM. Budget is split
+ *              into units of X1 cell, cell takes units by its size (X1 - 1, X2 - 2, X3 - 4)
+ *              in block aligned to its size.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __GLYPH_H__
+#define __GLYPH_H__
+
+  #include "st7735.h"
+
+  // Cache definition
+  // -----------------------------------
+  #ifndef GLYPH_CACHE_BUDGET
+    #define GLYPH_CACHE_BUDGET  3520              // bytes of RAM for cells
+  #endif
+  #define GLYPH_CACHE_UNIT      (GLYPH_WIDTH (X1) * GLYPH_HEIGHT (X1) * 2)  // bytes of X1 cell
+  #define GLYPH_CACHE_UNITS     (GLYPH_CACHE_BUDGET / GLYPH_CACHE_UNIT)    // max cells of X1
+
+  /** @struct Statistics */
+  typedef struct {
+    // cell found in cache
+    uint32_t hits;
+    // cell expanded from font
+    uint32_t misses;
+    // used cell replaced
+    uint32_t evictions;
+  } GLYPH_Stats;
+
+  /** @var Statistics */
+  extern GLYPH_Stats glyphStats;
+
+  /**
+   * @desc    Draw opaque character cell through cache
+   *
+   * @param   ST7735_Display * lcd
+   * @param   int16_t x position
+   * @param   int16_t y position
+   * @param   char character
+   * @param   uint16_t color
+   * @param   uint16_t background
+   * @param   enum Size (X1, X2, X3)
+   *
+   * @return  uint8_t
+   */
+  uint8_t GLYPH_Draw (ST7735_Display *, int16_t, int16_t, char, uint16_t, uint16_t, enum Size);
+
+  /**
+   * @desc    Draw opaque string through cache
+   *
+   * @param   ST7735_Display * lcd
+   * @param   int16_t x position
+   * @param   int16_t y position
+   * @param   const char * string
+   * @param   uint16_t color
+   * @param   uint16_t background
+   * @param   enum Size (X1, X2, X3)
+   *
+   * @return  void
+   */
+  void GLYPH_DrawString (ST7735_Display *, int16_t, int16_t, const char *, uint16_t, uint16_t, enum Size);
+
+  /**
+   * @desc    Invalidate all cells and reset statistics
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void GLYPH_Flush (void);
+
+#endif
@@ -0,0 +1,383 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        GRAM readback Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        gram.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      gram.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Read-modify-write of panel memory without framebuffer - window of GRAM is read
+ *              by RAMRD into free bank of line buffer, modified and written back in same window.
+ *              Rows of area are processed in chunks fitting one bank, write of chunk runs by
+ *              DMA while next chunk is read into other bank.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      http://www.displayfuture.com/Display/datasheet/controller/ST7735.pdf
+ */
+
+/** @includes */
+#include "gram.h"
+
+/**
+ * @desc    Bank of line buffer not sent by DMA
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  uint8_t *
+ */
+static uint8_t * GRAM_Bank (ST7735_Display *lcd)
+{
+  // other than last burst
+  return lcd->buffer[(lcd->xfer.buffer == lcd->buffer[0]) ? 1 : 0];
+}
+
+/**
+ * @desc    Count traffic since snapshot of byte counter of display
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint32_t bytes of display before transfer
+ * @param   uint32_t pixels read
+ * @param   uint32_t pixels written
+ * @param   GRAM_Stats * traffic / NULL
+ *
+ * @return  void
+ */
+static void GRAM_Count (ST7735_Display *lcd, uint32_t bytes, uint32_t read, uint32_t written, GRAM_Stats *stats)
+{
+  // not counted
+  if (stats == NULL) {
+    return;
+  }
+  // headers, dummy bytes and pixels as sent by driver
+  stats->bytes += lcd->bytes - bytes;
+  stats->read += read;
+  stats->written += written;
+}
+
+/**
+ * @desc    Read window into buffer
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint8_t x start
+ * @param   uint8_t x end
+ * @param   uint8_t y start
+ * @param   uint8_t y end
+ * @param   uint8_t * buffer
+ * @param   GRAM_Stats * traffic / NULL
+ *
+ * @return  uint8_t
+ */
+static uint8_t GRAM_Read (ST7735_Display *lcd, uint8_t xs, uint8_t xe, uint8_t ys, uint8_t ye, uint8_t *buffer, GRAM_Stats *stats)
+{
+  // variables
+  uint32_t bytes = lcd->bytes;
+
+  // RAMRD
+  if (ST7735_ReadRect (lcd, xs, xe, ys, ye, buffer) == ST7735_ERROR) {
+    return ST7735_ERROR;
+  }
+  // traffic - header, dummy and 3 bytes per pixel
+  GRAM_Count (lcd, bytes, (uint32_t) (xe - xs + 1) * (ye - ys + 1), 0, stats);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Write buffer into window, sent in background
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint8_t x start
+ * @param   uint8_t x end
+ * @param   uint8_t y start
+ * @param   uint8_t y end
+ * @param   const uint8_t * buffer
+ * @param   GRAM_Stats * traffic / NULL
+ *
+ * @return  uint8_t
+ */
+static uint8_t GRAM_Write (ST7735_Display *lcd, uint8_t xs, uint8_t xe, uint8_t ys, uint8_t ye, const uint8_t *buffer, GRAM_Stats *stats)
+{
+  // variables
+  uint32_t bytes = lcd->bytes;
+
+  // window, cached after read of same area
+  if (ST7735_SetWindow (lcd, xs, xe, ys, ye) == ST7735_ERROR) {
+    // out of range
+    return ST7735_ERROR;
+  }
+  // RAMWR
+  ST7735_Burst_Begin (lcd);
+  ST7735_Burst_Write (lcd, buffer, ((xe - xs + 1) * (ye - ys + 1)) << 1);
+  ST7735_Burst_End (lcd);
+  // traffic - header and pixels
+  GRAM_Count (lcd, bytes, 0, (uint32_t) (xe - xs + 1) * (ye - ys + 1), stats);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Check if area lies on screen
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area
+ *
+ * @return  uint8_t
+ */
+static uint8_t GRAM_Check (ST7735_Display *lcd, const ST7735_Rect *area)
+{
+  // empty or outside of screen
+  if ((area->xs < 0) || (area->xs > area->xe) || (area->xe >= lcd->width) ||
+      (area->ys < 0) || (area->ys > area->ye) || (area->ye >= lcd->height)) {
+    return ST7735_ERROR;
+  }
+
+  // on screen
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Blend color over pixels, fast RGB565 blend of 5 bit alpha
+ *          Green spread into upper halfword so channels are multiplied at once
+ *
+ * @param   uint8_t * pixels, RGB565 MSB first
+ * @param   uint16_t number of pixels
+ * @param   uint16_t color
+ * @param   uint8_t alpha 0 ... 32
+ *
+ * @return  void
+ */
+static void GRAM_Blend_Line (uint8_t *pixel, uint16_t pixels, uint16_t color, uint8_t alpha)
+{
+  // variables
+  uint32_t fg = (color | ((uint32_t) color << 16)) & 0x07E0F81F;
+  uint32_t bg;
+
+  // loop through pixels
+  while (pixels--) {
+    // background spread
+    bg = (pixel[0] << 8) | pixel[1];
+    bg = (bg | (bg << 16)) & 0x07E0F81F;
+    // bg + (fg - bg) * alpha / 32
+    bg = ((((fg - bg) * alpha) >> 5) + bg) & 0x07E0F81F;
+    bg |= bg >> 16;
+    // MSB first
+    *pixel++ = (uint8_t) (bg >> 8);
+    *pixel++ = (uint8_t) bg;
+  }
+}
+
+/**
+ * @desc    Blend color over area, clipped by clip rectangle
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area
+ * @param   uint16_t color
+ * @param   uint8_t alpha, GRAM_TRANSPARENT ... GRAM_OPAQUE
+ * @param   GRAM_Stats * traffic, NULL - not counted
+ *
+ * @return  uint8_t
+ */
+uint8_t GRAM_Blend (ST7735_Display *lcd, const ST7735_Rect *area, uint16_t color, uint8_t alpha, GRAM_Stats *stats)
+{
+  // variables
+  ST7735_Rect rect = *area;
+  uint32_t bytes = lcd->bytes;
+  uint8_t weight = (alpha + 4) >> 3;
+  uint8_t *buffer;
+  uint8_t width;
+  uint8_t rows;
+  int16_t y;
+  int16_t ye;
+
+  // visible part, fully clipped or transparent costs no SPI byte
+  if ((ST7735_Clip_Rect (lcd, &rect) == ST7735_ERROR) || (weight == 0)) {
+    return ST7735_SUCCESS;
+  }
+  // opaque - plain fill without read
+  if (weight == 32) {
+    ST7735_FillRect (lcd, rect.xs, rect.xe, rect.ys, rect.ye, color);
+    // traffic
+    GRAM_Count (lcd, bytes, 0, (uint32_t) (rect.xe - rect.xs + 1) * (rect.ye - rect.ys + 1), stats);
+    return ST7735_SUCCESS;
+  }
+  // rows fitting one bank
+  width = rect.xe - rect.xs + 1;
+  rows = LINE_BUFFER_SIZE / (width << 1);
+
+  // loop through chunks of rows
+  for (y = rect.ys; y <= rect.ye; y += rows) {
+    // last chunk
+    ye = y + rows - 1;
+    if (ye > rect.ye) {
+      ye = rect.ye;
+    }
+    // bank not sent by DMA
+    buffer = GRAM_Bank (lcd);
+    // read, blend and write back, next read waits for this write
+    if (GRAM_Read (lcd, rect.xs, rect.xe, y, ye, buffer, stats) == ST7735_ERROR) {
+      return ST7735_ERROR;
+    }
+    GRAM_Blend_Line (buffer, width * (ye - y + 1), color, weight);
+    GRAM_Write (lcd, rect.xs, rect.xe, y, ye, buffer, stats);
+  }
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Save area into buffer of 2 bytes per pixel, area has to lie on screen
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area
+ * @param   uint8_t * buffer
+ * @param   GRAM_Stats * traffic, NULL - not counted
+ *
+ * @return  uint8_t
+ */
+uint8_t GRAM_Save (ST7735_Display *lcd, const ST7735_Rect *area, uint8_t *buffer, GRAM_Stats *stats)
+{
+  // outside of screen
+  if (GRAM_Check (lcd, area) == ST7735_ERROR) {
+    return ST7735_ERROR;
+  }
+  // whole area in one read
+  return GRAM_Read (lcd, area->xs, area->xe, area->ys, area->ye, buffer, stats);
+}
+
+/**
+ * @desc    Restore area saved by GRAM_Save, sent in background
+ *          Buffer has to stay unchanged till next drawing call waits for it
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area
+ * @param   const uint8_t * buffer
+ * @param   GRAM_Stats * traffic, NULL - not counted
+ *
+ * @return  uint8_t
+ */
+uint8_t GRAM_Restore (ST7735_Display *lcd, const ST7735_Rect *area, const uint8_t *buffer, GRAM_Stats *stats)
+{
+  // outside of screen
+  if (GRAM_Check (lcd, area) == ST7735_ERROR) {
+    return ST7735_ERROR;
+  }
+  // whole area in one burst
+  return GRAM_Write (lcd, area->xs, area->xe, area->ys, area->ye, buffer, stats);
+}
+
+/**
+ * @desc    Copy area to new position, areas may overlap, both have to lie on screen
+ *          Chunks go against direction of move, so no row is read after it was overwritten
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * source area
+ * @param   uint8_t x of destination
+ * @param   uint8_t y of destination
+ * @param   GRAM_Stats * traffic, NULL - not counted
+ *
+ * @return  uint8_t
+ */
+uint8_t GRAM_Copy (ST7735_Display *lcd, const ST7735_Rect *area, uint8_t x, uint8_t y, GRAM_Stats *stats)
+{
+  // variables
+  ST7735_Rect target = { x, x + area->xe - area->xs, y, y + area->ye - area->ys };
+  uint8_t *buffer;
+  uint8_t width;
+  uint8_t rows;
+  uint8_t count;
+  int16_t offset = y - area->ys;
+  int16_t done = 0;
+  int16_t height;
+  int16_t ys;
+
+  // outside of screen
+  if ((GRAM_Check (lcd, area) == ST7735_ERROR) || (GRAM_Check (lcd, &target) == ST7735_ERROR)) {
+    return ST7735_ERROR;
+  }
+  // rows fitting one bank
+  width = area->xe - area->xs + 1;
+  rows = LINE_BUFFER_SIZE / (width << 1);
+  height = area->ye - area->ys + 1;
+
+  // loop through chunks of rows
+  while (done < height) {
+    // rows of chunk
+    count = ((height - done) < rows) ? (height - done) : rows;
+    // move down - from bottom, otherwise from top
+    ys = (offset > 0) ? (area->ye - done - count + 1) : (area->ys + done);
+    // bank not sent by DMA
+    buffer = GRAM_Bank (lcd);
+    // read source, write destination
+    GRAM_Read (lcd, area->xs, area->xe, ys, ys + count - 1, buffer, stats);
+    GRAM_Write (lcd, target.xs, target.xe, ys + offset, ys + offset + count - 1, buffer, stats);
+    // next chunk
+    done += count;
+  }
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Read area row by row into sink, NULL - whole screen
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area / NULL
+ * @param   GRAM_Sink consumer of rows
+ * @param   void * context of sink
+ * @param   GRAM_Stats * traffic, NULL - not counted
+ *
+ * @return  uint8_t
+ */
+uint8_t GRAM_Screenshot (ST7735_Display *lcd, const ST7735_Rect *area, GRAM_Sink sink, void *context, GRAM_Stats *stats)
+{
+  // variables
+  ST7735_Rect rect = { 0, lcd->width - 1, 0, lcd->height - 1 };
+  uint8_t *buffer;
+  uint8_t width;
+  uint8_t rows;
+  int16_t y;
+  int16_t ye;
+  int16_t row;
+
+  // part of screen
+  if (area != NULL) {
+    rect = *area;
+  }
+  // outside of screen
+  if (GRAM_Check (lcd, &rect) == ST7735_ERROR) {
+    return ST7735_ERROR;
+  }
+  // rows fitting one bank
+  width = rect.xe - rect.xs + 1;
+  rows = LINE_BUFFER_SIZE / (width << 1);
+
+  // loop through chunks of rows
+  for (y = rect.ys; y <= rect.ye; y += rows) {
+    // last chunk
+    ye = y + rows - 1;
+    if (ye > rect.ye) {
+      ye = rect.ye;
+    }
+    // whole bank is free after read - no DMA in flight
+    buffer = lcd->buffer[0];
+    GRAM_Read (lcd, rect.xs, rect.xe, y, ye, buffer, stats);
+    // rows to sink
+    for (row = y; row <= ye; row++) {
+      sink (context, buffer, row, rect.xs, width);
+      buffer += width << 1;
+    }
+  }
+
+  // success
+  return ST7735_SUCCESS;
+}
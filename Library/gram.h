@@ -0,0 +1,118 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        GRAM readback Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        gram.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Read-modify-write of panel memory without framebuffer - window of GRAM is read
+ *              by RAMRD into free bank of line buffer, modified and written back in same window.
+ *              Alpha blended overlays, save / restore of area under sprite, copy of area and
+ *              screenshot row by row.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      http://www.displayfuture.com/Display/datasheet/controller/ST7735.pdf
+ */
+
+#ifndef __GRAM_H__
+#define __GRAM_H__
+
+  #include "st7735.h"
+
+  // Alpha
+  // -----------------------------------
+  #define GRAM_OPAQUE           255               // overlay only
+  #define GRAM_TRANSPARENT      0                 // content only
+
+  /**
+   * @desc    Consumer of one row read from GRAM - RGB565 MSB first
+   *
+   * @param   void * context
+   * @param   const uint8_t * line
+   * @param   uint8_t y row
+   * @param   uint8_t x start column
+   * @param   uint8_t width in pixels
+   */
+  typedef void (*GRAM_Sink) (void *, const uint8_t *, uint8_t, uint8_t, uint8_t);
+
+  /** @struct Traffic */
+  typedef struct {
+    // pixels read
+    uint32_t read;
+    // pixels written
+    uint32_t written;
+    // bytes on bus - headers, dummy bytes and pixels
+    uint32_t bytes;
+  } GRAM_Stats;
+
+  /**
+   * @desc    Blend color over area, clipped by clip rectangle
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * area
+   * @param   uint16_t color
+   * @param   uint8_t alpha, GRAM_TRANSPARENT ... GRAM_OPAQUE
+   * @param   GRAM_Stats * traffic, NULL - not counted
+   *
+   * @return  uint8_t
+   */
+  uint8_t GRAM_Blend (ST7735_Display *, const ST7735_Rect *, uint16_t, uint8_t, GRAM_Stats *);
+
+  /**
+   * @desc    Save area into buffer of 2 bytes per pixel, area has to lie on screen
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * area
+   * @param   uint8_t * buffer
+   * @param   GRAM_Stats * traffic, NULL - not counted
+   *
+   * @return  uint8_t
+   */
+  uint8_t GRAM_Save (ST7735_Display *, const ST7735_Rect *, uint8_t *, GRAM_Stats *);
+
+  /**
+   * @desc    Restore area saved by GRAM_Save, sent in background
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * area
+   * @param   const uint8_t * buffer
+   * @param   GRAM_Stats * traffic, NULL - not counted
+   *
+   * @return  uint8_t
+   */
+  uint8_t GRAM_Restore (ST7735_Display *, const ST7735_Rect *, const uint8_t *, GRAM_Stats *);
+
+  /**
+   * @desc    Copy area to new position, areas may overlap, both have to lie on screen
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * source area
+   * @param   uint8_t x of destination
+   * @param   uint8_t y of destination
+   * @param   GRAM_Stats * traffic, NULL - not counted
+   *
+   * @return  uint8_t
+   */
+  uint8_t GRAM_Copy (ST7735_Display *, const ST7735_Rect *, uint8_t, uint8_t, GRAM_Stats *);
+
+  /**
+   * @desc    Read area row by row into sink, NULL - whole screen
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * area / NULL
+   * @param   GRAM_Sink consumer of rows
+   * @param   void * context of sink
+   * @param   GRAM_Stats * traffic, NULL - not counted
+   *
+   * @return  uint8_t
+   */
+  uint8_t GRAM_Screenshot (ST7735_Display *, const ST7735_Rect *, GRAM_Sink, void *, GRAM_Stats *);
+
+#endif
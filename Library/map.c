@@ -0,0 +1,228 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Tilemap Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        map.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      map.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Full screen scenes of retro consoles without framebuffer - tile layer of 8 x 8
+ *              tiles in 4 bits per pixel with palette of 16 colors, scrolled with wrap around,
+ *              and list of sprites over it composed into one scanline at a time.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      https://www.nesdev.org/wiki/PPU_rendering
+ */
+
+/** @includes */
+#include "map.h"
+
+/**
+ * @desc    Rasterizer of scanline - row of tile layer, sprites over it
+ *
+ * @param   void * context - map
+ * @param   uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width in pixels
+ *
+ * @return  void
+ */
+static void MAP_Raster (void *context, uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+  // variables
+  MAP_Map *map = (MAP_Map *) context;
+  const uint16_t *palette = map->palette;
+  const uint8_t *cells;
+  const uint8_t *bits;
+  const uint8_t *bitmap;
+  MAP_Sprite *sprite;
+  uint16_t wx = (x + map->x) % MAP_WIDTH;
+  uint16_t wy = (y + map->y) % MAP_HEIGHT;
+  uint16_t color;
+  uint8_t *pixel = line;
+  uint8_t count = width;
+  uint8_t index;
+  uint8_t col;
+  uint8_t i;
+  int16_t xs;
+  int16_t xe;
+
+  // row of cells, row of pixels inside tiles
+  cells = map->cells[wy / MAP_TILE];
+  wy = (wy % MAP_TILE) * (MAP_TILE / 2);
+  col = wx / MAP_TILE;
+  i = wx % MAP_TILE;
+
+  // loop through tiles of scanline
+  while (count > 0) {
+    // 4 bytes of tile row
+    bits = map->tiles + cells[col] * MAP_TILE_BYTES + wy;
+    // loop through pixels of tile
+    for (; (i < MAP_TILE) && (count > 0); i++, count--) {
+      color = palette[(bits[i >> 1] >> ((i & 1) ? 0 : 4)) & 0x0F];
+      // MSB first
+      *pixel++ = (uint8_t) (color >> 8);
+      *pixel++ = (uint8_t) color;
+    }
+    // next tile, wrap around
+    i = 0;
+    if (++col == MAP_COLS) {
+      col = 0;
+    }
+  }
+
+  // sprites from bottom
+  for (index = 0; index < map->count; index++) {
+    sprite = map->sprites[index];
+    // not on row
+    if (!sprite->visible || (y < sprite->y) || (y >= sprite->y + sprite->height)) {
+      continue;
+    }
+    // columns of sprite on line
+    xs = (sprite->x > x) ? sprite->x : x;
+    xe = ((sprite->x + sprite->width) < (x + width)) ? (sprite->x + sprite->width) : (x + width);
+    bitmap = sprite->bitmap + (y - sprite->y) * ((sprite->width + 1) >> 1);
+    pixel = line + ((xs - x) << 1);
+    // loop through pixels, transparent skipped
+    for (; xs < xe; xs++, pixel += 2) {
+      i = xs - sprite->x;
+      i = (bitmap[i >> 1] >> ((i & 1) ? 0 : 4)) & 0x0F;
+      if (i != MAP_TRANSPARENT) {
+        // MSB first
+        pixel[0] = (uint8_t) (palette[i] >> 8);
+        pixel[1] = (uint8_t) palette[i];
+      }
+    }
+  }
+}
+
+/**
+ * @desc    Init map filled by tile 0, not scrolled, without sprites
+ *
+ * @param   MAP_Map * map
+ * @param   ST7735_Display * lcd
+ * @param   const uint8_t * tile set
+ * @param   const uint16_t * palette of 16 colors
+ *
+ * @return  void
+ */
+void MAP_Init (MAP_Map *map, ST7735_Display *lcd, const uint8_t *tiles, const uint16_t *palette)
+{
+  // variables
+  uint8_t col;
+  uint8_t row;
+
+  // display and graphics
+  map->lcd = lcd;
+  map->tiles = tiles;
+  map->palette = palette;
+  // tile 0 everywhere
+  for (row = 0; row < MAP_ROWS; row++) {
+    for (col = 0; col < MAP_COLS; col++) {
+      map->cells[row][col] = 0;
+    }
+  }
+  // not scrolled
+  map->x = 0;
+  map->y = 0;
+  // no sprite
+  map->count = 0;
+}
+
+/**
+ * @desc    Set tile of cell
+ *
+ * @param   MAP_Map * map
+ * @param   uint8_t column
+ * @param   uint8_t row
+ * @param   uint8_t tile index
+ *
+ * @return  uint8_t
+ */
+uint8_t MAP_SetTile (MAP_Map *map, uint8_t col, uint8_t row, uint8_t tile)
+{
+  // outside of map
+  if ((col >= MAP_COLS) || (row >= MAP_ROWS)) {
+    return ST7735_ERROR;
+  }
+  // cell
+  map->cells[row][col] = tile;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Scroll offsets, wrapped around map
+ *
+ * @param   MAP_Map * map
+ * @param   int16_t x
+ * @param   int16_t y
+ *
+ * @return  void
+ */
+void MAP_Scroll (MAP_Map *map, int16_t x, int16_t y)
+{
+  // negative offsets wrapped too
+  x %= MAP_WIDTH;
+  y %= MAP_HEIGHT;
+  map->x = (x < 0) ? (x + MAP_WIDTH) : x;
+  map->y = (y < 0) ? (y + MAP_HEIGHT) : y;
+}
+
+/**
+ * @desc    Add visible sprite on top of map
+ *
+ * @param   MAP_Map * map
+ * @param   MAP_Sprite * sprite
+ * @param   const uint8_t * bitmap
+ * @param   uint8_t width
+ * @param   uint8_t height
+ *
+ * @return  uint8_t
+ */
+uint8_t MAP_AddSprite (MAP_Map *map, MAP_Sprite *sprite, const uint8_t *bitmap, uint8_t width, uint8_t height)
+{
+  // list full
+  if (map->count >= MAP_SPRITES) {
+    return ST7735_ERROR;
+  }
+  // bitmap
+  sprite->bitmap = bitmap;
+  sprite->width = width;
+  sprite->height = height;
+  // visible at top left corner
+  sprite->x = 0;
+  sprite->y = 0;
+  sprite->visible = 1;
+  // on top
+  map->sprites[map->count++] = sprite;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Render frame of whole screen, sent in background
+ *          One window for frame, scanline rasterized while DMA sends previous one
+ *
+ * @param   MAP_Map * map
+ * @param   SCAN_Stats * timing / NULL
+ *
+ * @return  uint8_t
+ */
+uint8_t MAP_Render (MAP_Map *map, SCAN_Stats *stats)
+{
+  // variables
+  ST7735_Rect screen = { 0, map->lcd->width - 1, 0, map->lcd->height - 1 };
+
+  // scanline pipeline
+  return SCAN_Render (map->lcd, &screen, MAP_Raster, map, stats);
+}
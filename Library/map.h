@@ -0,0 +1,140 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Tilemap Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        map.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      scan.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Full screen scenes of retro consoles without framebuffer - tile layer of 8 x 8
+ *              tiles in 4 bits per pixel with palette of 16 colors, scrolled with wrap around,
+ *              and list of sprites over it composed into one scanline at a time. Scanlines
+ *              are streamed by scanline pipeline (SCAN_Render) - one window per frame, line
+ *              rasterized while DMA sends previous one.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      https://www.nesdev.org/wiki/PPU_rendering
+ */
+
+#ifndef __MAP_H__
+#define __MAP_H__
+
+  #include "scan.h"
+
+  // Tile layer
+  // -----------------------------------
+  #define MAP_TILE              8                 // pixels of tile side
+  #define MAP_TILE_BYTES        32                // 4 bits per pixel, left pixel in upper nibble
+  #ifndef MAP_COLS
+    #define MAP_COLS            20                // tiles of map width
+  #endif
+  #ifndef MAP_ROWS
+    #define MAP_ROWS            17                // tiles of map height
+  #endif
+  #define MAP_WIDTH             (MAP_COLS * MAP_TILE)  // pixels of map, scroll wraps around
+  #define MAP_HEIGHT            (MAP_ROWS * MAP_TILE)
+
+  // Sprites
+  // -----------------------------------
+  #ifndef MAP_SPRITES
+    #define MAP_SPRITES         8                 // max sprites of map
+  #endif
+  #define MAP_TRANSPARENT       0                 // color index not drawn by sprite
+
+  /** @struct Sprite over tile layer */
+  typedef struct {
+    // 4 bits per pixel, row by row, left pixel in upper nibble, rows start on byte
+    const uint8_t *bitmap;
+    // size
+    uint8_t width;
+    uint8_t height;
+    // screen position of top left corner, not scrolled with map
+    int16_t x;
+    int16_t y;
+    // drawn
+    uint8_t visible;
+  } MAP_Sprite;
+
+  /** @struct Tilemap */
+  typedef struct {
+    // display
+    ST7735_Display *lcd;
+    // tile set of MAP_TILE_BYTES per tile
+    const uint8_t *tiles;
+    // RGB565 palette of 16 colors shared by tiles and sprites
+    const uint16_t *palette;
+    // tile index of every cell, row by row
+    uint8_t cells[MAP_ROWS][MAP_COLS];
+    // scroll offsets - map pixel at top left corner of screen
+    uint16_t x;
+    uint16_t y;
+    // sprites, last on top
+    MAP_Sprite *sprites[MAP_SPRITES];
+    uint8_t count;
+  } MAP_Map;
+
+  /**
+   * @desc    Init map filled by tile 0, not scrolled, without sprites
+   *
+   * @param   MAP_Map * map
+   * @param   ST7735_Display * lcd
+   * @param   const uint8_t * tile set
+   * @param   const uint16_t * palette of 16 colors
+   *
+   * @return  void
+   */
+  void MAP_Init (MAP_Map *, ST7735_Display *, const uint8_t *, const uint16_t *);
+
+  /**
+   * @desc    Set tile of cell
+   *
+   * @param   MAP_Map * map
+   * @param   uint8_t column
+   * @param   uint8_t row
+   * @param   uint8_t tile index
+   *
+   * @return  uint8_t
+   */
+  uint8_t MAP_SetTile (MAP_Map *, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Scroll offsets, wrapped around map
+   *
+   * @param   MAP_Map * map
+   * @param   int16_t x
+   * @param   int16_t y
+   *
+   * @return  void
+   */
+  void MAP_Scroll (MAP_Map *, int16_t, int16_t);
+
+  /**
+   * @desc    Add visible sprite on top of map
+   *
+   * @param   MAP_Map * map
+   * @param   MAP_Sprite * sprite
+   * @param   const uint8_t * bitmap
+   * @param   uint8_t width
+   * @param   uint8_t height
+   *
+   * @return  uint8_t
+   */
+  uint8_t MAP_AddSprite (MAP_Map *, MAP_Sprite *, const uint8_t *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Render frame of whole screen, sent in background
+   *
+   * @param   MAP_Map * map
+   * @param   SCAN_Stats * timing / NULL
+   *
+   * @return  uint8_t
+   */
+  uint8_t MAP_Render (MAP_Map *, SCAN_Stats *);
+
+#endif
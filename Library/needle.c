@@ -0,0 +1,375 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Gauge needle Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        needle.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      needle.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Needle is quadrilateral from pivot (full width) to tip (one pixel wide, so thin
+ *              tip has no gaps), vertices in 1/16 of pixel by Q15 sine table. Pixel center
+ *              inside all four edges belongs to needle, part of row is one interval got by
+ *              integer division. Row by row, old span minus new span is restored, new span
+ *              minus old span is painted - at most two spans of each kind per row.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "needle.h"
+
+/** @struct Polygon of needle, vertices relative to pivot in 1/16 of pixel */
+typedef struct {
+  int32_t x[4];
+  int32_t y[4];
+} NEEDLE_Shape;
+
+/**
+ * @desc    Division rounded towards minus infinity
+ *
+ * @param   int32_t numerator
+ * @param   int32_t denominator > 0
+ *
+ * @return  int32_t
+ */
+static int32_t NEEDLE_Floor (int32_t n, int32_t d)
+{
+  // C division rounds towards zero
+  return (n >= 0) ? (n / d) : -((-n + d - 1) / d);
+}
+
+/**
+ * @desc    Polygon of needle at angle - base at pivot, tip at length
+ *
+ * @param   NEEDLE_Needle * needle
+ * @param   uint16_t angle
+ * @param   NEEDLE_Shape * shape
+ *
+ * @return  void
+ */
+static void NEEDLE_Polygon (NEEDLE_Needle *needle, uint16_t angle, NEEDLE_Shape *shape)
+{
+  // variables
+  int32_t s = ARC_Sin (angle);
+  int32_t c = ARC_Cos (angle);
+  int32_t length = (int32_t) needle->length * NEEDLE_SUBPIXEL;
+  int32_t half = (int32_t) needle->width * (NEEDLE_SUBPIXEL / 2);
+  int32_t tip = NEEDLE_SUBPIXEL / 2;
+  // tip along direction (sin, -cos)
+  int32_t dx = (length * s) / 32768;
+  int32_t dy = -(length * c) / 32768;
+  // half widths along normal (cos, sin)
+  int32_t bx = (half * c) / 32768;
+  int32_t by = (half * s) / 32768;
+  int32_t tx = (tip * c) / 32768;
+  int32_t ty = (tip * s) / 32768;
+
+  // base, same order for every angle
+  shape->x[0] = -bx;
+  shape->y[0] = -by;
+  shape->x[1] = bx;
+  shape->y[1] = by;
+  // tip
+  shape->x[2] = dx + tx;
+  shape->y[2] = dy + ty;
+  shape->x[3] = dx - tx;
+  shape->y[3] = dy - ty;
+}
+
+/**
+ * @desc    Span of needle in row, relative to pivot
+ *
+ * @param   NEEDLE_Shape * shape
+ * @param   int16_t row relative to pivot
+ * @param   int16_t * xs
+ * @param   int16_t * xe
+ *
+ * @return  void
+ */
+static void NEEDLE_Row (NEEDLE_Shape *shape, int16_t row, int16_t *xs, int16_t *xe)
+{
+  // variables
+  int32_t y = (int32_t) row * NEEDLE_SUBPIXEL;
+  int32_t lo = -32768;
+  int32_t hi = 32767;
+  int32_t ex, ey, a, b, bound;
+  uint8_t i, j;
+
+  // inside of every edge, ey * (x - vx) - ex * (y - vy) >= 0
+  for (i = 0; i < 4; i++) {
+    j = (i + 1) & 3;
+    ex = shape->x[j] - shape->x[i];
+    ey = shape->y[j] - shape->y[i];
+    a = ey * NEEDLE_SUBPIXEL;
+    b = -ey * shape->x[i] - ex * (y - shape->y[i]);
+    // x >= ceil (-b / a)
+    if (a > 0) {
+      bound = -NEEDLE_Floor (b, a);
+      if (bound > lo) lo = bound;
+    // x <= floor (b / -a)
+    } else if (a < 0) {
+      bound = NEEDLE_Floor (b, -a);
+      if (bound < hi) hi = bound;
+    // edge along row - whole row or nothing
+    } else if (b < 0) {
+      lo = 1;
+      hi = 0;
+    }
+  }
+  // span
+  *xs = (lo > hi) ? 1 : (int16_t) lo;
+  *xe = (lo > hi) ? 0 : (int16_t) hi;
+}
+
+/**
+ * @desc    Send span of row - restored dial face or painted needle, counts traffic
+ *
+ * @param   NEEDLE_Needle * needle
+ * @param   int16_t y
+ * @param   int16_t x start
+ * @param   int16_t x end
+ * @param   uint8_t 1 - restore, 0 - paint
+ *
+ * @return  void
+ */
+static void NEEDLE_Span (NEEDLE_Needle *needle, int16_t y, int16_t xs, int16_t xe, uint8_t restore)
+{
+  // variables
+  ST7735_Display *lcd = needle->lcd;
+  ST7735_Rect rect = { xs, xe, y, y };
+  uint32_t bytes = lcd->bytes;
+
+  // empty or invisible
+  if ((xs > xe) || (ST7735_Clip_Rect (lcd, &rect) == ST7735_ERROR)) {
+    return;
+  }
+  // dial face from rasterizer
+  if (restore && (needle->face != NULL)) {
+    SCAN_Render (lcd, &rect, needle->face, needle->context, NULL);
+  // solid background / needle by DMA
+  } else {
+    ST7735_FillRect (lcd, rect.xs, rect.xe, rect.ys, rect.ye, restore ? needle->background : needle->color);
+  }
+  // traffic, CASET and RASET skipped by cache of window
+  needle->stats.bytes += lcd->bytes - bytes;
+  needle->stats.pixels += rect.xe - rect.xs + 1;
+  needle->stats.spans++;
+}
+
+/**
+ * @desc    Move needle to angle of current value
+ *
+ * @param   NEEDLE_Needle * needle
+ * @param   uint8_t 1 - old spans on display, 0 - dial face under them redrawn
+ *
+ * @return  void
+ */
+static void NEEDLE_Move (NEEDLE_Needle *needle, uint8_t shown)
+{
+  // variables
+  ST7735_Display *lcd = needle->lcd;
+  NEEDLE_Shape shape;
+  uint16_t angle = needle->start + (uint16_t) (((uint32_t) needle->sweep * needle->value) / needle->max);
+  int32_t top, bottom, from, to;
+  int16_t ns, ne, os, oe;
+  int16_t y;
+  uint8_t i;
+
+  // new polygon and its rows on screen
+  NEEDLE_Polygon (needle, angle, &shape);
+  top = bottom = shape.y[0];
+  for (i = 1; i < 4; i++) {
+    if (shape.y[i] < top) top = shape.y[i];
+    if (shape.y[i] > bottom) bottom = shape.y[i];
+  }
+  top = needle->y - NEEDLE_Floor (-top, NEEDLE_SUBPIXEL);
+  bottom = needle->y + NEEDLE_Floor (bottom, NEEDLE_SUBPIXEL);
+  if (top < 0) top = 0;
+  if (bottom > (lcd->height - 1)) bottom = lcd->height - 1;
+  // rows of old and new needle
+  from = top;
+  to = bottom;
+  if (shown && (needle->top <= needle->bottom)) {
+    if (needle->top < from) from = needle->top;
+    if (needle->bottom > to) to = needle->bottom;
+  }
+  // loop through rows
+  for (y = from; y <= to; y++) {
+    // new span, columns of screen
+    ns = 1;
+    ne = 0;
+    if ((y >= top) && (y <= bottom)) {
+      NEEDLE_Row (&shape, y - needle->y, &ns, &ne);
+      ns += needle->x;
+      ne += needle->x;
+      if (ns < 0) ns = 0;
+      if (ne > (lcd->width - 1)) ne = lcd->width - 1;
+    }
+    // old span
+    os = 1;
+    oe = 0;
+    if (shown && (y >= needle->top) && (y <= needle->bottom)) {
+      os = needle->xs[y];
+      oe = needle->xe[y];
+    }
+    // nothing of row painted
+    if (os > oe) {
+      NEEDLE_Span (needle, y, ns, ne, 0);
+    // nothing of row left
+    } else if (ns > ne) {
+      NEEDLE_Span (needle, y, os, oe, 1);
+    // old minus new restored, new minus old painted
+    } else {
+      NEEDLE_Span (needle, y, os, (oe < ns - 1) ? oe : ns - 1, 1);
+      NEEDLE_Span (needle, y, (os > ne + 1) ? os : ne + 1, oe, 1);
+      NEEDLE_Span (needle, y, ns, (ne < os - 1) ? ne : os - 1, 0);
+      NEEDLE_Span (needle, y, (ns > oe + 1) ? ns : oe + 1, ne, 0);
+    }
+    // span list, empty row 1 > 0
+    needle->xs[y] = (ns > ne) ? 1 : (uint8_t) ns;
+    needle->xe[y] = (ns > ne) ? 0 : (uint8_t) ne;
+  }
+  // rows of needle, none if top > bottom
+  needle->top = (top > bottom) ? 1 : (uint8_t) top;
+  needle->bottom = (top > bottom) ? 0 : (uint8_t) bottom;
+}
+
+/**
+ * @desc    Init needle of full turn from 12 o'clock on solid background
+ *          Nothing drawn till first set / draw
+ *
+ * @param   NEEDLE_Needle * needle
+ * @param   ST7735_Display * lcd
+ * @param   int16_t x of pivot
+ * @param   int16_t y of pivot
+ * @param   uint8_t length
+ * @param   uint8_t width at pivot
+ * @param   uint16_t max value
+ * @param   uint16_t color
+ * @param   uint16_t background
+ *
+ * @return  uint8_t
+ */
+uint8_t NEEDLE_Init (NEEDLE_Needle *needle, ST7735_Display *lcd, int16_t x, int16_t y, uint8_t length, uint8_t width, uint16_t max, uint16_t color, uint16_t background)
+{
+  // check arguments
+  if ((length == 0) || (max == 0)) {
+    // invalid
+    return ST7735_ERROR;
+  }
+  // needle
+  needle->lcd = lcd;
+  needle->x = x;
+  needle->y = y;
+  needle->length = length;
+  needle->width = width;
+  needle->max = max;
+  needle->color = color;
+  needle->background = background;
+  // full turn from 12 o'clock, solid background
+  needle->start = 0;
+  needle->sweep = ARC_FULL;
+  needle->face = NULL;
+  needle->context = NULL;
+  // zero, not drawn, no spans
+  needle->value = 0;
+  needle->drawn = 0;
+  needle->top = 1;
+  needle->bottom = 0;
+  // no traffic
+  needle->stats.updates = 0;
+  needle->stats.spans = 0;
+  needle->stats.pixels = 0;
+  needle->stats.bytes = 0;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Angle of zero value and angle of full scale, ARC_FULL units of turn
+ *          Drawn needle moves on next set
+ *
+ * @param   NEEDLE_Needle * needle
+ * @param   uint16_t start angle
+ * @param   uint16_t sweep, 1 ... ARC_FULL
+ *
+ * @return  uint8_t
+ */
+uint8_t NEEDLE_SetSweep (NEEDLE_Needle *needle, uint16_t start, uint16_t sweep)
+{
+  // within one turn
+  if ((sweep == 0) || (sweep > ARC_FULL)) {
+    // invalid
+    return ST7735_ERROR;
+  }
+  // sweep
+  needle->start = start & (ARC_FULL - 1);
+  needle->sweep = sweep;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Rasterizer of dial face restoring pixels under needle, NULL - solid background
+ *
+ * @param   NEEDLE_Needle * needle
+ * @param   SCAN_Raster rasterizer
+ * @param   void * context of rasterizer
+ *
+ * @return  void
+ */
+void NEEDLE_SetFace (NEEDLE_Needle *needle, SCAN_Raster face, void *context)
+{
+  // generator of static dial
+  needle->face = face;
+  needle->context = context;
+}
+
+/**
+ * @desc    Draw whole needle with current value, dial face assumed freshly drawn
+ *
+ * @param   NEEDLE_Needle * needle
+ *
+ * @return  void
+ */
+void NEEDLE_Draw (NEEDLE_Needle *needle)
+{
+  // old spans not on display
+  NEEDLE_Move (needle, 0);
+  // drawn
+  needle->drawn = 1;
+}
+
+/**
+ * @desc    Set value, restores pixels left by old needle and paints new ones
+ *
+ * @param   NEEDLE_Needle * needle
+ * @param   uint16_t value, saturated to max
+ *
+ * @return  void
+ */
+void NEEDLE_Set (NEEDLE_Needle *needle, uint16_t value)
+{
+  // saturate
+  if (value > needle->max) {
+    value = needle->max;
+  }
+  needle->value = value;
+  needle->stats.updates++;
+  // first time whole needle
+  if (!needle->drawn) {
+    NEEDLE_Draw (needle);
+    return;
+  }
+  // only difference
+  NEEDLE_Move (needle, 1);
+}
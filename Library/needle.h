@@ -0,0 +1,140 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Gauge needle Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        needle.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      arc.h, scan.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Needle of analog dial without redraw of dial. Needle is convex polygon kept as
+ *              list of spans of screen rows. Move of needle restores only pixels of old spans
+ *              not covered by new needle - from rasterizer of static dial face (SCAN_Raster)
+ *              or by solid background - and paints only pixels of new spans not painted yet.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __NEEDLE_H__
+#define __NEEDLE_H__
+
+  #include "arc.h"
+  #include "scan.h"
+
+  // Needle definition
+  // -----------------------------------
+  #define NEEDLE_ROWS           MAX_X             // spans, one for every row of any rotation
+  #define NEEDLE_SUBPIXEL       16                // vertices in 1/16 of pixel
+
+  /** @struct Traffic since init */
+  typedef struct {
+    // calls of NEEDLE_Set
+    uint32_t updates;
+    // sent spans - restored and painted
+    uint32_t spans;
+    // sent pixels
+    uint32_t pixels;
+    // bytes on bus - headers and pixels
+    uint32_t bytes;
+  } NEEDLE_Stats;
+
+  /** @struct Needle */
+  typedef struct {
+    // display
+    ST7735_Display *lcd;
+    // pivot, may lie off screen
+    int16_t x;
+    int16_t y;
+    // pixels from pivot to tip, width at pivot
+    uint8_t length;
+    uint8_t width;
+    // angle of zero value and angle of full scale
+    uint16_t start;
+    uint16_t sweep;
+    // value of full scale
+    uint16_t max;
+    // colors
+    uint16_t color;
+    uint16_t background;
+    // rasterizer of dial face under needle, NULL - solid background
+    SCAN_Raster face;
+    void *context;
+    // current value
+    uint16_t value;
+    // drawn on display, otherwise next set draws whole needle
+    uint8_t drawn;
+    // spans of drawn needle, empty row xs > xe
+    uint8_t top;
+    uint8_t bottom;
+    uint8_t xs[NEEDLE_ROWS];
+    uint8_t xe[NEEDLE_ROWS];
+    // traffic
+    NEEDLE_Stats stats;
+  } NEEDLE_Needle;
+
+  /**
+   * @desc    Init needle of full turn from 12 o'clock on solid background
+   *          Nothing drawn till first set / draw
+   *
+   * @param   NEEDLE_Needle * needle
+   * @param   ST7735_Display * lcd
+   * @param   int16_t x of pivot
+   * @param   int16_t y of pivot
+   * @param   uint8_t length
+   * @param   uint8_t width at pivot
+   * @param   uint16_t max value
+   * @param   uint16_t color
+   * @param   uint16_t background
+   *
+   * @return  uint8_t
+   */
+  uint8_t NEEDLE_Init (NEEDLE_Needle *, ST7735_Display *, int16_t, int16_t, uint8_t, uint8_t, uint16_t, uint16_t, uint16_t);
+
+  /**
+   * @desc    Angle of zero value and angle of full scale, ARC_FULL units of turn
+   *
+   * @param   NEEDLE_Needle * needle
+   * @param   uint16_t start angle
+   * @param   uint16_t sweep, 1 ... ARC_FULL
+   *
+   * @return  uint8_t
+   */
+  uint8_t NEEDLE_SetSweep (NEEDLE_Needle *, uint16_t, uint16_t);
+
+  /**
+   * @desc    Rasterizer of dial face restoring pixels under needle, NULL - solid background
+   *
+   * @param   NEEDLE_Needle * needle
+   * @param   SCAN_Raster rasterizer
+   * @param   void * context of rasterizer
+   *
+   * @return  void
+   */
+  void NEEDLE_SetFace (NEEDLE_Needle *, SCAN_Raster, void *);
+
+  /**
+   * @desc    Draw whole needle with current value, dial face assumed freshly drawn
+   *
+   * @param   NEEDLE_Needle * needle
+   *
+   * @return  void
+   */
+  void NEEDLE_Draw (NEEDLE_Needle *);
+
+  /**
+   * @desc    Set value, restores pixels left by old needle and paints new ones
+   *
+   * @param   NEEDLE_Needle * needle
+   * @param   uint16_t value, saturated to max
+   *
+   * @return  void
+   */
+  void NEEDLE_Set (NEEDLE_Needle *, uint16_t);
+
+#endif
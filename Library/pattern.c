@@ -0,0 +1,351 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Pattern fill Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        pattern.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      pattern.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Gradient and pattern fills computed on the fly - pixels are generated into line
+ *              buffer and whole rectangle is streamed in one window by scanline pipeline,
+ *              no framebuffer needed. Checkerboard, stripes and tiles are anchored to screen,
+ *              redraw of part of background joins seamlessly.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      https://en.wikipedia.org/wiki/Ordered_dithering
+ */
+
+/** @includes */
+#include "pattern.h"
+
+/** @const Bayer matrix 4x4, thresholds in 1/16 of LSB */
+static const uint8_t patternBayer[4][4] = {
+  {  0,  8,  2, 10 },
+  { 12,  4, 14,  6 },
+  {  3, 11,  1,  9 },
+  { 15,  7, 13,  5 }
+};
+
+/** @const Max value of channel R, G, B */
+static const int32_t patternMax[3] = { 0x1F, 0x3F, 0x1F };
+
+/** @struct Parameters of pattern for rasterizer */
+typedef struct {
+  // area
+  const ST7735_Rect *area;
+  // colors
+  uint16_t color[2];
+  // size of cell / width of stripe
+  uint8_t size;
+  // direction
+  uint8_t direction;
+  // tile 8x8
+  const uint8_t *tile;
+  // gradient - channels R, G, B at start, fixed point 20.12
+  int32_t start[3];
+  // gradient - step of channels per pixel
+  int32_t step[3];
+} PATTERN_Context;
+
+/**
+ * @desc    Store pixel RGB565 MSB first
+ *
+ * @param   uint8_t * line
+ * @param   uint16_t color
+ *
+ * @return  uint8_t *
+ */
+static inline uint8_t * PATTERN_Put (uint8_t *line, uint16_t color)
+{
+  // MSB first
+  *line++ = (uint8_t) (color >> 8);
+  *line++ = (uint8_t) color;
+  // next pixel
+  return line;
+}
+
+/**
+ * @desc    Rasterizer of gradient
+ *
+ * @param   void * context
+ * @param   uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width
+ *
+ * @return  void
+ */
+static void PATTERN_Gradient_Raster (void *context, uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+  // variables
+  PATTERN_Context *pattern = (PATTERN_Context *) context;
+  const uint8_t *bayer = patternBayer[y & 3];
+  int32_t value[3];
+  int32_t step[3];
+  int32_t channel[3];
+  int32_t threshold;
+  uint8_t i;
+
+  // channels at start of line
+  for (i = 0; i < 3; i++) {
+    // vertical - constant in line
+    if (pattern->direction == PATTERN_VERTICAL) {
+      value[i] = pattern->start[i] + pattern->step[i] * (y - pattern->area->ys);
+      step[i] = 0;
+    // horizontal - line may start right of area edge if clipped
+    } else {
+      value[i] = pattern->start[i] + pattern->step[i] * (x - pattern->area->xs);
+      step[i] = pattern->step[i];
+    }
+  }
+  // loop through columns
+  while (width--) {
+    // dithering threshold in the middle of step
+    threshold = (bayer[x & 3] << 8) + 0x80;
+    // round channels by threshold
+    for (i = 0; i < 3; i++) {
+      channel[i] = (value[i] + threshold) >> 12;
+      if (channel[i] > patternMax[i]) {
+        channel[i] = patternMax[i];
+      }
+      value[i] += step[i];
+    }
+    // RGB565
+    line = PATTERN_Put (line, (channel[0] << 11) | (channel[1] << 5) | channel[2]);
+    x++;
+  }
+}
+
+/**
+ * @desc    Rasterizer of checkerboard
+ *
+ * @param   void * context
+ * @param   uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width
+ *
+ * @return  void
+ */
+static void PATTERN_Checker_Raster (void *context, uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+  // variables
+  PATTERN_Context *pattern = (PATTERN_Context *) context;
+  uint8_t column = x % pattern->size;
+  uint8_t cell = ((x / pattern->size) + (y / pattern->size)) & 1;
+
+  // loop through columns
+  while (width--) {
+    // color of cell
+    line = PATTERN_Put (line, pattern->color[cell]);
+    // next cell
+    if (++column == pattern->size) {
+      column = 0;
+      cell ^= 1;
+    }
+  }
+}
+
+/**
+ * @desc    Rasterizer of stripes
+ *
+ * @param   void * context
+ * @param   uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width
+ *
+ * @return  void
+ */
+static void PATTERN_Stripes_Raster (void *context, uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+  // variables
+  PATTERN_Context *pattern = (PATTERN_Context *) context;
+  uint16_t period = pattern->size << 1;
+  uint16_t phase = 0;
+  uint8_t step = 1;
+
+  // position in period
+  if (pattern->direction == PATTERN_VERTICAL) {
+    // constant in line
+    phase = y;
+    step = 0;
+  } else if (pattern->direction == PATTERN_DIAGONAL) {
+    // shifted by row
+    phase = x + y;
+  } else {
+    // by column only
+    phase = x;
+  }
+  phase %= period;
+
+  // loop through columns
+  while (width--) {
+    // first half of period is first color
+    line = PATTERN_Put (line, pattern->color[phase >= pattern->size]);
+    // next position
+    phase += step;
+    if (phase == period) {
+      phase = 0;
+    }
+  }
+}
+
+/**
+ * @desc    Rasterizer of tile 8x8
+ *
+ * @param   void * context
+ * @param   uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width
+ *
+ * @return  void
+ */
+static void PATTERN_Tile_Raster (void *context, uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+  // variables
+  PATTERN_Context *pattern = (PATTERN_Context *) context;
+  uint8_t bits = pattern->tile[y & 7];
+  uint8_t mask = 0x80 >> (x & 7);
+
+  // loop through columns
+  while (width--) {
+    // set bit - first color
+    line = PATTERN_Put (line, pattern->color[(bits & mask) ? 0 : 1]);
+    // next bit, repeated tile
+    mask >>= 1;
+    if (mask == 0) {
+      mask = 0x80;
+    }
+  }
+}
+
+/**
+ * @desc    Linear gradient RGB565 with ordered 4x4 dithering
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area
+ * @param   uint16_t start color
+ * @param   uint16_t end color
+ * @param   uint8_t direction
+ *
+ * @return  uint8_t
+ */
+uint8_t PATTERN_Gradient (ST7735_Display *lcd, const ST7735_Rect *area, uint16_t start, uint16_t end, uint8_t direction)
+{
+  // variables
+  PATTERN_Context pattern;
+  int32_t first[3] = { start >> 11, (start >> 5) & 0x3F, start & 0x1F };
+  int32_t last[3] = { end >> 11, (end >> 5) & 0x3F, end & 0x1F };
+  int32_t length;
+  uint8_t i;
+
+  // only horizontal or vertical
+  if (direction > PATTERN_VERTICAL) {
+    return ST7735_ERROR;
+  }
+  // steps between first and last pixel
+  length = (direction == PATTERN_VERTICAL) ? (area->ye - area->ys) : (area->xe - area->xs);
+  // channels in fixed point
+  for (i = 0; i < 3; i++) {
+    pattern.start[i] = first[i] << 12;
+    pattern.step[i] = (length > 0) ? (((last[i] - first[i]) * 4096) / length) : 0;
+  }
+  pattern.area = area;
+  pattern.direction = direction;
+
+  // stream area
+  return SCAN_Render (lcd, area, PATTERN_Gradient_Raster, &pattern, NULL);
+}
+
+/**
+ * @desc    Checkerboard of square cells
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area
+ * @param   uint16_t first color
+ * @param   uint16_t second color
+ * @param   uint8_t size of cell
+ *
+ * @return  uint8_t
+ */
+uint8_t PATTERN_Checker (ST7735_Display *lcd, const ST7735_Rect *area, uint16_t first, uint16_t second, uint8_t size)
+{
+  // variables
+  PATTERN_Context pattern;
+
+  // empty cell
+  if (size == 0) {
+    return ST7735_ERROR;
+  }
+  // parameters
+  pattern.color[0] = first;
+  pattern.color[1] = second;
+  pattern.size = size;
+
+  // stream area
+  return SCAN_Render (lcd, area, PATTERN_Checker_Raster, &pattern, NULL);
+}
+
+/**
+ * @desc    Stripes of two colors
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area
+ * @param   uint16_t first color
+ * @param   uint16_t second color
+ * @param   uint8_t width of stripe
+ * @param   uint8_t direction
+ *
+ * @return  uint8_t
+ */
+uint8_t PATTERN_Stripes (ST7735_Display *lcd, const ST7735_Rect *area, uint16_t first, uint16_t second, uint8_t size, uint8_t direction)
+{
+  // variables
+  PATTERN_Context pattern;
+
+  // empty stripe or unknown direction
+  if ((size == 0) || (direction > PATTERN_DIAGONAL)) {
+    return ST7735_ERROR;
+  }
+  // parameters
+  pattern.color[0] = first;
+  pattern.color[1] = second;
+  pattern.size = size;
+  pattern.direction = direction;
+
+  // stream area
+  return SCAN_Render (lcd, area, PATTERN_Stripes_Raster, &pattern, NULL);
+}
+
+/**
+ * @desc    Tiled 8x8 pattern, 1 bit per pixel, MSB is left pixel
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area
+ * @param   const uint8_t * tile 8 rows
+ * @param   uint16_t color of set bits
+ * @param   uint16_t color of clear bits
+ *
+ * @return  uint8_t
+ */
+uint8_t PATTERN_Tile (ST7735_Display *lcd, const ST7735_Rect *area, const uint8_t *tile, uint16_t foreground, uint16_t background)
+{
+  // variables
+  PATTERN_Context pattern;
+
+  // parameters
+  pattern.tile = tile;
+  pattern.color[0] = foreground;
+  pattern.color[1] = background;
+
+  // stream area
+  return SCAN_Render (lcd, area, PATTERN_Tile_Raster, &pattern, NULL);
+}
@@ -0,0 +1,87 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Pattern fill Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        pattern.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      scan.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Gradient and pattern fills computed on the fly - pixels are generated into line
+ *              buffer and whole rectangle is streamed in one window by scanline pipeline,
+ *              no framebuffer needed.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __PATTERN_H__
+#define __PATTERN_H__
+
+  #include "scan.h"
+
+  // Direction of gradient / stripes
+  // -----------------------------------
+  #define PATTERN_HORIZONTAL    0                 // changes along x axis
+  #define PATTERN_VERTICAL      1                 // changes along y axis
+  #define PATTERN_DIAGONAL      2                 // changes along x + y (stripes only)
+
+  /**
+   * @desc    Linear gradient RGB565 with ordered 4x4 dithering
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * area
+   * @param   uint16_t start color
+   * @param   uint16_t end color
+   * @param   uint8_t direction
+   *
+   * @return  uint8_t
+   */
+  uint8_t PATTERN_Gradient (ST7735_Display *, const ST7735_Rect *, uint16_t, uint16_t, uint8_t);
+
+  /**
+   * @desc    Checkerboard of square cells
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * area
+   * @param   uint16_t first color
+   * @param   uint16_t second color
+   * @param   uint8_t size of cell
+   *
+   * @return  uint8_t
+   */
+  uint8_t PATTERN_Checker (ST7735_Display *, const ST7735_Rect *, uint16_t, uint16_t, uint8_t);
+
+  /**
+   * @desc    Stripes of two colors
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * area
+   * @param   uint16_t first color
+   * @param   uint16_t second color
+   * @param   uint8_t width of stripe
+   * @param   uint8_t direction
+   *
+   * @return  uint8_t
+   */
+  uint8_t PATTERN_Stripes (ST7735_Display *, const ST7735_Rect *, uint16_t, uint16_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Tiled 8x8 pattern, 1 bit per pixel, MSB is left pixel
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * area
+   * @param   const uint8_t * tile 8 rows
+   * @param   uint16_t color of set bits
+   * @param   uint16_t color of clear bits
+   *
+   * @return  uint8_t
+   */
+  uint8_t PATTERN_Tile (ST7735_Display *, const ST7735_Rect *, const uint8_t *, uint16_t, uint16_t);
+
+#endif
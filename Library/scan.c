@@ -0,0 +1,124 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Scanline pipeline Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        scan.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      scan.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Ping-pong line buffer pipeline for renderers without framebuffer - scanline
+ *              N + 1 is rasterized by CPU while DMA sends scanline N. Area is sent in one
+ *              window burst, timing of frame shows achieved overlap.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "scan.h"
+
+/** @var Cycle counter when DMA of last line finished */
+static volatile uint32_t scanDone;
+
+/**
+ * @desc    Transaction finished - timestamp from interrupt
+ *
+ * @param   SPIBUS_Transaction * transaction
+ *
+ * @return  void
+ */
+static void SCAN_Done (SPIBUS_Transaction *transaction)
+{
+  // time of completion
+  scanDone = SCAN_CYCLES ();
+}
+
+/**
+ * @desc    Rasterize and send area line by line, clipped by clip rectangle
+ *          Timing requested - waits for last line, otherwise it is sent in background
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * area
+ * @param   SCAN_Raster rasterizer
+ * @param   void * context of rasterizer
+ * @param   SCAN_Stats * timing / NULL
+ *
+ * @return  uint8_t
+ */
+uint8_t SCAN_Render (ST7735_Display *lcd, const ST7735_Rect *area, SCAN_Raster raster, void *context, SCAN_Stats *stats)
+{
+  // variables
+  SCAN_Stats time = { 0, 0, 0, 0 };
+  ST7735_Rect rect = *area;
+  uint8_t width;
+  uint8_t bank = 0;
+  uint8_t busy;
+  uint32_t start;
+  uint32_t begin;
+  uint32_t end;
+  int16_t y;
+
+  // visible part, fully clipped costs no SPI byte
+  if (ST7735_Clip_Rect (lcd, &rect) == ST7735_ERROR) {
+    return ST7735_SUCCESS;
+  }
+  // one window for whole area
+  if (ST7735_SetWindow (lcd, rect.xs, rect.xe, rect.ys, rect.ye) == ST7735_ERROR) {
+    // out of range
+    return ST7735_ERROR;
+  }
+  // visible columns
+  width = rect.xe - rect.xs + 1;
+  // start of frame
+  start = SCAN_CYCLES ();
+  // access to RAM, waits for previous burst
+  ST7735_Burst_Begin (lcd);
+  // timestamp of every finished line
+  if (stats != NULL) {
+    lcd->xfer.done = SCAN_Done;
+  }
+
+  // loop through rows
+  for (y = rect.ys; y <= rect.ye; y++) {
+    // start of rasterization
+    begin = SCAN_CYCLES ();
+    // previous line still sent
+    busy = (lcd->xfer.state != SPIBUS_DONE);
+    // rasterize into free bank
+    raster (context, lcd->buffer[bank], y, rect.xs, width);
+    // end of rasterization
+    end = SCAN_CYCLES ();
+    time.render += end - begin;
+    // rasterization hidden behind DMA
+    if (busy) {
+      time.overlap += (lcd->xfer.state != SPIBUS_DONE) ? (end - begin) : (scanDone - begin);
+    }
+    // wait for previous line and start this one
+    ST7735_Burst_Write (lcd, lcd->buffer[bank], width << 1);
+    time.wait += SCAN_CYCLES () - end;
+    // other bank
+    bank ^= 1;
+  }
+  // last line in background
+  ST7735_Burst_End (lcd);
+
+  // timing
+  if (stats != NULL) {
+    // last line
+    ST7735_Sync (lcd);
+    // callback off
+    lcd->xfer.done = NULL;
+    // whole frame
+    time.frame = SCAN_CYCLES () - start;
+    *stats = time;
+  }
+
+  // success
+  return ST7735_SUCCESS;
+}
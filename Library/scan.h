@@ -0,0 +1,70 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Scanline pipeline Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        scan.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Ping-pong line buffer pipeline for renderers without framebuffer - scanline
+ *              N + 1 is rasterized by CPU while DMA sends scanline N. Area is sent in one
+ *              window burst, timing of frame shows achieved overlap.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __SCAN_H__
+#define __SCAN_H__
+
+  #include "st7735.h"
+
+  // Cycle counter - DWT CYCCNT, enabled by application
+  // -----------------------------------
+  #ifndef SCAN_CYCLES
+    #define SCAN_CYCLES()       (*(volatile uint32_t *) 0xE0001004)
+  #endif
+
+  /**
+   * @desc    Rasterizer of one scanline - RGB565 MSB first into line
+   *
+   * @param   void * context
+   * @param   uint8_t * line
+   * @param   uint8_t y row
+   * @param   uint8_t x start column
+   * @param   uint8_t width in pixels
+   */
+  typedef void (*SCAN_Raster) (void *, uint8_t *, uint8_t, uint8_t, uint8_t);
+
+  /** @struct Timing of last frame in cycles */
+  typedef struct {
+    // whole frame
+    uint32_t frame;
+    // rasterization
+    uint32_t render;
+    // rasterization while DMA was sending previous line
+    uint32_t overlap;
+    // waiting for DMA
+    uint32_t wait;
+  } SCAN_Stats;
+
+  /**
+   * @desc    Rasterize and send area line by line, clipped by clip rectangle
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * area
+   * @param   SCAN_Raster rasterizer
+   * @param   void * context of rasterizer
+   * @param   SCAN_Stats * timing / NULL
+   *
+   * @return  uint8_t
+   */
+  uint8_t SCAN_Render (ST7735_Display *, const ST7735_Rect *, SCAN_Raster, void *, SCAN_Stats *);
+
+#endif
@@ -24,6 +24,10 @@
 #include <stm32f10x.h>
 #include "spi.h"
 
+#ifdef SPI_TRACE
+  #include "trace.h"
+#endif
+
 /**
  * @desc    Init MOSI, MISO, SCK, SS pins for SPIx
  *          Pin NSS is defined as GPIO, because SSM = 1, SSI = 1, SSOE = 0  
@@ -69,8 +73,27 @@ void SPI_Pins_Init (SPI_TypeDef *SPIx)
     // MOSI - GPIOA.7 - 2 MHz
     GPIOA->CRL |= GPIO_CRL_MODE4_1 | GPIO_CRL_MODE5_1 | GPIO_CRL_MODE7_1;
   // SPI2
+  // --------------------------------------------------------------------------------
   } else if (SPIx == SPI2) {
-  
+    // enable clock for corresponding GPIOB
+    RCC->APB2ENR |= RCC_APB2ENR_IOPBEN | RCC_APB2ENR_AFIOEN;
+    // enable clock for SPI2 (APB1)
+    RCC->APB1ENR |= RCC_APB1ENR_SPI2EN;
+
+    // null corresponding bits
+    GPIOB->CRH &= ~(GPIO_CRH_CNF12 | GPIO_CRH_CNF13 | GPIO_CRH_CNF14 | GPIO_CRH_CNF15);
+    GPIOB->CRH &= ~(GPIO_CRH_MODE12 | GPIO_CRH_MODE13 | GPIO_CRH_MODE14 | GPIO_CRH_MODE15);
+
+    // SS   - GPIOB.12 - GENERAL PURPOSE OUTPUT / PUSH PULL
+    // SCK  - GPIOB.13 - ALTERNATE FUNCTION OUTPUT / PUSH PULL
+    // MISO - GPIOB.14 - INPUT / PULL UP
+    // MOSI - GPIOB.15 - ALTERNATE FUNCTION OUTPUT / PUSH PULL
+    GPIOB->CRH |= GPIO_CRH_CNF13_1 | GPIO_CRH_CNF14_1 | GPIO_CRH_CNF15_1;
+    // SS   - GPIOB.12 - 2 MHz
+    // SCK  - GPIOB.13 - 2 MHz
+    // MISO - GPIOB.14
+    // MOSI - GPIOB.15 - 2 MHz
+    GPIOB->CRH |= GPIO_CRH_MODE12_1 | GPIO_CRH_MODE13_1 | GPIO_CRH_MODE15_1;
   }
 }
 
@@ -83,11 +106,11 @@ void SPI_Pins_Init (SPI_TypeDef *SPIx)
  */
 void SPI_Master_Init (SPI_TypeDef *SPIx)
 {
-  // SPI1
+  // SPI1 / SPI2
   // --------------------------------------------------------------------------------
-  if (SPIx == SPI1) {
+  if ((SPIx == SPI1) || (SPIx == SPI2)) {
   
-    // SPI1 init pins GPIO
+    // SPI init pins GPIO
     SPI_Pins_Init (SPIx);
 
     // SPI1_CR1 register
@@ -190,6 +213,11 @@ void SPI_Master_Init (SPI_TypeDef *SPIx)
     // ----------------------------------------------------------------------------------
     // set corresponding bits
     SPIx->CR1 = SPI_CR1_SSM | SPI_CR1_SSI | SPI_CR1_MSTR | SPI_CR1_BR_1;
+    // SPI2 clocked from APB1 (half of APB2)
+    // BR[2:0]:  001 - f PCLK/4 -> same SCK as SPI1
+    if (SPIx == SPI2) {
+      SPIx->CR1 = SPI_CR1_SSM | SPI_CR1_SSI | SPI_CR1_MSTR | SPI_CR1_BR_0;
+    }
 
     // Activate the SPI mode (Reset I2SMOD bit in I2SCFGR register)
     SPIx->I2SCFGR &= ~SPI_I2SCFGR_I2SMOD;
@@ -197,11 +225,20 @@ void SPI_Master_Init (SPI_TypeDef *SPIx)
     // pin NSS output disabled
     SPIx->CR2 &= ~SPI_CR2_SSOE;
 
-    // enable SPI1
-    SPI1->CR1 |= SPI_CR1_SPE;
+    // enable SPI
+    SPIx->CR1 |= SPI_CR1_SPE;
+
+#ifndef SPIBUS_NO_DMA
+    // DMA channel for transmit
+    SPI_DMA_Init (SPIx);
+#endif
 
     // high level
-    SPI_SS_High (SPI_SS_GPIO, SPI_SS_PIN);    
+    if (SPIx == SPI1) {
+      SPI_SS_High (SPI_SS_GPIO, SPI_SS_PIN);
+    } else {
+      SPI_SS_High (SPI2_SS_GPIO, SPI2_SS_PIN);
+    }
   }
 }
 
@@ -243,6 +280,10 @@ uint8_t SPI_SS_Low (GPIO_TypeDef *GPIOx, uint16_t pin)
  */
 uint8_t SPI_TRX_8b (SPI_TypeDef *SPIx, uint8_t data)
 {
+#ifdef SPI_TRACE
+  // capture
+  TRACE_Bytes (SPIx, &data, 1);
+#endif
   // fill SPI11 DATA REGISTER with data
   // this clear TXE flag
   SPIx->DR = data;
@@ -266,6 +307,11 @@ uint8_t SPI_TRX_8b (SPI_TypeDef *SPIx, uint8_t data)
 uint16_t SPI_TRX_16b (SPI_TypeDef *SPIx, uint16_t data)
 {
   uint16_t rxbuff = 0;
+#ifdef SPI_TRACE
+  // capture MSB first
+  uint8_t bytes[2] = { (uint8_t) (data >> 8), (uint8_t) data };
+  TRACE_Bytes (SPIx, bytes, 2);
+#endif
   // fill SPI11 DATA REGISTER with data
   // this clear TXE flag
   SPIx->DR = (uint8_t) (data >> 8);
@@ -290,6 +336,274 @@ uint16_t SPI_TRX_16b (SPI_TypeDef *SPIx, uint16_t data)
   // return data
   return rxbuff;
 }
+/**
+ * @desc    Polled transmit of block, received data not read
+ *          8 bit frame - items are bytes, 16 bit frame (DFF) - items are half words
+ *          Returns when last item loaded, SPI_Wait_Idle waits for shift register
+ *
+ * @param   SPI_TypeDef *SPIx
+ * @param   const void * buffer
+ * @param   uint16_t number of items
+ * @param   uint32_t flags - SPI_DMA_MINC or one item repeated
+ *
+ * @return  void
+ */
+void SPI_Transmit (SPI_TypeDef *SPIx, const void *buffer, uint16_t count, uint32_t flags)
+{
+  // variables
+  const uint8_t *byte = (const uint8_t *) buffer;
+  const uint16_t *half = (const uint16_t *) buffer;
+  uint16_t step = (flags & SPI_DMA_MINC) ? 1 : 0;
+  uint16_t i;
+
+#ifdef SPI_TRACE
+  // capture
+  TRACE_Block (SPIx, buffer, count, (SPIx->CR1 & SPI_CR1_DFF) ? 2 : 1, step);
+#endif
+  // loop through items
+  for (i = 0; i < count; i++) {
+    // 16 bit frame - half word, otherwise byte
+    SPIx->DR = (SPIx->CR1 & SPI_CR1_DFF) ? half[i * step] : byte[i * step];
+    // loaded into shift register
+    while (!(SPIx->SR & SPI_SR_TXE));
+  }
+}
+
+/**
+ * @desc    DMA channel of SPIx transmit
+ *          SPI1_TX - DMA1 Channel 3, SPI2_TX - DMA1 Channel 5
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  DMA_Channel_TypeDef *
+ */
+static DMA_Channel_TypeDef * SPI_DMA_Channel (SPI_TypeDef *SPIx)
+{
+  // SPI1
+  if (SPIx == SPI1) {
+    // channel 3
+    return DMA1_Channel3;
+  }
+  // SPI2 - channel 5
+  return DMA1_Channel5;
+}
+
+/**
+ * @desc    Transfer complete flag of SPIx transmit channel
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  uint32_t
+ */
+static uint32_t SPI_DMA_Flag (SPI_TypeDef *SPIx)
+{
+  // SPI1
+  if (SPIx == SPI1) {
+    // channel 3
+    return DMA_ISR_TCIF3;
+  }
+  // SPI2 - channel 5
+  return DMA_ISR_TCIF5;
+}
+
+/**
+ * @desc    Init DMA channel for SPIx transmit
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_DMA_Init (SPI_TypeDef *SPIx)
+{
+  // channel
+  DMA_Channel_TypeDef *channel = SPI_DMA_Channel (SPIx);
+
+  // enable clock for DMA1
+  SET_BIT (RCC->AHBENR, RCC_AHBENR_DMA1EN);
+  // disable channel
+  channel->CCR = 0;
+  // peripheral address
+  channel->CPAR = (uint32_t) &SPIx->DR;
+}
+
+/**
+ * @desc    Start DMA transmit, returns immediately
+ *          8 bit frame - items are bytes, 16 bit frame (DFF) - items are half words
+ *
+ * @param   SPI_TypeDef *SPIx
+ * @param   const void * buffer
+ * @param   uint16_t number of items
+ * @param   uint32_t flags
+ *
+ * @return  void
+ */
+void SPI_DMA_Transmit (SPI_TypeDef *SPIx, const void *buffer, uint16_t count, uint32_t flags)
+{
+  // channel
+  DMA_Channel_TypeDef *channel = SPI_DMA_Channel (SPIx);
+  // direction memory -> peripheral, high priority
+  uint32_t ccr = DMA_CCR1_DIR | DMA_CCR1_PL_1 | (flags & (SPI_DMA_MINC | SPI_DMA_IRQ));
+
+  // nothing to send
+  if (count == 0) {
+    return;
+  }
+#ifdef SPI_TRACE
+  // capture
+  TRACE_Block (SPIx, buffer, count, (SPIx->CR1 & SPI_CR1_DFF) ? 2 : 1, (flags & SPI_DMA_MINC) != 0);
+#endif
+  // 16 bit frame format
+  if (SPIx->CR1 & SPI_CR1_DFF) {
+    // memory and peripheral size 16 bits
+    ccr |= DMA_CCR1_MSIZE_0 | DMA_CCR1_PSIZE_0;
+  }
+  // disable channel
+  channel->CCR = 0;
+  // clear flags of channel
+  DMA1->IFCR = SPI_DMA_Flag (SPIx) >> 1;
+  // memory address
+  channel->CMAR = (uint32_t) buffer;
+  // number of items
+  channel->CNDTR = count;
+  // configure and enable channel
+  channel->CCR = ccr | DMA_CCR1_EN;
+  // enable request from SPI transmit buffer
+  SET_BIT (SPIx->CR2, SPI_CR2_TXDMAEN);
+}
+
+/**
+ * @desc    Check if DMA transmit in progress
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  uint8_t
+ */
+uint8_t SPI_DMA_Busy (SPI_TypeDef *SPIx)
+{
+  // channel enabled and transfer not completed
+  return (SPI_DMA_Channel (SPIx)->CCR & DMA_CCR1_EN) && !(DMA1->ISR & SPI_DMA_Flag (SPIx));
+}
+
+/**
+ * @desc    Wait till DMA transmit and shift register finish
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_DMA_Wait (SPI_TypeDef *SPIx)
+{
+  // channel
+  DMA_Channel_TypeDef *channel = SPI_DMA_Channel (SPIx);
+
+  // no transfer started
+  if (!(channel->CCR & DMA_CCR1_EN)) {
+    return;
+  }
+  // wait till transfer complete
+  while (!(DMA1->ISR & SPI_DMA_Flag (SPIx)));
+  // release channel
+  SPI_DMA_Finish (SPIx);
+}
+
+/**
+ * @desc    Release channel after transfer complete - also from interrupt
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_DMA_Finish (SPI_TypeDef *SPIx)
+{
+  // disable channel
+  SPI_DMA_Channel (SPIx)->CCR = 0;
+  // clear flags of channel
+  DMA1->IFCR = SPI_DMA_Flag (SPIx) >> 1;
+  // disable request from SPI transmit buffer
+  CLEAR_BIT (SPIx->CR2, SPI_CR2_TXDMAEN);
+  // wait for shift register
+  SPI_Wait_Idle (SPIx);
+}
+
+/**
+ * @desc    Enable transfer complete interrupt of SPIx transmit channel in NVIC
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_DMA_IRQ_Enable (SPI_TypeDef *SPIx)
+{
+  // SPI1
+  if (SPIx == SPI1) {
+    // channel 3
+    NVIC_EnableIRQ (DMA1_Channel3_IRQn);
+  // SPI2
+  } else {
+    // channel 5
+    NVIC_EnableIRQ (DMA1_Channel5_IRQn);
+  }
+}
+
+/**
+ * @desc    Change baud rate, frame format and clock mode
+ *          SPI must be idle, peripheral is disabled during change
+ *
+ * @param   SPI_TypeDef *SPIx
+ * @param   uint16_t CR1 bits BR[2:0], DFF, CPOL, CPHA
+ *
+ * @return  void
+ */
+void SPI_Configure (SPI_TypeDef *SPIx, uint16_t config)
+{
+  // disable SPI
+  CLEAR_BIT (SPIx->CR1, SPI_CR1_SPE);
+  // new configuration, master bits kept
+  SPIx->CR1 = (SPIx->CR1 & ~(SPI_CR1_BR | SPI_CR1_DFF | SPI_CR1_CPOL | SPI_CR1_CPHA)) | config;
+  // enable SPI
+  SET_BIT (SPIx->CR1, SPI_CR1_SPE);
+}
+
+/**
+ * @desc    Enable / disable transmit buffer empty interrupt, NVIC line enabled
+ *
+ * @param   SPI_TypeDef *SPIx
+ * @param   uint8_t enable
+ *
+ * @return  void
+ */
+void SPI_TXE_Interrupt (SPI_TypeDef *SPIx, uint8_t enable)
+{
+  // disable
+  if (!enable) {
+    // TXEIE off
+    CLEAR_BIT (SPIx->CR2, SPI_CR2_TXEIE);
+    return;
+  }
+  // interrupt line of SPIx
+  NVIC_EnableIRQ ((SPIx == SPI1) ? SPI1_IRQn : SPI2_IRQn);
+  // TXEIE on, fires immediately when TXE set
+  SET_BIT (SPIx->CR2, SPI_CR2_TXEIE);
+}
+
+/**
+ * @desc    Wait till last data shifted out
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_Wait_Idle (SPI_TypeDef *SPIx)
+{
+  // wait till last data loaded into shift register
+  while (!(SPIx->SR & SPI_SR_TXE));
+  // wait till last data shifted out
+  while (SPIx->SR & SPI_SR_BSY);
+  // received data are not read, clear RXNE and OVR flags
+  (void) SPIx->DR;
+  (void) SPIx->SR;
+}
+
 /**
  * @desc    Stop SPI
  *
@@ -304,14 +618,20 @@ void SPI_Disable (SPI_TypeDef *SPIx)
   // check BUSY flag
   while (SPIx->SR & SPI_SR_BSY);
 
-  // disable SPI1
+  // disable SPI
   SPIx->CR1 &= ~SPI_CR1_SPE;
-  // low level
-  SPI_SS_High (SPI_SS_GPIO, SPI_SS_PIN);
 
   // SPI1 disable clock
   if (SPIx == SPI1) {
+    // low level
+    SPI_SS_High (SPI_SS_GPIO, SPI_SS_PIN);
     // disable clock
     RCC->APB2ENR &= ~RCC_APB2ENR_SPI1EN;
+  // SPI2 disable clock
+  } else if (SPIx == SPI2) {
+    // low level
+    SPI_SS_High (SPI2_SS_GPIO, SPI2_SS_PIN);
+    // disable clock
+    RCC->APB1ENR &= ~RCC_APB1ENR_SPI2EN;
   }
 }
@@ -27,18 +27,25 @@
   #define SPI_SS_GPIO       GPIOA
   #define SPI_SS_PIN        GPIO_BRR_BR4
 
+  #define SPI2_SS_GPIO      GPIOB
+  #define SPI2_SS_PIN       GPIO_BRR_BR12
+
+  // DMA flags
+  // -----------------------------------
+  #define SPI_DMA_MINC      DMA_CCR1_MINC     // memory increment, otherwise one item repeated
+  #define SPI_DMA_IRQ       DMA_CCR1_TCIE     // transfer complete interrupt
+
   /**
-   * @desc    Init pins for SPI1
+   * @desc    Init pins for SPI1 / SPI2
    *
    * @param   SPI_TypeDef *
-   * @param   void
    *
    * @return  void
    */
   void SPI_Pins_Init (SPI_TypeDef *);
 
   /**
-   * @desc    Init SPI1 - master
+   * @desc    Init SPI1 / SPI2 - master
    *
    * @param   SPI_TypeDef *
    *
@@ -86,6 +93,104 @@
    */
   uint8_t SPI_SS_Low (GPIO_TypeDef *, uint16_t);
 
+  /**
+   * @desc    Polled transmit of block, received data not read
+   *
+   * @param   SPI_TypeDef *
+   * @param   const void * buffer
+   * @param   uint16_t number of items
+   * @param   uint32_t flags
+   *
+   * @return  void
+   */
+  void SPI_Transmit (SPI_TypeDef *, const void *, uint16_t, uint32_t);
+
+  /**
+   * @desc    Init DMA channel for SPIx transmit
+   *
+   * @param   SPI_TypeDef *
+   *
+   * @return  void
+   */
+  void SPI_DMA_Init (SPI_TypeDef *);
+
+  /**
+   * @desc    Start DMA transmit, returns immediately
+   *
+   * @param   SPI_TypeDef *
+   * @param   const void * buffer
+   * @param   uint16_t number of items
+   * @param   uint32_t flags
+   *
+   * @return  void
+   */
+  void SPI_DMA_Transmit (SPI_TypeDef *, const void *, uint16_t, uint32_t);
+
+  /**
+   * @desc    Check if DMA transmit in progress
+   *
+   * @param   SPI_TypeDef *
+   *
+   * @return  uint8_t
+   */
+  uint8_t SPI_DMA_Busy (SPI_TypeDef *);
+
+  /**
+   * @desc    Wait till DMA transmit and shift register finish
+   *
+   * @param   SPI_TypeDef *
+   *
+   * @return  void
+   */
+  void SPI_DMA_Wait (SPI_TypeDef *);
+
+  /**
+   * @desc    Release channel after transfer complete - also from interrupt
+   *
+   * @param   SPI_TypeDef *
+   *
+   * @return  void
+   */
+  void SPI_DMA_Finish (SPI_TypeDef *);
+
+  /**
+   * @desc    Enable transfer complete interrupt of SPIx transmit channel in NVIC
+   *
+   * @param   SPI_TypeDef *
+   *
+   * @return  void
+   */
+  void SPI_DMA_IRQ_Enable (SPI_TypeDef *);
+
+  /**
+   * @desc    Change baud rate, frame format and clock mode
+   *
+   * @param   SPI_TypeDef *
+   * @param   uint16_t CR1 bits BR[2:0], DFF, CPOL, CPHA
+   *
+   * @return  void
+   */
+  void SPI_Configure (SPI_TypeDef *, uint16_t);
+
+  /**
+   * @desc    Enable / disable transmit buffer empty interrupt
+   *
+   * @param   SPI_TypeDef *
+   * @param   uint8_t enable
+   *
+   * @return  void
+   */
+  void SPI_TXE_Interrupt (SPI_TypeDef *, uint8_t);
+
+  /**
+   * @desc    Wait till last data shifted out
+   *
+   * @param   SPI_TypeDef *
+   *
+   * @return  void
+   */
+  void SPI_Wait_Idle (SPI_TypeDef *);
+
   /**
    * @desc    Stop SPI1
    *
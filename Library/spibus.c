@@ -0,0 +1,440 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        SPI bus manager Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        spibus.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      spibus.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       More slaves on one SPI - per device descriptor (chip select, baud rate, frame
+ *              size, CPOL / CPHA) and queue of DMA transactions. CR1 is reconfigured only when
+ *              device changes, back-to-back transactions of same device keep chip select low
+ *              and DMA complete interrupt starts next queued transaction.
+ *              SPIBUS_NO_DMA - DMA channel and its interrupt vector of SPI are left to other
+ *              peripheral, every transaction is sent by polling before SPIBUS_Submit returns.
+ * @note        Transactions are submitted from thread context only
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "spibus.h"
+
+/** @var Bus on SPI1 */
+SPIBUS_Bus spiBus1 = { .spi = SPI1 };
+/** @var Bus on SPI2 */
+SPIBUS_Bus spiBus2 = { .spi = SPI2 };
+
+/**
+ * @desc    Select device - previous device released, CR1 changed only if configuration differs
+ *
+ * @param   SPIBUS_Bus * bus
+ * @param   SPIBUS_Device * device
+ * @param   uint16_t configuration
+ *
+ * @return  void
+ */
+static void SPIBUS_Select (SPIBUS_Bus *bus, SPIBUS_Device *device, uint16_t config)
+{
+  // release previous device
+  if ((bus->device != device) && (bus->device != NULL)) {
+    // chip disable - idle high
+    SET_BIT (bus->device->port->BSRR, bus->device->pin);
+  }
+  // other baud rate, frame size or clock mode
+  if (bus->config != config) {
+    // reconfigure CR1
+    SPI_Configure (bus->spi, config);
+    // remember configuration
+    bus->config = config;
+  }
+  // select device
+  if (bus->device != device) {
+    // chip enable - active low
+    SET_BIT (device->port->BRR, device->pin);
+    // selected device
+    bus->device = device;
+  }
+}
+
+#ifndef SPIBUS_NO_DMA
+
+/**
+ * @desc    Start transaction on idle bus
+ *
+ * @param   SPIBUS_Bus * bus
+ * @param   SPIBUS_Transaction * transaction
+ *
+ * @return  void
+ */
+static void SPIBUS_Start (SPIBUS_Bus *bus, SPIBUS_Transaction *transaction)
+{
+  // chip select and configuration of device, 16 bit frame on request
+  SPIBUS_Select (bus, transaction->device, transaction->device->config | ((transaction->flags & SPIBUS_FRAME16) ? SPI_CR1_DFF : 0));
+  // in progress
+  transaction->state = SPIBUS_ACTIVE;
+  // start DMA with transfer complete interrupt
+  SPI_DMA_Transmit (bus->spi, transaction->buffer, transaction->count, transaction->flags | SPI_DMA_IRQ);
+}
+
+#else
+
+/**
+ * @desc    Send transaction by polling, finished before return - bus without DMA channel
+ *
+ * @param   SPIBUS_Bus * bus
+ * @param   SPIBUS_Transaction * transaction
+ *
+ * @return  void
+ */
+static void SPIBUS_Poll (SPIBUS_Bus *bus, SPIBUS_Transaction *transaction)
+{
+  // chip select and configuration of device, 16 bit frame on request
+  SPIBUS_Select (bus, transaction->device, transaction->device->config | ((transaction->flags & SPIBUS_FRAME16) ? SPI_CR1_DFF : 0));
+  // in progress
+  transaction->state = SPIBUS_ACTIVE;
+  // buffer
+  SPI_Transmit (bus->spi, transaction->buffer, transaction->count, transaction->flags);
+  // same buffer again
+  while (transaction->repeat > 0) {
+    transaction->repeat--;
+    SPI_Transmit (bus->spi, transaction->buffer, transaction->count, transaction->flags);
+  }
+  // wait for shift register
+  SPI_Wait_Idle (bus->spi);
+  // finished
+  transaction->state = SPIBUS_DONE;
+  bus->finished++;
+  // notify owner
+  if (transaction->done != NULL) {
+    transaction->done (transaction);
+  }
+}
+
+#endif
+
+/**
+ * @desc    Init bus - SPI master, DMA and its interrupt, only once
+ *
+ * @param   SPIBUS_Bus * bus
+ *
+ * @return  void
+ */
+void SPIBUS_Init (SPIBUS_Bus *bus)
+{
+  // already initialized by other device
+  if (bus->ready) {
+    return;
+  }
+  // init SPI Master, DMA channel unless SPIBUS_NO_DMA
+  SPI_Master_Init (bus->spi);
+  // configuration set by SPI_Master_Init
+  bus->config = bus->spi->CR1 & SPIBUS_CONFIG_MASK;
+  // no device selected
+  bus->device = NULL;
+  // empty queue
+  bus->head = NULL;
+  bus->tail = NULL;
+  // no fence
+  bus->submitted = 0;
+  bus->finished = 0;
+#ifndef SPIBUS_NO_DMA
+  // transfer complete interrupt
+  SPI_DMA_IRQ_Enable (bus->spi);
+#endif
+  // initialized
+  bus->ready = 1;
+}
+
+/**
+ * @desc    Init chip select pin of device, idle high
+ *
+ * @param   SPIBUS_Device * device
+ *
+ * @return  void
+ */
+void SPIBUS_Device_Init (SPIBUS_Device *device)
+{
+  // variables
+  volatile uint32_t *cr;
+  uint8_t shift = 0;
+
+  // enable clock for corresponding GPIOA / GPIOB
+  SET_BIT (RCC->APB2ENR, (device->port == GPIOA) ? RCC_APB2ENR_IOPAEN : RCC_APB2ENR_IOPBEN);
+  // chip disable - idle high before pin drives
+  SET_BIT (device->port->BSRR, device->pin);
+
+  // pin number from mask
+  while (!(device->pin & (1 << shift))) {
+    shift++;
+  }
+  // pins 0 - 7 in CRL, pins 8 - 15 in CRH
+  cr = (shift < 8) ? &device->port->CRL : &device->port->CRH;
+  // 4 bits per pin
+  shift = (shift & 0x07) << 2;
+  // CNF[1:0] = 00 -> Push pull / GENERAL PURPOSE OUTPUT - MODE[1:0] = 10 (2MHz)
+  *cr = (*cr & ~(0x0F << shift)) | (0x02 << shift);
+}
+
+/**
+ * @desc    Append transaction to queue, starts it if bus is idle
+ *          Buffer must not be changed till transaction finished
+ *
+ * @param   SPIBUS_Bus * bus
+ * @param   SPIBUS_Transaction * transaction
+ *
+ * @return  uint32_t fence
+ */
+uint32_t SPIBUS_Submit (SPIBUS_Bus *bus, SPIBUS_Transaction *transaction)
+{
+  // variables
+  uint32_t fence;
+
+  // nothing to send
+  if (transaction->count == 0) {
+    // finished
+    transaction->state = SPIBUS_DONE;
+    // fence of last transaction
+    return bus->submitted;
+  }
+  // wait for interrupt driven transfer
+  while (bus->locked);
+#ifdef SPIBUS_NO_DMA
+  // fence of transaction
+  fence = ++bus->submitted;
+  // sent now
+  SPIBUS_Poll (bus, transaction);
+#else
+  // last in queue
+  transaction->next = NULL;
+  transaction->state = SPIBUS_QUEUED;
+
+  // queue shared with interrupt
+  __disable_irq ();
+  // bus idle
+  if (bus->head == NULL) {
+    // first and last
+    bus->head = transaction;
+    bus->tail = transaction;
+    // start now
+    SPIBUS_Start (bus, transaction);
+  } else {
+    // append, started by interrupt
+    bus->tail->next = transaction;
+    bus->tail = transaction;
+  }
+  // fence of transaction
+  fence = ++bus->submitted;
+  // end of critical section
+  __enable_irq ();
+#endif
+
+  // fence
+  return fence;
+}
+
+/**
+ * @desc    Check if fence passed - transaction and all before it finished
+ *          Transactions of bus finish in order of submitting
+ *
+ * @param   SPIBUS_Bus * bus
+ * @param   uint32_t fence
+ *
+ * @return  uint8_t
+ */
+uint8_t SPIBUS_Fence_Done (SPIBUS_Bus *bus, uint32_t fence)
+{
+  // counter overflow safe
+  return (int32_t) (bus->finished - fence) >= 0;
+}
+
+/**
+ * @desc    Wait till fence passed
+ *
+ * @param   SPIBUS_Bus * bus
+ * @param   uint32_t fence
+ *
+ * @return  void
+ */
+void SPIBUS_Fence_Wait (SPIBUS_Bus *bus, uint32_t fence)
+{
+  // transactions before fence in progress
+  while (!SPIBUS_Fence_Done (bus, fence));
+}
+
+/**
+ * @desc    Wait till transaction finished
+ *
+ * @param   SPIBUS_Transaction * transaction
+ *
+ * @return  void
+ */
+void SPIBUS_Wait (SPIBUS_Transaction *transaction)
+{
+  // queued or in progress
+  while (transaction->state != SPIBUS_DONE);
+}
+
+/**
+ * @desc    Wait till queue is empty and select device for polled access
+ *          Device stays selected till other device needs the bus
+ *
+ * @param   SPIBUS_Bus * bus
+ * @param   SPIBUS_Device * device
+ *
+ * @return  void
+ */
+void SPIBUS_Claim (SPIBUS_Bus *bus, SPIBUS_Device *device)
+{
+  // wait till queue is empty and interrupt driven transfer finished
+  while ((bus->head != NULL) || bus->locked);
+  // chip select and configuration of device
+  SPIBUS_Select (bus, device, device->config);
+}
+
+/**
+ * @desc    Wait till queue is empty and deselect device
+ *
+ * @param   SPIBUS_Bus * bus
+ *
+ * @return  void
+ */
+void SPIBUS_Release (SPIBUS_Bus *bus)
+{
+  // wait till queue is empty and interrupt driven transfer finished
+  while ((bus->head != NULL) || bus->locked);
+  // device selected
+  if (bus->device != NULL) {
+    // chip disable - idle high
+    SET_BIT (bus->device->port->BSRR, bus->device->pin);
+    // no device
+    bus->device = NULL;
+  }
+}
+
+/**
+ * @desc    Change configuration of claimed bus, device stays selected
+ *          Configuration of device is set again by its next claim
+ *
+ * @param   SPIBUS_Bus * bus
+ * @param   uint16_t CR1 bits BR[2:0], DFF, CPOL, CPHA
+ *
+ * @return  void
+ */
+void SPIBUS_Configure (SPIBUS_Bus *bus, uint16_t config)
+{
+  // other baud rate, frame size or clock mode
+  if (bus->config != config) {
+    // reconfigure CR1
+    SPI_Configure (bus->spi, config);
+    // remember configuration
+    bus->config = config;
+  }
+}
+
+/**
+ * @desc    Claim bus and lock it for interrupt driven transfer without DMA
+ *
+ * @param   SPIBUS_Bus * bus
+ * @param   SPIBUS_Device * device
+ *
+ * @return  void
+ */
+void SPIBUS_Lock (SPIBUS_Bus *bus, SPIBUS_Device *device)
+{
+  // wait for other users, select device
+  SPIBUS_Claim (bus, device);
+  // keep others away
+  bus->locked = 1;
+}
+
+/**
+ * @desc    Unlock bus - also from interrupt
+ *
+ * @param   SPIBUS_Bus * bus
+ *
+ * @return  void
+ */
+void SPIBUS_Unlock (SPIBUS_Bus *bus)
+{
+  // bus free
+  bus->locked = 0;
+}
+
+#ifndef SPIBUS_NO_DMA
+
+/**
+ * @desc    DMA transfer complete handler of bus
+ *          Repeated buffer restarted, finished transaction removed, next one started
+ *          without returning to thread
+ *
+ * @param   SPIBUS_Bus * bus
+ *
+ * @return  void
+ */
+void SPIBUS_IRQHandler (SPIBUS_Bus *bus)
+{
+  // finished transaction
+  SPIBUS_Transaction *transaction = bus->head;
+
+  // wait for shift register, release DMA channel
+  SPI_DMA_Finish (bus->spi);
+  // spurious interrupt
+  if (transaction == NULL) {
+    return;
+  }
+  // same buffer again, transaction stays at head
+  if (transaction->repeat > 0) {
+    transaction->repeat--;
+    SPIBUS_Start (bus, transaction);
+    return;
+  }
+  // remove from queue
+  bus->head = transaction->next;
+  // finished
+  transaction->state = SPIBUS_DONE;
+  bus->finished++;
+  // notify owner
+  if (transaction->done != NULL) {
+    transaction->done (transaction);
+  }
+  // chain next transaction, not started yet by callback
+  if ((bus->head != NULL) && (bus->head->state == SPIBUS_QUEUED)) {
+    SPIBUS_Start (bus, bus->head);
+  }
+}
+
+/**
+ * @desc    DMA1 Channel 3 interrupt - SPI1 transmit
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void DMA1_Channel3_IRQHandler (void)
+{
+  // bus on SPI1
+  SPIBUS_IRQHandler (&spiBus1);
+}
+
+/**
+ * @desc    DMA1 Channel 5 interrupt - SPI2 transmit
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void DMA1_Channel5_IRQHandler (void)
+{
+  // bus on SPI2
+  SPIBUS_IRQHandler (&spiBus2);
+}
+
+#endif
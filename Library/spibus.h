@@ -0,0 +1,236 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        SPI bus manager Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        spibus.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      spi.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       More slaves on one SPI - per device descriptor (chip select, baud rate, frame
+ *              size, CPOL / CPHA) and queue of DMA transactions. CR1 is reconfigured only when
+ *              device changes, back-to-back transactions of same device keep chip select low
+ *              and DMA complete interrupt starts next queued transaction.
+ *              SPIBUS_NO_DMA - DMA channel and its interrupt vector of SPI are left to other
+ *              peripheral, every transaction is sent by polling before SPIBUS_Submit returns.
+ * @note        Transactions are submitted from thread context only
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __SPIBUS_H__
+#define __SPIBUS_H__
+
+  #include <stddef.h>
+  #include <stm32f10x.h>
+  #include "spi.h"
+
+  // Device configuration - CR1 bits
+  // -----------------------------------
+  #define SPIBUS_MODE0          0x0000                            // CPOL = 0, CPHA = 0
+  #define SPIBUS_MODE1          SPI_CR1_CPHA                      // CPOL = 0, CPHA = 1
+  #define SPIBUS_MODE2          SPI_CR1_CPOL                      // CPOL = 1, CPHA = 0
+  #define SPIBUS_MODE3          (SPI_CR1_CPOL | SPI_CR1_CPHA)     // CPOL = 1, CPHA = 1
+  #define SPIBUS_8BIT           0x0000                            // 8 bit frame
+  #define SPIBUS_16BIT          SPI_CR1_DFF                       // 16 bit frame
+  #define SPIBUS_DIV2           0x0000                            // f PCLK / 2
+  #define SPIBUS_DIV4           SPI_CR1_BR_0                      // f PCLK / 4
+  #define SPIBUS_DIV8           SPI_CR1_BR_1                      // f PCLK / 8
+  #define SPIBUS_DIV16          (SPI_CR1_BR_1 | SPI_CR1_BR_0)     // f PCLK / 16
+  #define SPIBUS_DIV32          SPI_CR1_BR_2                      // f PCLK / 32
+  #define SPIBUS_CONFIG_MASK    (SPI_CR1_BR | SPI_CR1_DFF | SPI_CR1_CPOL | SPI_CR1_CPHA)
+
+  // Transaction flags - besides SPI_DMA_MINC
+  // -----------------------------------
+  #define SPIBUS_FRAME16        0x80000000        // 16 bit frame for this transaction, items are half words
+
+  // Transaction state
+  // -----------------------------------
+  #define SPIBUS_DONE           0                                 // finished / never submitted
+  #define SPIBUS_QUEUED         1                                 // waiting in queue
+  #define SPIBUS_ACTIVE         2                                 // DMA in progress
+
+  /** @struct Device on bus */
+  typedef struct {
+    // chip select port
+    GPIO_TypeDef *port;
+    // chip select pin mask
+    uint16_t pin;
+    // baud rate, frame size, CPOL / CPHA
+    uint16_t config;
+  } SPIBUS_Device;
+
+  /** @struct Transaction */
+  typedef struct SPIBUS_Transaction {
+    // target device
+    SPIBUS_Device *device;
+    // transmit buffer
+    const void *buffer;
+    // number of items (bytes or half words)
+    uint16_t count;
+    // buffer sent again this many times before finish, consumed by interrupt
+    uint16_t repeat;
+    // SPI_DMA_MINC or one item repeated, SPIBUS_FRAME16
+    uint32_t flags;
+    // callback from interrupt when finished / NULL
+    void (*done) (struct SPIBUS_Transaction *);
+    // state
+    volatile uint8_t state;
+    // next in queue
+    struct SPIBUS_Transaction *next;
+  } SPIBUS_Transaction;
+
+  /** @struct Bus */
+  typedef struct {
+    // SPI instance
+    SPI_TypeDef *spi;
+    // device with chip select low
+    SPIBUS_Device *device;
+    // configuration currently in CR1
+    uint16_t config;
+    // bus initialized
+    uint8_t ready;
+    // bus locked by interrupt driven transfer
+    volatile uint8_t locked;
+    // first queued transaction, in progress
+    SPIBUS_Transaction * volatile head;
+    // last queued transaction
+    SPIBUS_Transaction *tail;
+    // number of submitted transactions, fence of last one
+    uint32_t submitted;
+    // number of finished transactions
+    volatile uint32_t finished;
+  } SPIBUS_Bus;
+
+  /** @var Bus on SPI1 - DMA1 Channel 3 */
+  extern SPIBUS_Bus spiBus1;
+  /** @var Bus on SPI2 - DMA1 Channel 5 */
+  extern SPIBUS_Bus spiBus2;
+
+  /**
+   * @desc    Init bus - SPI master, DMA and its interrupt, only once
+   *
+   * @param   SPIBUS_Bus * bus
+   *
+   * @return  void
+   */
+  void SPIBUS_Init (SPIBUS_Bus *);
+
+  /**
+   * @desc    Init chip select pin of device, idle high
+   *
+   * @param   SPIBUS_Device * device
+   *
+   * @return  void
+   */
+  void SPIBUS_Device_Init (SPIBUS_Device *);
+
+  /**
+   * @desc    Append transaction to queue, starts it if bus is idle
+   *
+   * @param   SPIBUS_Bus * bus
+   * @param   SPIBUS_Transaction * transaction
+   *
+   * @return  uint32_t fence
+   */
+  uint32_t SPIBUS_Submit (SPIBUS_Bus *, SPIBUS_Transaction *);
+
+  /**
+   * @desc    Check if fence passed - transaction and all before it finished
+   *
+   * @param   SPIBUS_Bus * bus
+   * @param   uint32_t fence
+   *
+   * @return  uint8_t
+   */
+  uint8_t SPIBUS_Fence_Done (SPIBUS_Bus *, uint32_t);
+
+  /**
+   * @desc    Wait till fence passed
+   *
+   * @param   SPIBUS_Bus * bus
+   * @param   uint32_t fence
+   *
+   * @return  void
+   */
+  void SPIBUS_Fence_Wait (SPIBUS_Bus *, uint32_t);
+
+  /**
+   * @desc    Wait till transaction finished
+   *
+   * @param   SPIBUS_Transaction * transaction
+   *
+   * @return  void
+   */
+  void SPIBUS_Wait (SPIBUS_Transaction *);
+
+  /**
+   * @desc    Wait till queue is empty and select device for polled access
+   *          Device stays selected till other device needs the bus
+   *
+   * @param   SPIBUS_Bus * bus
+   * @param   SPIBUS_Device * device
+   *
+   * @return  void
+   */
+  void SPIBUS_Claim (SPIBUS_Bus *, SPIBUS_Device *);
+
+  /**
+   * @desc    Wait till queue is empty and deselect device
+   *
+   * @param   SPIBUS_Bus * bus
+   *
+   * @return  void
+   */
+  void SPIBUS_Release (SPIBUS_Bus *);
+
+  /**
+   * @desc    Change configuration of claimed bus, device stays selected
+   *          Configuration of device is set again by its next claim
+   *
+   * @param   SPIBUS_Bus * bus
+   * @param   uint16_t CR1 bits BR[2:0], DFF, CPOL, CPHA
+   *
+   * @return  void
+   */
+  void SPIBUS_Configure (SPIBUS_Bus *, uint16_t);
+
+  /**
+   * @desc    Claim bus and lock it for interrupt driven transfer without DMA
+   *
+   * @param   SPIBUS_Bus * bus
+   * @param   SPIBUS_Device * device
+   *
+   * @return  void
+   */
+  void SPIBUS_Lock (SPIBUS_Bus *, SPIBUS_Device *);
+
+  /**
+   * @desc    Unlock bus - also from interrupt
+   *
+   * @param   SPIBUS_Bus * bus
+   *
+   * @return  void
+   */
+  void SPIBUS_Unlock (SPIBUS_Bus *);
+
+#ifndef SPIBUS_NO_DMA
+
+  /**
+   * @desc    DMA transfer complete handler of bus
+   *
+   * @param   SPIBUS_Bus * bus
+   *
+   * @return  void
+   */
+  void SPIBUS_IRQHandler (SPIBUS_Bus *);
+
+#endif
+
+#endif
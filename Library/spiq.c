@@ -0,0 +1,749 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        SPI command queue Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        spiq.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      spiq.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Interrupt driven transmit without DMA. Drawing calls encode display operations
+ *              (command, data bytes, repeated color, DC transitions) into lock-free single
+ *              producer / single consumer ring buffer and return, SPI TXE interrupt sends them.
+ *              Producer waits only when ring buffer is full (back-pressure).
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "spiq.h"
+
+#ifdef SPI_TRACE
+  #include "trace.h"
+#endif
+
+/** @var Queue served by interrupt of SPI1 / SPI2 */
+static SPIQ_Queue *spiqQueue[2];
+
+/** @struct Pixels of RAM write encoded into data operations */
+typedef struct {
+  // data operation being filled
+  uint8_t data[SPIQ_DATA_MAX];
+  uint8_t length;
+  // 12 bit - first pixel of pair waiting for second one
+  uint16_t held;
+  uint8_t pending;
+} SPIQ_Stream;
+
+/**
+ * @desc    Start interrupt if not running - bus locked for display
+ *
+ * @param   SPIQ_Queue * queue
+ *
+ * @return  void
+ */
+static void SPIQ_Start (SPIQ_Queue *queue)
+{
+  // interrupt running
+  if (queue->active) {
+    return;
+  }
+  // finish burst of display
+  ST7735_Sync (queue->lcd);
+  // wait for DMA bursts and other devices, select display
+  SPIBUS_Lock (queue->lcd->bus, &queue->lcd->device);
+  // DC level changed by polled access meanwhile
+  queue->dc = 0xFF;
+  // no operation in progress
+  queue->left = 0;
+  // running
+  queue->active = 1;
+  // TXE interrupt fires immediately
+  SPI_TXE_Interrupt (queue->lcd->bus->spi, 1);
+}
+
+/**
+ * @desc    Copy encoded operation into ring buffer and publish it
+ *          Waits for free space, interrupt is started meanwhile
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   const uint8_t * operation
+ * @param   uint16_t number of bytes
+ *
+ * @return  void
+ */
+static void SPIQ_Push (SPIQ_Queue *queue, const uint8_t *operation, uint16_t count)
+{
+  // variables
+  uint16_t head = queue->head;
+  uint16_t used;
+
+  // back-pressure - not enough free space
+  if ((SPIQ_SIZE - 1 - ((head - queue->tail) & SPIQ_MASK)) < count) {
+    // statistics
+    queue->stats.stalls++;
+    // make space by sending
+    SPIQ_Start (queue);
+    // wait for consumer
+    while ((SPIQ_SIZE - 1 - ((head - queue->tail) & SPIQ_MASK)) < count);
+  }
+  // copy operation
+  while (count--) {
+    // write byte
+    queue->ring[head] = *operation++;
+    // next position
+    head = (head + 1) & SPIQ_MASK;
+  }
+  // publish whole operation at once
+  queue->head = head;
+  // high water mark
+  used = (head - queue->tail) & SPIQ_MASK;
+  if (used > queue->stats.highWater) {
+    queue->stats.highWater = used;
+  }
+  // send
+  SPIQ_Start (queue);
+}
+
+/**
+ * @desc    Init queue of display, display must be initialized
+ *          One queue per SPI - replaces queue served by interrupt of same SPI, its
+ *          operations are sent first
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void SPIQ_Init (SPIQ_Queue *queue, ST7735_Display *lcd)
+{
+  // variables
+  SPIQ_Queue **served = &spiqQueue[(lcd->bus->spi == SPI1) ? 0 : 1];
+
+  // previous queue of SPI
+  if (*served != NULL) {
+    SPIQ_Flush (*served);
+  }
+  // display
+  queue->lcd = lcd;
+  // empty ring buffer
+  queue->head = 0;
+  queue->tail = 0;
+  queue->active = 0;
+  queue->left = 0;
+  // reset statistics
+  queue->stats.highWater = 0;
+  queue->stats.stalls = 0;
+  queue->stats.bytes = 0;
+  // served by interrupt of SPI
+  *served = queue;
+}
+
+/**
+ * @desc    Enqueue command
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   uint8_t command
+ *
+ * @return  void
+ */
+void SPIQ_Command (SPIQ_Queue *queue, uint8_t command)
+{
+  // encoded operation
+  uint8_t operation[2] = { SPIQ_OP_COMMAND, command };
+
+  // enqueue
+  SPIQ_Push (queue, operation, 2);
+  // traffic
+  queue->lcd->bytes++;
+}
+
+/**
+ * @desc    Enqueue data bytes, split into operations of max SPIQ_DATA_MAX bytes
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   const uint8_t * data
+ * @param   uint16_t number of bytes
+ *
+ * @return  void
+ */
+void SPIQ_Data (SPIQ_Queue *queue, const uint8_t *data, uint16_t count)
+{
+  // variables
+  uint8_t operation[SPIQ_DATA_MAX + 1];
+  uint8_t length;
+  uint8_t i;
+
+  // loop through chunks
+  while (count > 0) {
+    // chunk length
+    length = (count > SPIQ_DATA_MAX) ? SPIQ_DATA_MAX : count;
+    // header
+    operation[0] = SPIQ_OP_DATA | (length - 1);
+    // payload
+    for (i = 0; i < length; i++) {
+      operation[i + 1] = *data++;
+    }
+    // enqueue
+    SPIQ_Push (queue, operation, length + 1);
+    queue->lcd->bytes += length;
+    // rest
+    count -= length;
+  }
+}
+
+/**
+ * @desc    Enqueue repeated color
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   uint16_t color
+ * @param   uint16_t number of pixels
+ *
+ * @return  void
+ */
+void SPIQ_Fill (SPIQ_Queue *queue, uint16_t color, uint16_t count)
+{
+  // encoded operation
+  uint8_t operation[6] = {
+    SPIQ_OP_FILL,
+    (uint8_t) (color >> 8), (uint8_t) color,
+    (uint8_t) (count >> 8), (uint8_t) count
+  };
+  uint16_t pixel;
+
+  // nothing to send
+  if (count == 0) {
+    return;
+  }
+  // 12 bit - pair RRRRGGGG BBBBRRRR GGGGBBBB
+  if (queue->lcd->colmod == ST7735_COLMOD_12) {
+    pixel = ST7735_RGB444 (color);
+    operation[0] = SPIQ_OP_FILL | SPIQ_OP_PACKED;
+    operation[1] = (uint8_t) (pixel >> 4);
+    operation[2] = (uint8_t) ((pixel << 4) | (pixel >> 8));
+    operation[3] = (uint8_t) pixel;
+    operation[4] = (uint8_t) (count >> 8);
+    operation[5] = (uint8_t) count;
+    // enqueue
+    SPIQ_Push (queue, operation, 6);
+    // traffic - 3 bytes per pair, odd last pixel in 2 bytes
+    queue->lcd->bytes += ((uint32_t) count * 3 + 1) >> 1;
+    return;
+  }
+  // enqueue
+  SPIQ_Push (queue, operation, 5);
+  // traffic
+  queue->lcd->bytes += (uint32_t) count << 1;
+}
+
+/**
+ * @desc    Enqueue window, skipped if same as last one
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   uint8_t x - start position
+ * @param   uint8_t x - end position
+ * @param   uint8_t y - start position
+ * @param   uint8_t y - end position
+ *
+ * @return  uint8_t
+ */
+uint8_t SPIQ_SetWindow (SPIQ_Queue *queue, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1)
+{
+  // variables
+  ST7735_Display *lcd = queue->lcd;
+  uint8_t data[4] = { 0x00, 0x00, 0x00, 0x00 };
+
+  // check if coordinates is out of range
+  if ((x0 > x1)     ||
+      (x1 > (lcd->width - 1)) ||
+      (y0 > y1)     ||
+      (y1 > (lcd->height - 1))) {
+    // out of range
+    return ST7735_ERROR;
+  }
+  // same window as last time, CASET / RASET still valid
+  if ((lcd->window.xs == x0) &&
+      (lcd->window.xe == x1) &&
+      (lcd->window.ys == y0) &&
+      (lcd->window.ye == y1)) {
+    // success
+    return ST7735_SUCCESS;
+  }
+  // column address set
+  SPIQ_Command (queue, CASET);
+  data[1] = x0;
+  data[3] = x1;
+  SPIQ_Data (queue, data, 4);
+  // row address set
+  SPIQ_Command (queue, RASET);
+  data[1] = y0;
+  data[3] = y1;
+  SPIQ_Data (queue, data, 4);
+
+  // remember window, shared with polled access
+  lcd->window.xs = x0;
+  lcd->window.xe = x1;
+  lcd->window.ys = y0;
+  lcd->window.ye = y1;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Enqueue filled rectangle, clipped by clip rectangle
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   uint8_t x - start position
+ * @param   uint8_t x - end position
+ * @param   uint8_t y - start position
+ * @param   uint8_t y - end position
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t SPIQ_FillRect (SPIQ_Queue *queue, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, uint16_t color)
+{
+  // variables
+  ST7735_Rect rect = { x0, x1, y0, y1 };
+
+  // visible part, fully clipped costs no byte
+  if (ST7735_Clip_Rect (queue->lcd, &rect) == ST7735_ERROR) {
+    return ST7735_SUCCESS;
+  }
+  // set window
+  if (SPIQ_SetWindow (queue, rect.xs, rect.xe, rect.ys, rect.ye) == ST7735_ERROR) {
+    // out of range
+    return ST7735_ERROR;
+  }
+  // access to RAM
+  SPIQ_Command (queue, RAMWR);
+  // whole window, max 161 x 130 pixels
+  SPIQ_Fill (queue, color, (rect.xe - rect.xs + 1) * (rect.ye - rect.ys + 1));
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Enqueue pixel
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   uint8_t x position
+ * @param   uint8_t y position
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t SPIQ_DrawPixel (SPIQ_Queue *queue, uint8_t x, uint8_t y, uint16_t color)
+{
+  // one pixel rectangle
+  return SPIQ_FillRect (queue, x, x, y, y, color);
+}
+
+/**
+ * @desc    Append pixel to stream, full data operation enqueued
+ *          12 bit - pixels packed into pairs
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   SPIQ_Stream * stream
+ * @param   uint16_t color RGB565
+ *
+ * @return  void
+ */
+static void SPIQ_Stream_Pixel (SPIQ_Queue *queue, SPIQ_Stream *stream, uint16_t color)
+{
+  // no space for pair
+  if (stream->length > (SPIQ_DATA_MAX - 3)) {
+    SPIQ_Data (queue, stream->data, stream->length);
+    stream->length = 0;
+  }
+  // 16 bit - MSB first
+  if (queue->lcd->colmod != ST7735_COLMOD_12) {
+    stream->data[stream->length++] = (uint8_t) (color >> 8);
+    stream->data[stream->length++] = (uint8_t) color;
+    return;
+  }
+  // 12 bit - first of pair waits
+  color = ST7735_RGB444 (color);
+  if (!stream->pending) {
+    stream->held = color;
+    stream->pending = 1;
+    return;
+  }
+  // RRRRGGGG BBBBRRRR GGGGBBBB
+  stream->data[stream->length++] = (uint8_t) (stream->held >> 4);
+  stream->data[stream->length++] = (uint8_t) ((stream->held << 4) | (color >> 8));
+  stream->data[stream->length++] = (uint8_t) color;
+  stream->pending = 0;
+}
+
+/**
+ * @desc    Enqueue rest of stream, 12 bit - odd last pixel alone
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   SPIQ_Stream * stream
+ *
+ * @return  void
+ */
+static void SPIQ_Stream_End (SPIQ_Queue *queue, SPIQ_Stream *stream)
+{
+  // RRRRGGGG BBBB, panel writes it after 12 bits
+  if (stream->pending) {
+    stream->data[stream->length++] = (uint8_t) (stream->held >> 4);
+    stream->data[stream->length++] = (uint8_t) (stream->held << 4);
+    stream->pending = 0;
+  }
+  // last data operation
+  if (stream->length > 0) {
+    SPIQ_Data (queue, stream->data, stream->length);
+    stream->length = 0;
+  }
+}
+
+/**
+ * @desc    Enqueue line by Bresenham algorithm, clipped by clip rectangle
+ *          Pixels of one row (column of steep line) enqueued as one rectangle
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   uint8_t x start position
+ * @param   uint8_t x end position
+ * @param   uint8_t y start position
+ * @param   uint8_t y end position
+ * @param   uint16_t color
+ *
+ * @return  uint8_t
+ */
+uint8_t SPIQ_DrawLine (SPIQ_Queue *queue, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint16_t color)
+{
+  // variables
+  int16_t xs = x1, ys = y1, xe = x2, ye = y2;
+  int16_t trace_x = 1, trace_y = 1;
+  int16_t delta_x, delta_y;
+  int16_t start;
+  int16_t D;
+
+  // visible part of line, fully clipped costs no byte
+  if (ST7735_Clip_Line (queue->lcd, &xs, &ys, &xe, &ye) == ST7735_ERROR) {
+    return ST7735_SUCCESS;
+  }
+  // deltas and steps
+  delta_x = xe - xs;
+  delta_y = ye - ys;
+  if (delta_x < 0) {
+    delta_x = -delta_x;
+    trace_x = -trace_x;
+  }
+  if (delta_y < 0) {
+    delta_y = -delta_y;
+    trace_y = -trace_y;
+  }
+
+  // m < 1 (dy < dx) - horizontal runs
+  if (delta_y < delta_x) {
+    D = (delta_y << 1) - delta_x;
+    start = xs;
+    // loop through columns
+    while (xs != xe) {
+      // next pixel on next row, run finished
+      if (D >= 0) {
+        SPIQ_FillRect (queue, (start < xs) ? start : xs, (start < xs) ? xs : start, ys, ys, color);
+        ys += trace_y;
+        D -= delta_x << 1;
+        start = xs + trace_x;
+      }
+      D += delta_y << 1;
+      xs += trace_x;
+    }
+    // last run
+    SPIQ_FillRect (queue, (start < xs) ? start : xs, (start < xs) ? xs : start, ys, ys, color);
+  // m >= 1 (dy >= dx) - vertical runs
+  } else {
+    D = delta_y - (delta_x << 1);
+    start = ys;
+    // loop through rows
+    while (ys != ye) {
+      // next pixel on next column, run finished
+      if (D <= 0) {
+        SPIQ_FillRect (queue, xs, xs, (start < ys) ? start : ys, (start < ys) ? ys : start, color);
+        xs += trace_x;
+        D += delta_y << 1;
+        start = ys + trace_y;
+      }
+      D -= delta_x << 1;
+      ys += trace_y;
+    }
+    // last run
+    SPIQ_FillRect (queue, xs, xs, (start < ys) ? start : ys, (start < ys) ? ys : start, color);
+  }
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Enqueue opaque string in one window, clipped by clip rectangle
+ *          Out of range characters drawn as space
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   int16_t x position
+ * @param   int16_t y position
+ * @param   const char * string
+ * @param   uint16_t color
+ * @param   uint16_t background
+ * @param   enum Size (X1, X2, X3)
+ *
+ * @return  uint8_t
+ */
+uint8_t SPIQ_DrawString (SPIQ_Queue *queue, int16_t x, int16_t y, const char *str, uint16_t color, uint16_t background, enum Size size)
+{
+  // variables
+  SPIQ_Stream stream = { .length = 0, .pending = 0 };
+  uint8_t width = GLYPH_WIDTH (size);
+  uint8_t shift_x = GLYPH_SCALE_X (size) - 1;
+  uint8_t shift_y = GLYPH_SCALE_Y (size) - 1;
+  const uint8_t *glyph;
+  ST7735_Rect rect;
+  uint16_t length = 0;
+  uint8_t character;
+  uint8_t idxCol;
+  uint8_t within;
+  uint8_t mask;
+  int16_t col, row;
+
+  // characters
+  while (str[length] != '\0') {
+    length++;
+  }
+  // whole run
+  rect.xs = x;
+  rect.xe = x + length * width - 1;
+  rect.ys = y;
+  rect.ye = y + GLYPH_HEIGHT (size) - 1;
+  // visible part, fully clipped costs no byte
+  if ((length == 0) || (ST7735_Clip_Rect (queue->lcd, &rect) == ST7735_ERROR)) {
+    return ST7735_SUCCESS;
+  }
+  // window and RAM write
+  if (SPIQ_SetWindow (queue, rect.xs, rect.xe, rect.ys, rect.ye) == ST7735_ERROR) {
+    return ST7735_ERROR;
+  }
+  SPIQ_Command (queue, RAMWR);
+  // loop through rows
+  for (row = rect.ys; row <= rect.ye; row++) {
+    // bit of row
+    mask = 1 << ((row - y) >> shift_y);
+    // loop through columns
+    for (col = rect.xs; col <= rect.xe; col++) {
+      // character and column within its cell, last one is spacing
+      character = (uint8_t) str[(col - x) / width];
+      within = (col - x) % width;
+      glyph = ((character < 0x20) || (character > 0x7f)) ? FONTS[0] : FONTS[character - 32];
+      idxCol = within >> shift_x;
+      // pixel
+      if ((idxCol < CHARS_COLS_LEN) && (glyph[idxCol] & mask)) {
+        SPIQ_Stream_Pixel (queue, &stream, color);
+      } else {
+        SPIQ_Stream_Pixel (queue, &stream, background);
+      }
+    }
+  }
+  // rest of pixels
+  SPIQ_Stream_End (queue, &stream);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Enqueue RGB565 image, clipped by clip rectangle
+ *          Image is copied into ring buffer, may be changed after return
+ *
+ * @param   SPIQ_Queue * queue
+ * @param   int16_t x start position
+ * @param   int16_t y start position
+ * @param   uint8_t width
+ * @param   uint8_t height
+ * @param   const uint8_t * pixels MSB first, row by row
+ *
+ * @return  uint8_t
+ */
+uint8_t SPIQ_DrawImage (SPIQ_Queue *queue, int16_t x, int16_t y, uint8_t width, uint8_t height, const uint8_t *pixels)
+{
+  // variables
+  SPIQ_Stream stream = { .length = 0, .pending = 0 };
+  ST7735_Rect rect = { x, x + width - 1, y, y + height - 1 };
+  const uint8_t *pixel;
+  int16_t col, row;
+
+  // visible part, fully clipped costs no byte
+  if ((width == 0) || (height == 0) || (ST7735_Clip_Rect (queue->lcd, &rect) == ST7735_ERROR)) {
+    return ST7735_SUCCESS;
+  }
+  // window and RAM write
+  if (SPIQ_SetWindow (queue, rect.xs, rect.xe, rect.ys, rect.ye) == ST7735_ERROR) {
+    return ST7735_ERROR;
+  }
+  SPIQ_Command (queue, RAMWR);
+  // loop through visible rows and columns
+  for (row = rect.ys; row <= rect.ye; row++) {
+    pixel = pixels + (((row - y) * width + (rect.xs - x)) << 1);
+    for (col = rect.xs; col <= rect.xe; col++, pixel += 2) {
+      SPIQ_Stream_Pixel (queue, &stream, ((uint16_t) pixel[0] << 8) | pixel[1]);
+    }
+  }
+  // rest of pixels
+  SPIQ_Stream_End (queue, &stream);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Wait till all operations sent, bus unlocked
+ *
+ * @param   SPIQ_Queue * queue
+ *
+ * @return  void
+ */
+void SPIQ_Flush (SPIQ_Queue *queue)
+{
+  // interrupt stops when ring buffer is empty
+  while (queue->active);
+}
+
+/**
+ * @desc    TXE interrupt handler of queue - one byte per interrupt
+ *
+ * @param   SPIQ_Queue * queue
+ *
+ * @return  void
+ */
+void SPIQ_IRQHandler (SPIQ_Queue *queue)
+{
+  // variables
+  SPI_TypeDef *spi = queue->lcd->bus->spi;
+  ST7735_Pin *dc = &queue->lcd->dc;
+  uint16_t tail = queue->tail;
+  uint8_t level;
+  uint8_t byte;
+  uint8_t i;
+
+  // current operation finished
+  if (queue->left == 0) {
+    // ring buffer empty
+    if (tail == queue->head) {
+      // stop interrupt
+      SPI_TXE_Interrupt (spi, 0);
+      // wait for last byte
+      SPI_Wait_Idle (spi);
+      // stopped
+      queue->active = 0;
+      // bus free for other devices
+      SPIBUS_Unlock (queue->lcd->bus);
+      return;
+    }
+    // next operation
+    queue->op = queue->ring[tail];
+    tail = (tail + 1) & SPIQ_MASK;
+    // decode
+    switch (queue->op & SPIQ_OP_MASK) {
+      // command byte
+      case SPIQ_OP_COMMAND:
+        queue->left = 1;
+        level = 0;
+        break;
+      // data bytes
+      case SPIQ_OP_DATA:
+        queue->left = (queue->op & ~SPIQ_OP_MASK) + 1;
+        level = 1;
+        break;
+      // repeated color
+      default:
+        queue->period = (queue->op & SPIQ_OP_PACKED) ? 3 : 2;
+        queue->phase = 0;
+        for (i = 0; i < queue->period; i++) {
+          queue->color[i] = queue->ring[tail];
+          tail = (tail + 1) & SPIQ_MASK;
+        }
+        queue->left = ((uint32_t) queue->ring[tail] << 8) | queue->ring[(tail + 1) & SPIQ_MASK];
+        tail = (tail + 2) & SPIQ_MASK;
+        // 2 bytes per pixel, 3 bytes per pair, odd last pixel in 2 bytes
+        queue->left = (queue->period == 2) ? (queue->left << 1) : ((queue->left * 3 + 1) >> 1);
+        level = 1;
+        break;
+    }
+    // DC transition
+    if (level != queue->dc) {
+      // previous byte must leave shift register
+      SPI_Wait_Idle (spi);
+      // command (active low) / data (active high)
+      if (level) {
+        SET_BIT (dc->port->BSRR, dc->pin);
+      } else {
+        SET_BIT (dc->port->BRR, dc->pin);
+      }
+      // remember level
+      queue->dc = level;
+    }
+  }
+
+  // repeated color, MSB first / pair
+  if ((queue->op & SPIQ_OP_MASK) == SPIQ_OP_FILL) {
+    byte = queue->color[queue->phase];
+    if (++queue->phase == queue->period) {
+      queue->phase = 0;
+    }
+  // command or data byte
+  } else {
+    byte = queue->ring[tail];
+    tail = (tail + 1) & SPIQ_MASK;
+  }
+#ifdef SPI_TRACE
+  // capture
+  TRACE_Bytes (spi, &byte, 1);
+#endif
+  // transmit
+  spi->DR = byte;
+  // byte sent
+  queue->left--;
+  queue->stats.bytes++;
+  // release space for producer
+  queue->tail = tail;
+}
+
+/**
+ * @desc    SPI1 interrupt
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void SPI1_IRQHandler (void)
+{
+  // queue on SPI1
+  if (spiqQueue[0] != NULL) {
+    SPIQ_IRQHandler (spiqQueue[0]);
+  }
+}
+
+/**
+ * @desc    SPI2 interrupt
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void SPI2_IRQHandler (void)
+{
+  // queue on SPI2
+  if (spiqQueue[1] != NULL) {
+    SPIQ_IRQHandler (spiqQueue[1]);
+  }
+}
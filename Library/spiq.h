@@ -0,0 +1,231 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        SPI command queue Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        spiq.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Interrupt driven transmit without DMA. Drawing calls encode display operations
+ *              (command, data bytes, repeated color, DC transitions) into lock-free single
+ *              producer / single consumer ring buffer and return, SPI TXE interrupt sends them.
+ *              Producer waits only when ring buffer is full (back-pressure).
+ *              Queued drawing calls: SPIQ_FillRect, SPIQ_DrawPixel, SPIQ_DrawLine,
+ *              SPIQ_DrawString and SPIQ_DrawImage, both pixel formats. ST7735_* calls stay
+ *              polled / DMA and wait for empty queue (bus locked), they are not queued.
+ *              One queue per SPI (TXE interrupt of SPI1 / SPI2) - displays sharing one SPI
+ *              take turns, SPIQ_Init of next display sends rest of previous queue first.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __SPIQ_H__
+#define __SPIQ_H__
+
+  #include "st7735.h"
+
+  // Ring buffer definition
+  // -----------------------------------
+  #ifndef SPIQ_SIZE
+    #define SPIQ_SIZE           512               // bytes, power of 2
+  #endif
+  #define SPIQ_MASK             (SPIQ_SIZE - 1)
+
+  // Encoded operations - first byte
+  // -----------------------------------
+  #define SPIQ_OP_COMMAND       0x00              // DC low, 1 byte follows
+  #define SPIQ_OP_DATA          0x40              // DC high, (len & 0x3F) + 1 bytes follow
+  #define SPIQ_OP_FILL          0x80              // DC high, color (2 bytes), count (2 bytes) follow
+  #define SPIQ_OP_PACKED        0x01              // fill of 12 bit pixel pairs, color (3 bytes) follows
+  #define SPIQ_OP_MASK          0xC0
+  #define SPIQ_DATA_MAX         64                // max bytes of one data operation
+
+  /** @struct Statistics */
+  typedef struct {
+    // max bytes waiting in ring buffer
+    uint16_t highWater;
+    // operations waiting for free space
+    uint32_t stalls;
+    // bytes sent by interrupt
+    uint32_t bytes;
+  } SPIQ_Stats;
+
+  /** @struct Queue of one display */
+  typedef struct {
+    // display
+    ST7735_Display *lcd;
+    // ring buffer of encoded operations
+    uint8_t ring[SPIQ_SIZE];
+    // write index, producer only
+    volatile uint16_t head;
+    // read index, consumer only
+    volatile uint16_t tail;
+    // interrupt running
+    volatile uint8_t active;
+    // consumer - bytes left of current operation
+    uint32_t left;
+    // consumer - current operation
+    uint8_t op;
+    // consumer - color of fill, MSB first / 12 bit pair
+    uint8_t color[3];
+    // consumer - bytes of color
+    uint8_t period;
+    // consumer - next byte of color
+    uint8_t phase;
+    // consumer - level of DC pin, 0xFF unknown
+    uint8_t dc;
+    // statistics
+    SPIQ_Stats stats;
+  } SPIQ_Queue;
+
+  /**
+   * @desc    Init queue of display, display must be initialized
+   *          One queue per SPI - replaces queue served by interrupt of same SPI
+   *
+   * @param   SPIQ_Queue * queue
+   * @param   ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void SPIQ_Init (SPIQ_Queue *, ST7735_Display *);
+
+  /**
+   * @desc    Enqueue command
+   *
+   * @param   SPIQ_Queue * queue
+   * @param   uint8_t command
+   *
+   * @return  void
+   */
+  void SPIQ_Command (SPIQ_Queue *, uint8_t);
+
+  /**
+   * @desc    Enqueue data bytes
+   *
+   * @param   SPIQ_Queue * queue
+   * @param   const uint8_t * data
+   * @param   uint16_t number of bytes
+   *
+   * @return  void
+   */
+  void SPIQ_Data (SPIQ_Queue *, const uint8_t *, uint16_t);
+
+  /**
+   * @desc    Enqueue repeated color
+   *
+   * @param   SPIQ_Queue * queue
+   * @param   uint16_t color
+   * @param   uint16_t number of pixels
+   *
+   * @return  void
+   */
+  void SPIQ_Fill (SPIQ_Queue *, uint16_t, uint16_t);
+
+  /**
+   * @desc    Enqueue window, skipped if same as last one
+   *
+   * @param   SPIQ_Queue * queue
+   * @param   uint8_t x - start position
+   * @param   uint8_t x - end position
+   * @param   uint8_t y - start position
+   * @param   uint8_t y - end position
+   *
+   * @return  uint8_t
+   */
+  uint8_t SPIQ_SetWindow (SPIQ_Queue *, uint8_t, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Enqueue filled rectangle, clipped by clip rectangle
+   *
+   * @param   SPIQ_Queue * queue
+   * @param   uint8_t x - start position
+   * @param   uint8_t x - end position
+   * @param   uint8_t y - start position
+   * @param   uint8_t y - end position
+   * @param   uint16_t color
+   *
+   * @return  uint8_t
+   */
+  uint8_t SPIQ_FillRect (SPIQ_Queue *, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t);
+
+  /**
+   * @desc    Enqueue pixel
+   *
+   * @param   SPIQ_Queue * queue
+   * @param   uint8_t x position
+   * @param   uint8_t y position
+   * @param   uint16_t color
+   *
+   * @return  uint8_t
+   */
+  uint8_t SPIQ_DrawPixel (SPIQ_Queue *, uint8_t, uint8_t, uint16_t);
+
+  /**
+   * @desc    Enqueue line, clipped by clip rectangle
+   *
+   * @param   SPIQ_Queue * queue
+   * @param   uint8_t x start position
+   * @param   uint8_t x end position
+   * @param   uint8_t y start position
+   * @param   uint8_t y end position
+   * @param   uint16_t color
+   *
+   * @return  uint8_t
+   */
+  uint8_t SPIQ_DrawLine (SPIQ_Queue *, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t);
+
+  /**
+   * @desc    Enqueue opaque string in one window, clipped by clip rectangle
+   *
+   * @param   SPIQ_Queue * queue
+   * @param   int16_t x position
+   * @param   int16_t y position
+   * @param   const char * string
+   * @param   uint16_t color
+   * @param   uint16_t background
+   * @param   enum Size (X1, X2, X3)
+   *
+   * @return  uint8_t
+   */
+  uint8_t SPIQ_DrawString (SPIQ_Queue *, int16_t, int16_t, const char *, uint16_t, uint16_t, enum Size);
+
+  /**
+   * @desc    Enqueue RGB565 image, clipped by clip rectangle
+   *
+   * @param   SPIQ_Queue * queue
+   * @param   int16_t x start position
+   * @param   int16_t y start position
+   * @param   uint8_t width
+   * @param   uint8_t height
+   * @param   const uint8_t * pixels MSB first, row by row
+   *
+   * @return  uint8_t
+   */
+  uint8_t SPIQ_DrawImage (SPIQ_Queue *, int16_t, int16_t, uint8_t, uint8_t, const uint8_t *);
+
+  /**
+   * @desc    Wait till all operations sent, bus unlocked
+   *
+   * @param   SPIQ_Queue * queue
+   *
+   * @return  void
+   */
+  void SPIQ_Flush (SPIQ_Queue *);
+
+  /**
+   * @desc    TXE interrupt handler of queue
+   *
+   * @param   SPIQ_Queue * queue
+   *
+   * @return  void
+   */
+  void SPIQ_IRQHandler (SPIQ_Queue *);
+
+#endif
@@ -0,0 +1,443 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Sprite Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        sprite.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      sprite.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Layer of small sprites over static background without framebuffer. Rectangle
+ *              is composed either from readback - sprites above are lifted off by their
+ *              save-under buffers, moved sprite is placed and sprites above are put back - or
+ *              by rasterizer of background with visible sprites painted over every scanline.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "sprite.h"
+
+// Operations on union rectangle
+// -----------------------------------
+#define SPRITE_PASTE            0                 // save-under into rectangle
+#define SPRITE_SAVE             1                 // rectangle into save-under
+#define SPRITE_DRAW             2                 // bitmap into rectangle, transparent skipped
+
+/**
+ * @desc    Rectangle of sprite at position
+ *
+ * @param   const SPRITE_Sprite * sprite
+ * @param   int16_t x
+ * @param   int16_t y
+ * @param   ST7735_Rect * rectangle
+ *
+ * @return  void
+ */
+static void SPRITE_Rect (const SPRITE_Sprite *sprite, int16_t x, int16_t y, ST7735_Rect *rect)
+{
+  // inclusive corners
+  rect->xs = x;
+  rect->xe = x + sprite->width - 1;
+  rect->ys = y;
+  rect->ye = y + sprite->height - 1;
+}
+
+/**
+ * @desc    Check if rectangles overlap
+ *
+ * @param   const ST7735_Rect * a
+ * @param   const ST7735_Rect * b
+ *
+ * @return  uint8_t
+ */
+static uint8_t SPRITE_Overlap (const ST7735_Rect *a, const ST7735_Rect *b)
+{
+  // common pixel
+  return (a->xs <= b->xe) && (b->xs <= a->xe) && (a->ys <= b->ye) && (b->ys <= a->ye);
+}
+
+/**
+ * @desc    Operation between union rectangle and sprite on their intersection
+ *
+ * @param   SPRITE_Layer * layer
+ * @param   const ST7735_Rect * union rectangle
+ * @param   SPRITE_Sprite * sprite
+ * @param   const ST7735_Rect * rectangle of sprite
+ * @param   uint8_t SPRITE_PASTE / SPRITE_SAVE / SPRITE_DRAW
+ *
+ * @return  void
+ */
+static void SPRITE_Copy (SPRITE_Layer *layer, const ST7735_Rect *area, SPRITE_Sprite *sprite, const ST7735_Rect *rect, uint8_t operation)
+{
+  // variables
+  uint16_t stride = (area->xe - area->xs + 1) << 1;
+  const uint8_t *bitmap;
+  uint8_t *under;
+  uint8_t *work;
+  int16_t xs = (rect->xs > area->xs) ? rect->xs : area->xs;
+  int16_t xe = (rect->xe < area->xe) ? rect->xe : area->xe;
+  int16_t ys = (rect->ys > area->ys) ? rect->ys : area->ys;
+  int16_t ye = (rect->ye < area->ye) ? rect->ye : area->ye;
+  int16_t x;
+  int16_t y;
+
+  // no intersection
+  if ((xs > xe) || (ys > ye)) {
+    return;
+  }
+  // loop through rows of intersection
+  for (y = ys; y <= ye; y++) {
+    // first pixel of row
+    work = layer->work + (y - area->ys) * stride + ((xs - area->xs) << 1);
+    under = sprite->under + (((y - rect->ys) * sprite->width + (xs - rect->xs)) << 1);
+    bitmap = sprite->bitmap + (((y - rect->ys) * sprite->width + (xs - rect->xs)) << 1);
+    // loop through pixels
+    for (x = xs; x <= xe; x++) {
+      if (operation == SPRITE_PASTE) {
+        work[0] = under[0];
+        work[1] = under[1];
+      } else if (operation == SPRITE_SAVE) {
+        under[0] = work[0];
+        under[1] = work[1];
+      } else if (((bitmap[0] << 8) | bitmap[1]) != sprite->key) {
+        work[0] = bitmap[0];
+        work[1] = bitmap[1];
+      }
+      work += 2;
+      under += 2;
+      bitmap += 2;
+    }
+  }
+}
+
+/**
+ * @desc    Compose rectangle from readback - sprites above lifted off, moved sprite placed,
+ *          sprites above put back on
+ *
+ * @param   SPRITE_Layer * layer
+ * @param   const ST7735_Rect * area
+ * @param   uint8_t index of moved sprite
+ * @param   const ST7735_Rect * old rectangle / NULL
+ * @param   const ST7735_Rect * new rectangle / NULL
+ *
+ * @return  void
+ */
+static void SPRITE_Compose_Read (SPRITE_Layer *layer, const ST7735_Rect *area, uint8_t index, const ST7735_Rect *before, const ST7735_Rect *after)
+{
+  // variables
+  SPRITE_Sprite *sprite = layer->sprites[index];
+  GRAM_Stats stats = { 0, 0, 0 };
+  ST7735_Rect rect;
+  uint8_t i;
+
+  // screen as it is, waits for previous write of work
+  if (GRAM_Save (layer->lcd, area, layer->work, &stats) == ST7735_ERROR) {
+    return;
+  }
+  // sprites above lifted off from top
+  for (i = layer->count - 1; i > index; i--) {
+    if (layer->sprites[i]->visible) {
+      SPRITE_Rect (layer->sprites[i], layer->sprites[i]->x, layer->sprites[i]->y, &rect);
+      SPRITE_Copy (layer, area, layer->sprites[i], &rect, SPRITE_PASTE);
+    }
+  }
+  // background at old position
+  if (before != NULL) {
+    SPRITE_Copy (layer, area, sprite, before, SPRITE_PASTE);
+  }
+  // background kept, sprite placed at new position
+  if (after != NULL) {
+    SPRITE_Copy (layer, area, sprite, after, SPRITE_SAVE);
+    SPRITE_Copy (layer, area, sprite, after, SPRITE_DRAW);
+  }
+  // sprites above put back from bottom
+  for (i = index + 1; i < layer->count; i++) {
+    if (layer->sprites[i]->visible) {
+      SPRITE_Rect (layer->sprites[i], layer->sprites[i]->x, layer->sprites[i]->y, &rect);
+      SPRITE_Copy (layer, area, layer->sprites[i], &rect, SPRITE_SAVE);
+      SPRITE_Copy (layer, area, layer->sprites[i], &rect, SPRITE_DRAW);
+    }
+  }
+  // one window, sent in background
+  GRAM_Restore (layer->lcd, area, layer->work, &stats);
+  // traffic
+  layer->stats.pixels += stats.written;
+  layer->stats.bytes += stats.bytes;
+}
+
+/**
+ * @desc    Rasterizer of composed scanline - background and visible sprites over it
+ *
+ * @param   void * context - layer
+ * @param   uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width in pixels
+ *
+ * @return  void
+ */
+static void SPRITE_Raster (void *context, uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+  // variables
+  SPRITE_Layer *layer = (SPRITE_Layer *) context;
+  SPRITE_Sprite *sprite;
+  const uint8_t *bitmap;
+  uint8_t *pixel;
+  int16_t xs;
+  int16_t xe;
+  uint8_t i;
+
+  // background
+  layer->background (layer->context, line, y, x, width);
+  // sprites from bottom
+  for (i = 0; i < layer->count; i++) {
+    sprite = layer->sprites[i];
+    // not on row
+    if (!sprite->visible || (y < sprite->y) || (y >= sprite->y + sprite->height)) {
+      continue;
+    }
+    // columns of sprite on line
+    xs = (sprite->x > x) ? sprite->x : x;
+    xe = ((sprite->x + sprite->width) < (x + width)) ? (sprite->x + sprite->width) : (x + width);
+    pixel = line + ((xs - x) << 1);
+    bitmap = sprite->bitmap + (((y - sprite->y) * sprite->width + (xs - sprite->x)) << 1);
+    // loop through pixels, transparent skipped
+    for (; xs < xe; xs++) {
+      if (((bitmap[0] << 8) | bitmap[1]) != sprite->key) {
+        pixel[0] = bitmap[0];
+        pixel[1] = bitmap[1];
+      }
+      pixel += 2;
+      bitmap += 2;
+    }
+  }
+}
+
+/**
+ * @desc    Compose rectangle and send it in one window
+ *
+ * @param   SPRITE_Layer * layer
+ * @param   const ST7735_Rect * area
+ * @param   uint8_t index of moved sprite
+ * @param   const ST7735_Rect * old rectangle / NULL
+ * @param   const ST7735_Rect * new rectangle / NULL
+ *
+ * @return  void
+ */
+static void SPRITE_Compose (SPRITE_Layer *layer, const ST7735_Rect *area, uint8_t index, const ST7735_Rect *before, const ST7735_Rect *after)
+{
+  // variables
+  ST7735_Display *lcd = layer->lcd;
+  ST7735_Rect rect = *area;
+  uint32_t bytes = lcd->bytes;
+
+  // visible part, fully clipped costs no SPI byte
+  if (ST7735_Clip_Rect (lcd, &rect) == ST7735_ERROR) {
+    return;
+  }
+  layer->stats.windows++;
+  // save-under by readback
+  if (layer->background == NULL) {
+    SPRITE_Compose_Read (layer, &rect, index, before, after);
+    return;
+  }
+  // background and sprites line by line
+  SCAN_Render (lcd, &rect, SPRITE_Raster, layer, NULL);
+  // traffic - header and pixels
+  layer->stats.bytes += lcd->bytes - bytes;
+  layer->stats.pixels += (uint32_t) (rect.xe - rect.xs + 1) * (rect.ye - rect.ys + 1);
+}
+
+/**
+ * @desc    Change state of sprite - overlapping positions composed in union rectangle,
+ *          distant ones one after other
+ *
+ * @param   SPRITE_Layer * layer
+ * @param   SPRITE_Sprite * sprite
+ * @param   uint8_t visible after change
+ * @param   int16_t x
+ * @param   int16_t y
+ *
+ * @return  void
+ */
+static void SPRITE_Update (SPRITE_Layer *layer, SPRITE_Sprite *sprite, uint8_t visible, int16_t x, int16_t y)
+{
+  // variables
+  ST7735_Rect before;
+  ST7735_Rect after;
+  ST7735_Rect area;
+  uint8_t shown = sprite->visible;
+  uint8_t index;
+
+  // sprite of layer
+  for (index = 0; index < layer->count; index++) {
+    if (layer->sprites[index] == sprite) {
+      break;
+    }
+  }
+  if (index == layer->count) {
+    return;
+  }
+  // new state, rasterizer draws from it
+  SPRITE_Rect (sprite, sprite->x, sprite->y, &before);
+  SPRITE_Rect (sprite, x, y, &after);
+  sprite->x = x;
+  sprite->y = y;
+  sprite->visible = visible;
+  // nothing on screen before and after
+  if (!shown && !visible) {
+    return;
+  }
+  layer->stats.updates++;
+  // same position shown again
+  if (shown && visible && (before.xs == after.xs) && (before.ys == after.ys)) {
+    return;
+  }
+  // overlapping positions - union in one window
+  if (shown && visible && SPRITE_Overlap (&before, &after)) {
+    area.xs = (before.xs < after.xs) ? before.xs : after.xs;
+    area.xe = (before.xe > after.xe) ? before.xe : after.xe;
+    area.ys = (before.ys < after.ys) ? before.ys : after.ys;
+    area.ye = (before.ye > after.ye) ? before.ye : after.ye;
+    SPRITE_Compose (layer, &area, index, &before, &after);
+    return;
+  }
+  // background back at old position
+  if (shown) {
+    SPRITE_Compose (layer, &before, index, &before, NULL);
+  }
+  // sprite at new position
+  if (visible) {
+    SPRITE_Compose (layer, &after, index, NULL, &after);
+  }
+}
+
+/**
+ * @desc    Init empty layer with save-under by readback
+ *
+ * @param   SPRITE_Layer * layer
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void SPRITE_Init (SPRITE_Layer *layer, ST7735_Display *lcd)
+{
+  // display
+  layer->lcd = lcd;
+  // no sprite
+  layer->count = 0;
+  // readback
+  layer->background = NULL;
+  layer->context = NULL;
+  // traffic
+  layer->stats.updates = 0;
+  layer->stats.windows = 0;
+  layer->stats.pixels = 0;
+  layer->stats.bytes = 0;
+}
+
+/**
+ * @desc    Rasterizer of background, NULL - save-under by readback
+ *          Set before any sprite is shown
+ *
+ * @param   SPRITE_Layer * layer
+ * @param   SCAN_Raster rasterizer
+ * @param   void * context of rasterizer
+ *
+ * @return  void
+ */
+void SPRITE_SetBackground (SPRITE_Layer *layer, SCAN_Raster background, void *context)
+{
+  // generator of background
+  layer->background = background;
+  layer->context = context;
+}
+
+/**
+ * @desc    Add hidden sprite on top of layer
+ *
+ * @param   SPRITE_Layer * layer
+ * @param   SPRITE_Sprite * sprite
+ * @param   const uint8_t * bitmap RGB565 MSB first
+ * @param   uint8_t width
+ * @param   uint8_t height
+ * @param   uint16_t transparent color
+ *
+ * @return  uint8_t
+ */
+uint8_t SPRITE_Add (SPRITE_Layer *layer, SPRITE_Sprite *sprite, const uint8_t *bitmap, uint8_t width, uint8_t height, uint16_t key)
+{
+  // layer full or sprite too big
+  if ((layer->count >= SPRITE_COUNT) ||
+      (width == 0) || (width > SPRITE_SIZE) ||
+      (height == 0) || (height > SPRITE_SIZE)) {
+    return ST7735_ERROR;
+  }
+  // bitmap
+  sprite->bitmap = bitmap;
+  sprite->width = width;
+  sprite->height = height;
+  sprite->key = key;
+  // hidden
+  sprite->x = 0;
+  sprite->y = 0;
+  sprite->visible = 0;
+  // on top
+  layer->sprites[layer->count++] = sprite;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Show sprite at position
+ *
+ * @param   SPRITE_Layer * layer
+ * @param   SPRITE_Sprite * sprite
+ * @param   int16_t x
+ * @param   int16_t y
+ *
+ * @return  void
+ */
+void SPRITE_Show (SPRITE_Layer *layer, SPRITE_Sprite *sprite, int16_t x, int16_t y)
+{
+  // visible at position
+  SPRITE_Update (layer, sprite, 1, x, y);
+}
+
+/**
+ * @desc    Hide sprite, background restored
+ *
+ * @param   SPRITE_Layer * layer
+ * @param   SPRITE_Sprite * sprite
+ *
+ * @return  void
+ */
+void SPRITE_Hide (SPRITE_Layer *layer, SPRITE_Sprite *sprite)
+{
+  // hidden at same position
+  SPRITE_Update (layer, sprite, 0, sprite->x, sprite->y);
+}
+
+/**
+ * @desc    Move sprite, hidden sprite only changes position
+ *
+ * @param   SPRITE_Layer * layer
+ * @param   SPRITE_Sprite * sprite
+ * @param   int16_t x
+ * @param   int16_t y
+ *
+ * @return  void
+ */
+void SPRITE_Move (SPRITE_Layer *layer, SPRITE_Sprite *sprite, int16_t x, int16_t y)
+{
+  // same visibility
+  SPRITE_Update (layer, sprite, sprite->visible, x, y);
+}
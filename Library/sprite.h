@@ -0,0 +1,159 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Sprite Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        sprite.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      gram.h, scan.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Layer of small sprites over static background without framebuffer. Background
+ *              under sprite is kept in save-under buffer captured by GRAM readback or made
+ *              again by rasterizer of background (SCAN_Raster). Old and new position of moved
+ *              sprite overlapping each other are composed once in union rectangle and sent in
+ *              one window, so sprite never disappears from screen.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __SPRITE_H__
+#define __SPRITE_H__
+
+  #include "gram.h"
+  #include "scan.h"
+
+  // Sprites
+  // -----------------------------------
+  #ifndef SPRITE_SIZE
+    #define SPRITE_SIZE         16                // max pixels of sprite side
+  #endif
+  #ifndef SPRITE_COUNT
+    #define SPRITE_COUNT        8                 // max sprites of layer
+  #endif
+  #define SPRITE_KEY            0xF81F            // magenta, usual transparent color
+  #define SPRITE_UNDER          (SPRITE_SIZE * SPRITE_SIZE * 2)                   // bytes of save-under
+  #define SPRITE_WORK           ((2 * SPRITE_SIZE - 1) * (2 * SPRITE_SIZE - 1) * 2) // bytes of union
+
+  /** @struct Traffic since init */
+  typedef struct {
+    // calls of show, hide and move
+    uint32_t updates;
+    // composed rectangles - one per overlapping move, two per jump
+    uint32_t windows;
+    // sent pixels
+    uint32_t pixels;
+    // bytes on bus - readback and writes
+    uint32_t bytes;
+  } SPRITE_Stats;
+
+  /** @struct Sprite */
+  typedef struct {
+    // RGB565 MSB first, row by row
+    const uint8_t *bitmap;
+    // size, max SPRITE_SIZE
+    uint8_t width;
+    uint8_t height;
+    // transparent color of bitmap
+    uint16_t key;
+    // position of top left corner, may lie off screen
+    int16_t x;
+    int16_t y;
+    // shown on display
+    uint8_t visible;
+    // background under sprite, row by row of sprite - readback only
+    uint8_t under[SPRITE_UNDER];
+  } SPRITE_Sprite;
+
+  /** @struct Layer of sprites */
+  typedef struct {
+    // display
+    ST7735_Display *lcd;
+    // sprites, last on top
+    SPRITE_Sprite *sprites[SPRITE_COUNT];
+    uint8_t count;
+    // rasterizer of background, NULL - save-under by readback
+    SCAN_Raster background;
+    void *context;
+    // union rectangle read, composed and written back - readback only
+    uint8_t work[SPRITE_WORK];
+    // traffic
+    SPRITE_Stats stats;
+  } SPRITE_Layer;
+
+  /**
+   * @desc    Init empty layer with save-under by readback
+   *
+   * @param   SPRITE_Layer * layer
+   * @param   ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void SPRITE_Init (SPRITE_Layer *, ST7735_Display *);
+
+  /**
+   * @desc    Rasterizer of background, NULL - save-under by readback
+   *          Set before any sprite is shown
+   *
+   * @param   SPRITE_Layer * layer
+   * @param   SCAN_Raster rasterizer
+   * @param   void * context of rasterizer
+   *
+   * @return  void
+   */
+  void SPRITE_SetBackground (SPRITE_Layer *, SCAN_Raster, void *);
+
+  /**
+   * @desc    Add hidden sprite on top of layer
+   *
+   * @param   SPRITE_Layer * layer
+   * @param   SPRITE_Sprite * sprite
+   * @param   const uint8_t * bitmap RGB565 MSB first
+   * @param   uint8_t width
+   * @param   uint8_t height
+   * @param   uint16_t transparent color
+   *
+   * @return  uint8_t
+   */
+  uint8_t SPRITE_Add (SPRITE_Layer *, SPRITE_Sprite *, const uint8_t *, uint8_t, uint8_t, uint16_t);
+
+  /**
+   * @desc    Show sprite at position
+   *
+   * @param   SPRITE_Layer * layer
+   * @param   SPRITE_Sprite * sprite
+   * @param   int16_t x
+   * @param   int16_t y
+   *
+   * @return  void
+   */
+  void SPRITE_Show (SPRITE_Layer *, SPRITE_Sprite *, int16_t, int16_t);
+
+  /**
+   * @desc    Hide sprite, background restored
+   *
+   * @param   SPRITE_Layer * layer
+   * @param   SPRITE_Sprite * sprite
+   *
+   * @return  void
+   */
+  void SPRITE_Hide (SPRITE_Layer *, SPRITE_Sprite *);
+
+  /**
+   * @desc    Move sprite, hidden sprite only changes position
+   *
+   * @param   SPRITE_Layer * layer
+   * @param   SPRITE_Sprite * sprite
+   * @param   int16_t x
+   * @param   int16_t y
+   *
+   * @return  void
+   */
+  void SPRITE_Move (SPRITE_Layer *, SPRITE_Sprite *, int16_t, int16_t);
+
+#endif
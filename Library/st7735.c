@@ -12,9 +12,12 @@
  * @version     1.0
  * @tested      stm32f103c6t8
  *
- * @depend      spi.h, font.h, st7735.h, libdelay.h
+ * @depend      spi.h, spibus.h, font.h, st7735.h, libdelay.h
  * --------------------------------------------------------------------------------------------+
- * @descr       1.0 - C library for driving only one LCD 1.8" with st7735 driver
+ * @descr       1.0 - C library for driving LCD 1.8" with st7735 driver
+ *              1.1 - display context, more displays on SPI1 / SPI2
+ *              1.2 - displays share SPI with other devices through bus manager
+ *              1.3 - 12 bit pixel format, RGB444 packed 2 pixels in 3 bytes
  * @note        Before calling function Delay_Ms() must be called function Delay_Init()
  * --------------------------------------------------------------------------------------------+
  * @inspir      http://www.displayfuture.com/Display/datasheet/controller/ST7735.pdf
@@ -23,7 +26,10 @@
  */
 
 /** @includes */
+#include <string.h>
 #include "st7735.h"
+#include "dlist.h"
+#include "canvas.h"
 
 /** @array Init command */
 const uint8_t INIT_ST7735B[] = {
@@ -70,7 +76,7 @@ const uint8_t INIT_ST7735B[] = {
   //  MH: horizontal refresh order 
   //      0 -> refresh left to right 
   //      1 -> refresh right to left
-  // 0xA0 = 1010 0000
+  // 0xA0 = 1010 0000 -> ROTATE_0, changed at runtime by ST7735_SetRotation
   // 0x36
   1,   0, MADCTL, 0xA0,
   // 0x29 Main screen turn on
@@ -78,33 +84,78 @@ const uint8_t INIT_ST7735B[] = {
   // ---------------------------------------
 };
 
-/** @var array Chache memory char index row */
-unsigned short int cacheMemIndexRow = 0;
-/** @var array Chache memory char index column */
-unsigned short int cacheMemIndexCol = 0;
+/** @def Outcodes of Cohen-Sutherland clipping */
+#define CLIP_LEFT               0x01
+#define CLIP_RIGHT              0x02
+#define CLIP_TOP                0x04
+#define CLIP_BOTTOM             0x08
+
+/** @array MADCTL values of rotations */
+static const uint8_t MADCTL_ROTATION[] = {
+  // ROTATE_0 - begin left-down corner, up-down
+  MADCTL_MY | MADCTL_MV,
+  // ROTATE_90 - begin left-up corner, left-right
+  0x00,
+  // ROTATE_180 - begin right-up corner, down-up
+  MADCTL_MX | MADCTL_MV,
+  // ROTATE_270 - begin right-down corner, right-left
+  MADCTL_MX | MADCTL_MY
+};
 
 /**
- * @desc    Init pins
+ * @desc    Font columns of character, out of range characters as space
  *
- * @param   GPIO_TypeDef
+ * @param   char character
+ *
+ * @return  const uint8_t *
+ */
+static const uint8_t * ST7735_Font (char character)
+{
+  // check if character is out of range
+  if (((uint8_t) character < 0x20) ||
+      ((uint8_t) character > 0x7f)) {
+    // space
+    return FONTS[0];
+  }
+  // columns of character
+  return FONTS[(uint8_t) character - 32];
+}
+
+/**
+ * @desc    Init pin as output
+ *
+ * @param   const ST7735_Pin * pin
  *
  * @return  void
  */
-void ST7735_Pins_Init (GPIO_TypeDef *GPIOx)
+static void ST7735_Pin_Init (const ST7735_Pin *pin)
 {
+  // variables
+  volatile uint32_t *cr;
+  uint8_t shift = 0;
+
   // GPIOA
   // ----------------------------
-  if (GPIOx == GPIOA) {
+  if (pin->port == GPIOA) {
     // enable clock for corresponding GPIOA
     SET_BIT (RCC->APB2ENR, RCC_APB2ENR_IOPAEN);
-    
+
   // GPIOB
-  // ----------------------------    
-  } else if (GPIOx == GPIOB) {
+  // ----------------------------
+  } else if (pin->port == GPIOB) {
     // enable clock for corresponding GPIOB
     SET_BIT (RCC->APB2ENR, RCC_APB2ENR_IOPBEN);
   }
- 
+
+  // pin number from mask
+  while (!(pin->pin & (1 << shift))) {
+    shift++;
+  }
+  // pins 0 - 7 in CRL, pins 8 - 15 in CRH
+  cr = (shift < 8) ? &pin->port->CRL : &pin->port->CRH;
+  // 4 bits per pin
+  shift = (shift & 0x07) << 2;
+
   // ----------------------------
   // CNF[1:0] = 00 -> Push pull  / GENERAL PURPOSE OUTPUT - MODE[1:0] = 01; 10; 11
   // CNF[1:0] = 01 -> Open drain / GENERAL PURPOSE OUTPUT - MODE[1:0] = 01; 10; 11
@@ -117,23 +168,34 @@ void ST7735_Pins_Init (GPIO_TypeDef *GPIOx)
   // ----------------------------
   //
   // null corresponding bits
-  GPIOx->CRL &= ~(GPIO_CRL_MODE1 | GPIO_CRL_CNF1 | GPIO_CRL_MODE2 | GPIO_CRL_CNF2 | GPIO_CRL_MODE3 | GPIO_CRL_CNF3);
-  
-  // RES - GPIOA.Pin_1 - GENERAL PURPOSE OUTPUT / Push pull
-  // DC -  GPIOA.Pin_2 - GENERAL PURPOSE OUTPUT / Push pull
-  // BL  - GPIOA.Pin_3 - GENERAL PURPOSE OUTPUT / Push pull
-  // ----------------------------
-  // 
-  // GENERAL PURPOSE OUTPUT / Push pull
-  // GPIOx->CRL &= ~(GPIO_CRL_CNF1 | GPIO_CRL_CNF2 | GPIO_CRL_CNF3);
+  *cr &= ~(0x0F << shift);
 
   // MODE[1:0] = 01 // 10 MHz
   // MODE[1:0] = 10 //  2 MHz
   // MODE[1:0] = 11 // 50 MHz
   // ----------------------------
-  // 
-  // speed 2 MHz
-  GPIOx->CRL |= (GPIO_CRL_MODE1_1 | GPIO_CRL_MODE2_1 | GPIO_CRL_MODE3_1);
+  //
+  // GENERAL PURPOSE OUTPUT / Push pull, speed 2 MHz
+  *cr |= (0x02 << shift);
+}
+
+/**
+ * @desc    Init pins
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void ST7735_Pins_Init (ST7735_Display *lcd)
+{
+  // RES - GENERAL PURPOSE OUTPUT / Push pull
+  ST7735_Pin_Init (&lcd->res);
+  // DC  - GENERAL PURPOSE OUTPUT / Push pull
+  ST7735_Pin_Init (&lcd->dc);
+  // BL  - GENERAL PURPOSE OUTPUT / Push pull
+  ST7735_Pin_Init (&lcd->bl);
+  // CS  - GENERAL PURPOSE OUTPUT / Push pull, idle high
+  SPIBUS_Device_Init (&lcd->device);
 }
 
 /**
@@ -167,11 +229,11 @@ void ST7735_Pin_Low (GPIO_TypeDef *GPIOx, uint16_t pin)
 /**
  * @desc    Hardware Reset
  *
- * @param   void
+ * @param   ST7735_Display * lcd
  *
  * @return  void
  */
-void ST7735_Reset (void)
+void ST7735_Reset (ST7735_Display *lcd)
 {
   // Rseset Impulse shape with times
   // _____________              _____
@@ -181,61 +243,92 @@ void ST7735_Reset (void)
   // |<- 200 ms ->|<- 200 ms ->|
   // -------------------------------
   // set HW high
-  ST7735_Pin_High (GPIOA, ST7735_RES);
+  ST7735_Pin_High (lcd->res.port, lcd->res.pin);
   // delay 200 ms
   Delay_Ms (200);
   // set HW low
-  ST7735_Pin_Low (GPIOA, ST7735_RES);
+  ST7735_Pin_Low (lcd->res.port, lcd->res.pin);
   // delay 200 ms
   Delay_Ms (200);
   // set HW high
-  ST7735_Pin_High (GPIOA, ST7735_RES);
+  ST7735_Pin_High (lcd->res.port, lcd->res.pin);
 }
 
 /**
  * @desc    Init SPI communication
  *
- * @param   SPI_TypeDef *SPIx
+ * @param   ST7735_Display * lcd
  *
  * @return  void
  */
-void ST7735_Spi_Init (SPI_TypeDef *SPIx)
+void ST7735_Spi_Init (ST7735_Display *lcd)
 {
-  // init SPI Master
-  SPI_Master_Init (SPIx);
+  // init SPI Master, once per bus
+  SPIBUS_Init (lcd->bus);
 }
 
 /**
  * @desc    Init st7735 driver
+ *          Pins and SPI instance must be filled in, e.g. ST7735_DISPLAY_SPI1
  *
- * @param   SPI_TypeDef *SPIx
+ * @param   ST7735_Display * lcd
  *
  * @return  void
  */
-void ST7735_Init (SPI_TypeDef *SPIx)
+void ST7735_Init (ST7735_Display *lcd)
 {
+  // geometry of ROTATE_0
+  lcd->width = MAX_X;
+  lcd->height = MAX_Y;
+  lcd->madctl = MADCTL_ROTATION[ROTATE_0];
+  // cursor to left-up corner
+  lcd->col = 0;
+  lcd->row = 0;
+  // not recording
+  lcd->record = NULL;
+  // no burst in progress
+  lcd->xfer.state = SPIBUS_DONE;
+  lcd->xfer.done = NULL;
+  lcd->fill[0].state = SPIBUS_DONE;
+  lcd->fill[0].done = NULL;
+  lcd->fill[1].state = SPIBUS_DONE;
+  lcd->fill[1].done = NULL;
+  lcd->xfer.repeat = 0;
+  lcd->fill[0].repeat = 0;
+  lcd->fill[1].repeat = 0;
+  lcd->fence = 0;
+  lcd->bytes = 0;
+  // RGB565 set by init sequence
+  lcd->colmod = ST7735_COLMOD_16;
+  lcd->pending = 0;
+  // window unknown
+  ST7735_InvalidateWindow (lcd);
+  // draw on whole screen
+  ST7735_Clip_Reset (lcd);
+
   // init delay
   Delay_Init (); 
   // init pins
-  ST7735_Pins_Init (GPIOA);
+  ST7735_Pins_Init (lcd);
   // set backlight ON
-  ST7735_Pin_High (GPIOA, ST7735_BL);
+  ST7735_Pin_High (lcd->bl.port, lcd->bl.pin);
   // init spi
-  ST7735_Spi_Init (SPIx);
+  ST7735_Spi_Init (lcd);
   // hardware reset
-  ST7735_Reset ();
+  ST7735_Reset (lcd);
   // initial seqeunce list
-  ST7735_Init_Seq (INIT_ST7735B);
+  ST7735_Init_Seq (lcd, INIT_ST7735B);
 }
 
 /**
  * @desc    Init sequence
  *
+ * @param   ST7735_Display * lcd
  * @param   const uint8_t*
  *
  * @return  void
  */
-void ST7735_Init_Seq (const uint8_t *initializers)
+void ST7735_Init_Seq (ST7735_Display *lcd, const uint8_t *initializers)
 {
   uint8_t i = 0;
   uint8_t command;
@@ -252,11 +345,11 @@ void ST7735_Init_Seq (const uint8_t *initializers)
     // 3th arg - command
     command = initializers[i++];
     // send command
-    ST7735_Command (command);
+    ST7735_Command (lcd, command);
     // send arguments
     while (num_of_arguments--) {
       // send argument
-      ST7735_Data8b (initializers[i++]);
+      ST7735_Data8b (lcd, initializers[i++]);
     }
     // delay
     Delay_Ms (delay_in_ms);
@@ -264,66 +357,681 @@ void ST7735_Init_Seq (const uint8_t *initializers)
 
 }
 
+/**
+ * @desc    Set rotation and mirroring, swaps logical width / height
+ *          Panel scans memory in rotated order, so drawing costs nothing extra
+ *
+ * @param   ST7735_Display * lcd
+ * @param   enum Rotation (ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270)
+ * @param   uint8_t mirror - 1 mirrored x axis, 0 normal
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_SetRotation (ST7735_Display *lcd, enum Rotation rotation, uint8_t mirror)
+{
+  // variables
+  uint8_t madctl;
+
+  // check if rotation is out of range
+  if (rotation > ROTATE_270) {
+    // out of range
+    return ST7735_ERROR;
+  }
+  // memory access order
+  madctl = MADCTL_ROTATION[rotation];
+  // logical x axis is row address when MV = 1, otherwise column address
+  if (mirror) {
+    madctl ^= (madctl & MADCTL_MV) ? MADCTL_MY : MADCTL_MX;
+  }
+  // memory data access control
+  ST7735_Command (lcd, MADCTL);
+  ST7735_Data8b (lcd, madctl);
+  lcd->madctl = madctl;
+
+  // swap width and height for portrait
+  if (rotation & 0x01) {
+    lcd->width = MAX_Y;
+    lcd->height = MAX_X;
+  } else {
+    lcd->width = MAX_X;
+    lcd->height = MAX_Y;
+  }
+  // cursor to left-up corner
+  lcd->col = 0;
+  lcd->row = 0;
+  // window coordinates changed meaning
+  ST7735_InvalidateWindow (lcd);
+  // clip rectangles too
+  ST7735_Clip_Reset (lcd);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Set pixel format, colors of API stay RGB565
+ *          12 bit sends 2 pixels in 3 bytes, RGB565 converted to RGB444
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint8_t ST7735_COLMOD_16 / ST7735_COLMOD_12
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_SetColorMode (ST7735_Display *lcd, uint8_t colmod)
+{
+  // unknown format, recorded list would not switch packing on replay
+  if (((colmod != ST7735_COLMOD_16) && (colmod != ST7735_COLMOD_12)) ||
+      (lcd->record != NULL)) {
+    // not supported
+    return ST7735_ERROR;
+  }
+  // interface pixel format, finishes waiting pixel
+  ST7735_Command (lcd, COLMOD);
+  ST7735_Data8b (lcd, colmod);
+  // packing of next pixels
+  lcd->colmod = colmod;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Hardware scroll of columns xs - xe, only rotations with x along memory rows
+ *          Scroll area is range of memory rows, whole height of columns is moved
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint8_t x start of scrolled columns
+ * @param   uint8_t x end of scrolled columns
+ * @param   uint8_t offset - column xs + i shows content of xs + (i + offset) % width
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_Scroll (ST7735_Display *lcd, uint8_t xs, uint8_t xe, uint8_t offset)
+{
+  // variables
+  uint16_t vsa = xe - xs + 1;
+  uint16_t tfa;
+  uint16_t ssa;
+
+  // panel scrolls memory rows, x must be row address
+  if (!(lcd->madctl & MADCTL_MV) ||
+      (xs > xe) ||
+      (xe > (lcd->width - 1)) ||
+      (offset >= vsa)) {
+    // not supported
+    return ST7735_ERROR;
+  }
+  // mirrored rows - xe is first memory row, scrolled opposite way
+  if (lcd->madctl & MADCTL_MY) {
+    tfa = MEMORY_ROWS - 1 - xe;
+    ssa = tfa + (vsa - offset) % vsa;
+  } else {
+    tfa = xs;
+    ssa = tfa + offset;
+  }
+  // top fixed, scrolled and bottom fixed rows
+  ST7735_Command (lcd, VSCRDEF);
+  ST7735_Data16b (lcd, tfa);
+  ST7735_Data16b (lcd, vsa);
+  ST7735_Data16b (lcd, MEMORY_ROWS - tfa - vsa);
+  // memory row shown as first row of scrolled area
+  ST7735_Command (lcd, VSCRSADD);
+  ST7735_Data16b (lcd, ssa);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Leave hardware scroll, content shown as written
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void ST7735_Scroll_Stop (ST7735_Display *lcd)
+{
+  // normal display mode ends scroll
+  ST7735_Command (lcd, NORON);
+}
+
+/**
+ * @desc    Queue bytes of burst by DMA, waits only for previous buffer
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const uint8_t * buffer
+ * @param   uint16_t number of bytes
+ *
+ * @return  void
+ */
+static void ST7735_Send (ST7735_Display *lcd, const uint8_t *buffer, uint16_t count)
+{
+  // wait for previous buffer
+  SPIBUS_Wait (&lcd->xfer);
+  // transaction of display
+  lcd->xfer.device = &lcd->device;
+  lcd->xfer.buffer = buffer;
+  lcd->xfer.count = count;
+  lcd->xfer.flags = SPI_DMA_MINC;
+  // queue, other devices may be served between buffers
+  lcd->fence = SPIBUS_Submit (lcd->bus, &lcd->xfer);
+  // traffic
+  lcd->bytes += count;
+}
+
+/**
+ * @desc    12 bit - first pixel of pair waits, whole pair sent by DMA
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint16_t pixel RGB444
+ *
+ * @return  void
+ */
+static void ST7735_Pair (ST7735_Display *lcd, uint16_t pixel)
+{
+  // first of pair
+  if (!lcd->pending) {
+    // wait for second one
+    lcd->held = pixel;
+    lcd->pending = 1;
+    return;
+  }
+  // previous pair sent
+  SPIBUS_Wait (&lcd->xfer);
+  // RRRRGGGG BBBBRRRR GGGGBBBB
+  lcd->pair[0] = (uint8_t) (lcd->held >> 4);
+  lcd->pair[1] = (uint8_t) ((lcd->held << 4) | (pixel >> 8));
+  lcd->pair[2] = (uint8_t) pixel;
+  lcd->pending = 0;
+  // send
+  ST7735_Send (lcd, lcd->pair, 3);
+}
+
+/**
+ * @desc    Write pixel of burst, 16 bit polled, 12 bit by pairs
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint16_t color RGB565
+ *
+ * @return  void
+ */
+static void ST7735_Pixel (ST7735_Display *lcd, uint16_t color)
+{
+  // 12 bit - recorded list stays RGB565
+  if ((lcd->colmod == ST7735_COLMOD_12) && (lcd->record == NULL)) {
+    ST7735_Pair (lcd, ST7735_RGB444 (color));
+  // 16 bit
+  } else {
+    ST7735_Data16b (lcd, color);
+  }
+}
+
+/**
+ * @desc    12 bit - send waiting pixel alone, panel writes it after 12 bits
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+static void ST7735_Pair_Flush (ST7735_Display *lcd)
+{
+  // no pixel waits
+  if (!lcd->pending) {
+    return;
+  }
+  // previous pair sent
+  SPIBUS_Wait (&lcd->xfer);
+  // RRRRGGGG BBBB, rest of byte ignored
+  lcd->pair[0] = (uint8_t) (lcd->held >> 4);
+  lcd->pair[1] = (uint8_t) (lcd->held << 4);
+  lcd->pending = 0;
+  // send
+  ST7735_Send (lcd, lcd->pair, 2);
+}
+
+/**
+ * @desc    12 bit - pack RGB565 pixels into pairs, waiting pixel goes first
+ *          Next pixel is read before pair is written, so packing in place
+ *          never overtakes source
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint8_t * packed
+ * @param   const uint8_t * pixels RGB565 MSB first
+ * @param   uint16_t number of pixels
+ *
+ * @return  uint16_t bytes of packed pairs
+ */
+static uint16_t ST7735_Pack (ST7735_Display *lcd, uint8_t *packed, const uint8_t *pixels, uint16_t count)
+{
+  // variables
+  uint8_t *start = packed;
+  uint16_t pixel;
+  uint16_t next;
+
+  // nothing to pack
+  if (count == 0) {
+    return 0;
+  }
+  // first pixel
+  next = ST7735_RGB444 (((uint16_t) pixels[0] << 8) | pixels[1]);
+  // loop through pixels
+  while (count--) {
+    // current pixel
+    pixel = next;
+    pixels += 2;
+    // read ahead
+    if (count > 0) {
+      next = ST7735_RGB444 (((uint16_t) pixels[0] << 8) | pixels[1]);
+    }
+    // first of pair waits
+    if (!lcd->pending) {
+      lcd->held = pixel;
+      lcd->pending = 1;
+    // RRRRGGGG BBBBRRRR GGGGBBBB
+    } else {
+      *packed++ = (uint8_t) (lcd->held >> 4);
+      *packed++ = (uint8_t) ((lcd->held << 4) | (pixel >> 8));
+      *packed++ = (uint8_t) pixel;
+      lcd->pending = 0;
+    }
+  }
+
+  // packed bytes
+  return packed - start;
+}
+
+/**
+ * @desc    12 bit - solid fill by DMA from pattern of pixel pairs
+ *          Gray has all bytes of pair equal - one byte repeated without
+ *          memory increment, otherwise pattern buffer repeated by bus
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint16_t pixel RGB444
+ * @param   uint32_t number of pixels
+ *
+ * @return  uint32_t fence
+ */
+static uint32_t ST7735_Fill_Packed (ST7735_Display *lcd, uint16_t pixel, uint32_t count)
+{
+  // variables
+  SPIBUS_Transaction *fill;
+  uint32_t bytes;
+  uint32_t sent;
+  uint16_t i;
+  uint8_t slot = 0;
+  uint8_t gray;
+  uint8_t odd;
+
+  // waiting pixel completes first pair
+  if (lcd->pending && (count > 0)) {
+    ST7735_Pair (lcd, pixel);
+    count--;
+  }
+  // last pixel of odd count waits for next span
+  odd = count & 1;
+  bytes = (count >> 1) * 3;
+  // previous fills read pattern
+  SPIBUS_Wait (&lcd->fill[0]);
+  SPIBUS_Wait (&lcd->fill[1]);
+  // pairs RRRRGGGG BBBBRRRR GGGGBBBB
+  for (i = 0; i < ST7735_PATTERN_SIZE; i += 3) {
+    lcd->pattern[i] = (uint8_t) (pixel >> 4);
+    lcd->pattern[i + 1] = (uint8_t) ((pixel << 4) | (pixel >> 8));
+    lcd->pattern[i + 2] = (uint8_t) pixel;
+  }
+  // same byte repeated
+  gray = (lcd->pattern[0] == lcd->pattern[1]) && (lcd->pattern[1] == lcd->pattern[2]);
+
+  // loop through chunks
+  while (bytes > 0) {
+    // transaction, previous use finished
+    fill = &lcd->fill[slot];
+    SPIBUS_Wait (fill);
+    fill->device = &lcd->device;
+    fill->buffer = lcd->pattern;
+    // one byte, max ST7735_FILL_MAX times
+    if (gray) {
+      fill->count = (bytes > ST7735_FILL_MAX) ? ST7735_FILL_MAX : bytes;
+      fill->repeat = 0;
+      fill->flags = 0;
+    // whole patterns, max ST7735_FILL_MAX + 1 times
+    } else if (bytes >= ST7735_PATTERN_SIZE) {
+      sent = bytes / ST7735_PATTERN_SIZE;
+      fill->count = ST7735_PATTERN_SIZE;
+      fill->repeat = (sent > ST7735_FILL_MAX) ? ST7735_FILL_MAX : (sent - 1);
+      fill->flags = SPI_DMA_MINC;
+    // rest of pattern
+    } else {
+      fill->count = bytes;
+      fill->repeat = 0;
+      fill->flags = SPI_DMA_MINC;
+    }
+    // bytes of transaction, repeat consumed by interrupt
+    sent = (uint32_t) fill->count * (fill->repeat + 1);
+    // queue, chained by interrupt
+    lcd->fence = SPIBUS_Submit (lcd->bus, fill);
+    lcd->bytes += sent;
+    // rest
+    bytes -= sent;
+    // other slot
+    slot ^= 1;
+  }
+  // odd pixel waits
+  if (odd) {
+    lcd->held = pixel;
+    lcd->pending = 1;
+  }
+
+  // fence of last chunk
+  return lcd->fence;
+}
+
+/**
+ * @desc    Wait for DMA burst of display
+ *          12 bit - waiting pixel sent first
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void ST7735_Sync (ST7735_Display *lcd)
+{
+  // last pixel of burst
+  ST7735_Pair_Flush (lcd);
+  // wait for last buffer / fill
+  SPIBUS_Fence_Wait (lcd->bus, lcd->fence);
+}
+
+/**
+ * @desc    Forget cached window, next SetWindow sends CASET / RASET
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void ST7735_InvalidateWindow (ST7735_Display *lcd)
+{
+  // empty window never matches
+  lcd->window.xs = 1;
+  lcd->window.xe = 0;
+}
+
+/**
+ * @desc    Clip to whole screen, empty stack
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void ST7735_Clip_Reset (ST7735_Display *lcd)
+{
+  // whole screen
+  lcd->clip.xs = 0;
+  lcd->clip.xe = lcd->width - 1;
+  lcd->clip.ys = 0;
+  lcd->clip.ye = lcd->height - 1;
+  // nothing saved
+  lcd->clipDepth = 0;
+}
+
+/**
+ * @desc    Save clip rectangle and intersect it with new one
+ *          Nested panels can only shrink drawing area
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const ST7735_Rect * rectangle
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_Clip_Push (ST7735_Display *lcd, const ST7735_Rect *rect)
+{
+  // stack full
+  if (lcd->clipDepth >= ST7735_CLIP_DEPTH) {
+    return ST7735_ERROR;
+  }
+  // save current
+  lcd->clipStack[lcd->clipDepth++] = lcd->clip;
+  // intersection, may be empty - everything clipped
+  if (lcd->clip.xs < rect->xs) lcd->clip.xs = rect->xs;
+  if (lcd->clip.xe > rect->xe) lcd->clip.xe = rect->xe;
+  if (lcd->clip.ys < rect->ys) lcd->clip.ys = rect->ys;
+  if (lcd->clip.ye > rect->ye) lcd->clip.ye = rect->ye;
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Restore previous clip rectangle
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_Clip_Pop (ST7735_Display *lcd)
+{
+  // stack empty
+  if (lcd->clipDepth == 0) {
+    return ST7735_ERROR;
+  }
+  // restore
+  lcd->clip = lcd->clipStack[--lcd->clipDepth];
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Intersect rectangle with clip rectangle
+ *
+ * @param   ST7735_Display * lcd
+ * @param   ST7735_Rect * rectangle, clipped in place
+ *
+ * @return  uint8_t ST7735_ERROR if nothing visible
+ */
+uint8_t ST7735_Clip_Rect (ST7735_Display *lcd, ST7735_Rect *rect)
+{
+  // intersection
+  if (rect->xs < lcd->clip.xs) rect->xs = lcd->clip.xs;
+  if (rect->xe > lcd->clip.xe) rect->xe = lcd->clip.xe;
+  if (rect->ys < lcd->clip.ys) rect->ys = lcd->clip.ys;
+  if (rect->ye > lcd->clip.ye) rect->ye = lcd->clip.ye;
+  // fully clipped
+  if ((rect->xs > rect->xe) || (rect->ys > rect->ye)) {
+    return ST7735_ERROR;
+  }
+
+  // visible
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Outcode of point - position relative to clip rectangle
+ *
+ * @param   const ST7735_Rect * clip
+ * @param   int16_t x
+ * @param   int16_t y
+ *
+ * @return  uint8_t
+ */
+static uint8_t ST7735_Clip_Code (const ST7735_Rect *clip, int16_t x, int16_t y)
+{
+  // variables
+  uint8_t code = 0;
+
+  // horizontal
+  if (x < clip->xs) {
+    code |= CLIP_LEFT;
+  } else if (x > clip->xe) {
+    code |= CLIP_RIGHT;
+  }
+  // vertical
+  if (y < clip->ys) {
+    code |= CLIP_TOP;
+  } else if (y > clip->ye) {
+    code |= CLIP_BOTTOM;
+  }
+
+  // outcode
+  return code;
+}
+
+/**
+ * @desc    Clip line by Cohen-Sutherland algorithm
+ * @surce   https://en.wikipedia.org/wiki/Cohen%E2%80%93Sutherland_algorithm
+ *
+ * @param   ST7735_Display * lcd
+ * @param   int16_t * x start position
+ * @param   int16_t * y start position
+ * @param   int16_t * x end position
+ * @param   int16_t * y end position
+ *
+ * @return  uint8_t ST7735_ERROR if nothing visible
+ */
+uint8_t ST7735_Clip_Line (ST7735_Display *lcd, int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1)
+{
+  // variables
+  const ST7735_Rect *clip = &lcd->clip;
+  uint8_t code0, code1, code;
+  int32_t x, y;
+
+  // empty clip rectangle
+  if ((clip->xs > clip->xe) || (clip->ys > clip->ye)) {
+    return ST7735_ERROR;
+  }
+  // outcodes of end points
+  code0 = ST7735_Clip_Code (clip, *x0, *y0);
+  code1 = ST7735_Clip_Code (clip, *x1, *y1);
+
+  // loop till trivially accepted or rejected
+  while (code0 | code1) {
+    // both points on the same outer side
+    if (code0 & code1) {
+      return ST7735_ERROR;
+    }
+    // outer point
+    code = code0 ? code0 : code1;
+    // intersection with edge
+    if (code & CLIP_TOP) {
+      x = *x0 + (int32_t) (*x1 - *x0) * (clip->ys - *y0) / (*y1 - *y0);
+      y = clip->ys;
+    } else if (code & CLIP_BOTTOM) {
+      x = *x0 + (int32_t) (*x1 - *x0) * (clip->ye - *y0) / (*y1 - *y0);
+      y = clip->ye;
+    } else if (code & CLIP_RIGHT) {
+      y = *y0 + (int32_t) (*y1 - *y0) * (clip->xe - *x0) / (*x1 - *x0);
+      x = clip->xe;
+    } else {
+      y = *y0 + (int32_t) (*y1 - *y0) * (clip->xs - *x0) / (*x1 - *x0);
+      x = clip->xs;
+    }
+    // move outer point
+    if (code == code0) {
+      *x0 = x;
+      *y0 = y;
+      code0 = ST7735_Clip_Code (clip, *x0, *y0);
+    } else {
+      *x1 = x;
+      *y1 = y;
+      code1 = ST7735_Clip_Code (clip, *x1, *y1);
+    }
+  }
+
+  // visible part
+  return ST7735_SUCCESS;
+}
+
 /**
  * @desc    Command send
  *
+ * @param   ST7735_Display * lcd
  * @param   uint8_t
  *
  * @return  void
  */
-void ST7735_Command (uint8_t data)
+void ST7735_Command (ST7735_Display *lcd, uint8_t data)
 {
-  // chip enable - active low
-  ST7735_Pin_Low (GPIOA, ST7735_CS);
+  // recording display list
+  if (lcd->record != NULL) {
+    // into list instead of SPI
+    DLIST_Record_Command (lcd->record, data);
+    return;
+  }
+  // finish pending burst
+  ST7735_Sync (lcd);
+  // wait for other devices, chip enable - active low
+  SPIBUS_Claim (lcd->bus, &lcd->device);
   // command (active low)
-  ST7735_Pin_Low (GPIOA, ST7735_DC);
+  ST7735_Pin_Low (lcd->dc.port, lcd->dc.pin);
   // transmitting data
-  SPI_TRX_8b (SPI1, data);
-  // chip disable - idle high
-  ST7735_Pin_High (GPIOA, ST7735_CS);
+  SPI_TRX_8b (lcd->bus->spi, data);
+  // traffic
+  lcd->bytes++;
 }
 
 /**
  * @desc    8bits data send
  *
+ * @param   ST7735_Display * lcd
  * @param   uint8_t
  *
  * @return  void
  */
-void ST7735_Data8b (uint8_t data)
+void ST7735_Data8b (ST7735_Display *lcd, uint8_t data)
 {
-  // chip enable - active low
-  ST7735_Pin_Low (GPIOA, ST7735_CS);
+  // recording display list
+  if (lcd->record != NULL) {
+    // into list instead of SPI
+    DLIST_Record_Data (lcd->record, &data, 1);
+    return;
+  }
+  // finish pending burst
+  ST7735_Sync (lcd);
+  // wait for other devices, chip enable - active low
+  SPIBUS_Claim (lcd->bus, &lcd->device);
   // data (active high)
-  ST7735_Pin_High (GPIOA, ST7735_DC);
+  ST7735_Pin_High (lcd->dc.port, lcd->dc.pin);
   // transmitting data
-  SPI_TRX_8b (SPI1, data);
-  // chip disable - idle high
-  ST7735_Pin_High (GPIOA, ST7735_CS);
+  SPI_TRX_8b (lcd->bus->spi, data);
+  // traffic
+  lcd->bytes++;
 }
 
 /**
  * @desc    16bits data send
  *
+ * @param   ST7735_Display * lcd
  * @param   uint16_t
  *
  * @return  void
  */
-void ST7735_Data16b (uint16_t data)
+void ST7735_Data16b (ST7735_Display *lcd, uint16_t data)
 {
-  // chip enable - active low
-  ST7735_Pin_Low (GPIOA, ST7735_CS);
+  // bytes MSB first for display list
+  uint8_t bytes[2] = { (uint8_t) (data >> 8), (uint8_t) data };
+
+  // recording display list
+  if (lcd->record != NULL) {
+    // into list instead of SPI
+    DLIST_Record_Data (lcd->record, bytes, 2);
+    return;
+  }
+  // finish pending burst
+  ST7735_Sync (lcd);
+  // wait for other devices, chip enable - active low
+  SPIBUS_Claim (lcd->bus, &lcd->device);
   // data (active high)
-  ST7735_Pin_High (GPIOA, ST7735_DC);
+  ST7735_Pin_High (lcd->dc.port, lcd->dc.pin);
   // transmitting data
-  SPI_TRX_16b (SPI1, data);
-  // chip disable - idle high
-  ST7735_Pin_High (GPIOA, ST7735_CS);
+  SPI_TRX_16b (lcd->bus->spi, data);
+  // traffic
+  lcd->bytes += 2;
 }
 
 /**
  * @desc    Set window
  *
+ * @param   ST7735_Display * lcd
  * @param   uint8_t x - start position
  * @param   uint8_t x - end position
  * @param   uint8_t y - start position
@@ -331,29 +1039,45 @@ void ST7735_Data16b (uint16_t data)
  *
  * @return  uint8_t
  */
-uint8_t ST7735_SetWindow (uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1)
+uint8_t ST7735_SetWindow (ST7735_Display *lcd, uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1)
 {
   // check if coordinates is out of range
   if ((x0 > x1)     ||
-      (x1 > SIZE_X) ||
+      (x1 > (lcd->width - 1)) ||
       (y0 > y1)     ||
-      (y1 > SIZE_Y)) { 
+      (y1 > (lcd->height - 1))) { 
     // out of range
     return ST7735_ERROR;
-  }  
+  }
+  // finish pending burst
+  ST7735_Sync (lcd);
+  // same window as last time, CASET / RASET still valid
+  if ((lcd->window.xs == x0) &&
+      (lcd->window.xe == x1) &&
+      (lcd->window.ys == y0) &&
+      (lcd->window.ye == y1)) {
+    // success
+    return ST7735_SUCCESS;
+  }
   // column address set
-  ST7735_Command (CASET);
+  ST7735_Command (lcd, CASET);
   // send start x position
-  ST7735_Data16b (0x0000 | x0);
+  ST7735_Data16b (lcd, 0x0000 | x0);
   // send end x position
-  ST7735_Data16b (0x0000 | x1);
+  ST7735_Data16b (lcd, 0x0000 | x1);
 
   // row address set
-  ST7735_Command (RASET);
+  ST7735_Command (lcd, RASET);
   // send start y position
-  ST7735_Data16b (0x0000 | y0);
+  ST7735_Data16b (lcd, 0x0000 | y0);
   // send end y position
-  ST7735_Data16b (0x0000 | y1);
+  ST7735_Data16b (lcd, 0x0000 | y1);
+
+  // remember window
+  lcd->window.xs = x0;
+  lcd->window.xe = x1;
+  lcd->window.ys = y0;
+  lcd->window.ye = y1;
 
   // success
   return ST7735_SUCCESS;
@@ -362,58 +1086,488 @@ uint8_t ST7735_SetWindow (uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1)
 /**
  * @desc    Write color pixels
  *
+ * @param   ST7735_Display * lcd
  * @param   uint16_t color
- * @param   uint16_t counter
+ * @param   uint32_t counter
  *
  * @return  void
  */
-void ST7735_SendColor565 (uint16_t color, uint16_t count)
+void ST7735_SendColor565 (ST7735_Display *lcd, uint16_t color, uint32_t count)
 {
+  // 12 bit - pairs packed by fill
+  if (lcd->colmod == ST7735_COLMOD_12) {
+    ST7735_Fill (lcd, color, count);
+    return;
+  }
   // access to RAM
-  ST7735_Command (RAMWR);
+  ST7735_Command (lcd, RAMWR);
   // counter
   while (count--) {
     // write color
-    ST7735_Data16b (color);
+    ST7735_Data16b (lcd, color);
+  }
+}
+
+/**
+ * @desc    Solid fill of current window by DMA, returns immediately
+ *          16 bit frame, one color repeated without memory increment,
+ *          split into transactions of max ST7735_FILL_MAX pixels
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint16_t color
+ * @param   uint32_t number of pixels
+ *
+ * @return  uint32_t fence
+ */
+uint32_t ST7735_Fill (ST7735_Display *lcd, uint16_t color, uint32_t count)
+{
+  // access to RAM
+  ST7735_Burst_Begin (lcd);
+  // whole count in burst
+  ST7735_Burst_Fill (lcd, color, count);
+  // 12 bit - odd last pixel
+  ST7735_Burst_End (lcd);
+
+  // fence of last chunk
+  return lcd->fence;
+}
+
+/**
+ * @desc    Solid fill inside RAM write burst by DMA, returns immediately
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint16_t color
+ * @param   uint32_t number of pixels
+ *
+ * @return  uint32_t fence
+ */
+uint32_t ST7735_Burst_Fill (ST7735_Display *lcd, uint16_t color, uint32_t count)
+{
+  // variables
+  SPIBUS_Transaction *fill;
+  uint8_t slot = 0;
+
+  // recording display list
+  if (lcd->record != NULL) {
+    // pixels into list
+    while (count--) {
+      ST7735_Data16b (lcd, color);
+    }
+    return lcd->fence;
+  }
+  // 12 bit - pairs of pixels
+  if (lcd->colmod == ST7735_COLMOD_12) {
+    return ST7735_Fill_Packed (lcd, ST7735_RGB444 (color), count);
+  }
+  // previous fills read color
+  SPIBUS_Wait (&lcd->fill[0]);
+  SPIBUS_Wait (&lcd->fill[1]);
+  // source of DMA
+  lcd->color = color;
+
+  // loop through chunks
+  while (count > 0) {
+    // transaction, previous use finished
+    fill = &lcd->fill[slot];
+    SPIBUS_Wait (fill);
+    // repeated color
+    fill->device = &lcd->device;
+    fill->buffer = &lcd->color;
+    fill->count = (count > ST7735_FILL_MAX) ? ST7735_FILL_MAX : count;
+    fill->repeat = 0;
+    fill->flags = SPIBUS_FRAME16;
+    // queue, chained by interrupt
+    lcd->fence = SPIBUS_Submit (lcd->bus, fill);
+    lcd->bytes += (uint32_t) fill->count << 1;
+    // rest
+    count -= fill->count;
+    // other slot
+    slot ^= 1;
+  }
+
+  // fence of last chunk
+  return lcd->fence;
+}
+
+/**
+ * @desc    Solid fill of rectangle by DMA, clipped, returns immediately
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint8_t x start position
+ * @param   uint8_t x end position
+ * @param   uint8_t y start position
+ * @param   uint8_t y end position
+ * @param   uint16_t color
+ *
+ * @return  uint32_t fence
+ */
+uint32_t ST7735_FillRect (ST7735_Display *lcd, uint8_t xs, uint8_t xe, uint8_t ys, uint8_t ye, uint16_t color)
+{
+  // variables
+  ST7735_Rect rect = { xs, xe, ys, ye };
+
+  // visible part, fully clipped costs no SPI byte
+  if ((ST7735_Clip_Rect (lcd, &rect) == ST7735_ERROR) ||
+      (ST7735_SetWindow (lcd, rect.xs, rect.xe, rect.ys, rect.ye) == ST7735_ERROR)) {
+    // nothing drawn
+    return lcd->fence;
+  }
+  // whole window
+  return ST7735_Fill (lcd, color, (uint32_t) (rect.xe - rect.xs + 1) * (rect.ye - rect.ys + 1));
+}
+
+/**
+ * @desc    Check if fence passed - all drawing before it finished
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint32_t fence
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_Done (ST7735_Display *lcd, uint32_t fence)
+{
+  // fence of bus
+  return SPIBUS_Fence_Done (lcd->bus, fence);
+}
+
+/**
+ * @desc    Start RAM write burst - RAMWR, chip select and data level held
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void ST7735_Burst_Begin (ST7735_Display *lcd)
+{
+  // access to RAM, finishes pending burst, claims bus
+  ST7735_Command (lcd, RAMWR);
+  // recording display list
+  if (lcd->record != NULL) {
+    return;
+  }
+  // data (active high)
+  ST7735_Pin_High (lcd->dc.port, lcd->dc.pin);
+}
+
+/**
+ * @desc    Write RGB565 pixels of burst by DMA, waits only for previous buffer
+ *          Buffer must not be changed till next call of Burst_Write / Burst_End
+ *          12 bit - line buffer of display packed in place, other memory packed
+ *          into free bank of line buffer
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const uint8_t * buffer
+ * @param   uint16_t number of bytes
+ *
+ * @return  void
+ */
+void ST7735_Burst_Write (ST7735_Display *lcd, const uint8_t *buffer, uint16_t count)
+{
+  // variables
+  uint8_t *packed;
+  uint16_t chunk;
+
+  // recording display list
+  if (lcd->record != NULL) {
+    // into list instead of SPI
+    DLIST_Record_Data (lcd->record, buffer, count);
+    return;
+  }
+  // 16 bit - pixels as they are
+  if (lcd->colmod == ST7735_COLMOD_16) {
+    ST7735_Send (lcd, buffer, count);
+    return;
   }
+  // 12 bit - line buffer of display
+  if ((buffer == lcd->buffer[0]) || (buffer == lcd->buffer[1])) {
+    // packed in place
+    packed = lcd->buffer[buffer == lcd->buffer[1]];
+    ST7735_Send (lcd, packed, ST7735_Pack (lcd, packed, buffer, count >> 1));
+    return;
+  }
+  // 12 bit - other memory, loop through chunks
+  while (count > 0) {
+    // bank not sent by last burst
+    packed = lcd->buffer[(lcd->xfer.buffer == lcd->buffer[0]) ? 1 : 0];
+    // 2 bytes of pixel shrink to 1.5, waiting pixel fits too
+    chunk = (count > LINE_BUFFER_SIZE) ? LINE_BUFFER_SIZE : count;
+    ST7735_Send (lcd, packed, ST7735_Pack (lcd, packed, buffer, chunk >> 1));
+    // rest
+    buffer += chunk;
+    count -= chunk;
+  }
+}
+
+/**
+ * @desc    Finish RAM write burst
+ *          Returns while last buffer is still sent, next access to display waits
+ *          (ST7735_Sync), so other display can be served meanwhile
+ *          12 bit - odd last pixel sent alone
+ *
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void ST7735_Burst_End (ST7735_Display *lcd)
+{
+  // 12 bit - odd last pixel
+  ST7735_Pair_Flush (lcd);
+  // last buffer finished in background, waited by ST7735_Sync
+}
+
+/**
+ * @desc    Read window of GRAM into RGB565 pixels MSB first
+ *          Dummy byte and 18 bit format of panel handled, read by slower clock on MISO
+ *          Chip deselected at the end - it terminates read, configuration of display is
+ *          set again by next claim
+ *
+ * @param   ST7735_Display * lcd
+ * @param   uint8_t x start
+ * @param   uint8_t x end
+ * @param   uint8_t y start
+ * @param   uint8_t y end
+ * @param   uint8_t * buffer of 2 bytes per pixel
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_ReadRect (ST7735_Display *lcd, uint8_t xs, uint8_t xe, uint8_t ys, uint8_t ye, uint8_t *buffer)
+{
+  // variables
+  SPI_TypeDef *spi = lcd->bus->spi;
+  uint32_t pixels = (uint32_t) (xe - xs + 1) * (ye - ys + 1);
+  uint8_t r, g, b;
+  uint8_t i;
+
+  // display list records only writes
+  if (lcd->record != NULL) {
+    return ST7735_ERROR;
+  }
+  // window, waits for pending burst
+  if (ST7735_SetWindow (lcd, xs, xe, ys, ye) == ST7735_ERROR) {
+    // out of range
+    return ST7735_ERROR;
+  }
+  // access to RAM, claims bus
+  ST7735_Command (lcd, RAMRD);
+  // read clock
+  SPIBUS_Configure (lcd->bus, ST7735_READ_CONFIG);
+  // data (active high)
+  ST7735_Pin_High (lcd->dc.port, lcd->dc.pin);
+  // traffic - dummy byte and 3 bytes per pixel
+  lcd->bytes += ST7735_READ_DUMMY + pixels * ST7735_READ_BYTES;
+  // stale received byte and overrun flag of writes
+  SPI_Wait_Idle (spi);
+  // dummy read
+  for (i = 0; i < ST7735_READ_DUMMY; i++) {
+    SPI_TRX_8b (spi, 0x00);
+  }
+  // loop through pixels
+  while (pixels--) {
+    // 18 bit - red, green, blue in upper 6 bits
+    r = SPI_TRX_8b (spi, 0x00);
+    g = SPI_TRX_8b (spi, 0x00);
+    b = SPI_TRX_8b (spi, 0x00);
+    // RGB565 MSB first
+    *buffer++ = (r & 0xF8) | (g >> 5);
+    *buffer++ = ((g << 3) & 0xE0) | (b >> 3);
+  }
+  // end of read
+  SPIBUS_Release (lcd->bus);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Canvas backend - set window and start burst
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   const CANVAS_Rect * window
+ *
+ * @return  void
+ */
+static void ST7735_Canvas_Window (CANVAS_Canvas *canvas, const CANVAS_Rect *window)
+{
+  // variables
+  ST7735_Display *lcd = (ST7735_Display *) canvas->target;
+
+  // window clipped by canvas
+  ST7735_SetWindow (lcd, window->xs, window->xe, window->ys, window->ye);
+  // access to RAM
+  ST7735_Burst_Begin (lcd);
+}
+
+/**
+ * @desc    Canvas backend - span of one color
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   uint16_t color
+ * @param   uint32_t number of pixels
+ *
+ * @return  void
+ */
+static void ST7735_Canvas_Fill (CANVAS_Canvas *canvas, uint16_t color, uint32_t count)
+{
+  // repeated color by DMA
+  ST7735_Burst_Fill ((ST7735_Display *) canvas->target, color, count);
+}
+
+/**
+ * @desc    Canvas backend - span of pixels, copied to free bank of line buffer
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   const uint8_t * pixels
+ * @param   uint16_t number of pixels
+ *
+ * @return  void
+ */
+static void ST7735_Canvas_Blit (CANVAS_Canvas *canvas, const uint8_t *pixels, uint16_t count)
+{
+  // variables
+  ST7735_Display *lcd = (ST7735_Display *) canvas->target;
+  uint8_t *buffer;
+  uint16_t bytes = count << 1;
+  uint16_t chunk;
+
+  // 12 bit - packed into free bank, caller may reuse pixels
+  if (lcd->colmod == ST7735_COLMOD_12) {
+    ST7735_Burst_Write (lcd, pixels, bytes);
+    return;
+  }
+  // loop through chunks
+  while (bytes > 0) {
+    // bank not sent by last burst
+    buffer = lcd->buffer[(lcd->xfer.buffer == lcd->buffer[0]) ? 1 : 0];
+    // copy
+    chunk = (bytes > LINE_BUFFER_SIZE) ? LINE_BUFFER_SIZE : bytes;
+    memcpy (buffer, pixels, chunk);
+    // send, caller may reuse pixels
+    ST7735_Burst_Write (lcd, buffer, chunk);
+    // rest
+    pixels += chunk;
+    bytes -= chunk;
+  }
+}
+
+/** @const Canvas backend of display */
+static const CANVAS_Ops ST7735_CANVAS = {
+  ST7735_Canvas_Window,
+  ST7735_Canvas_Fill,
+  ST7735_Canvas_Blit
+};
+
+/**
+ * @desc    Init canvas drawing directly on display, clipped by clip rectangle of display
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void ST7735_Canvas_Init (CANVAS_Canvas *canvas, ST7735_Display *lcd)
+{
+  // variables
+  CANVAS_Rect clip = { lcd->clip.xs, lcd->clip.xe, lcd->clip.ys, lcd->clip.ye };
+
+  // display backend
+  CANVAS_Init (canvas, &ST7735_CANVAS, lcd, lcd->width, lcd->height);
+  // current clip rectangle of display
+  CANVAS_SetClip (canvas, &clip);
+}
+
+/**
+ * @desc    Send rows of RAM canvas (framebuffer / strip) by DMA directly from its memory
+ *          Memory must not be changed till ST7735_Sync
+ *          12 bit - rows packed through line buffer
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const CANVAS_Canvas * canvas of RAM
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_Canvas_Flush (ST7735_Display *lcd, const CANVAS_Canvas *canvas)
+{
+  // variables
+  const uint8_t *pixels = (const uint8_t *) canvas->target;
+  int16_t last = canvas->origin + canvas->rows - 1;
+  uint32_t bytes;
+  uint16_t chunk;
+
+  // last strip may overlap bottom edge
+  if (last > (canvas->height - 1)) {
+    last = canvas->height - 1;
+  }
+  // whole rows in memory as window
+  if ((canvas->origin < 0) ||
+      (canvas->columns != canvas->width) ||
+      (ST7735_SetWindow (lcd, 0, canvas->width - 1, canvas->origin, last) == ST7735_ERROR)) {
+    // out of range
+    return ST7735_ERROR;
+  }
+  // bytes of visible rows
+  bytes = (uint32_t) canvas->width * (last - canvas->origin + 1) << 1;
+  // access to RAM
+  ST7735_Burst_Begin (lcd);
+  // loop through chunks
+  while (bytes > 0) {
+    // even number of bytes
+    chunk = (bytes > 0xFFFE) ? 0xFFFE : bytes;
+    ST7735_Burst_Write (lcd, pixels, chunk);
+    // rest
+    pixels += chunk;
+    bytes -= chunk;
+  }
+  // finish in background
+  ST7735_Burst_End (lcd);
+
+  // success
+  return ST7735_SUCCESS;
 }
 
 /**
  * @desc    Draw pixel
  *
+ * @param   ST7735_Display * lcd
  * @param   uint8_t x position / 0 <= cols <= MAX_X-1
  * @param   uint8_t y position / 0 <= rows <= MAX_Y-1
  * @param   uint16_t color
  *
  * @return  void
  */
-void ST7735_DrawPixel (uint8_t x, uint8_t y, uint16_t color)
+void ST7735_DrawPixel (ST7735_Display *lcd, uint8_t x, uint8_t y, uint16_t color)
 {
+  // outside of clip rectangle
+  if ((x < lcd->clip.xs) || (x > lcd->clip.xe) ||
+      (y < lcd->clip.ys) || (y > lcd->clip.ye)) {
+    return;
+  }
   // set window
-  ST7735_SetWindow (x, x, y, y);
+  if (ST7735_SetWindow (lcd, x, x, y, y) == ST7735_ERROR) {
+    return;
+  }
   // draw pixel by 565 mode
-  ST7735_SendColor565 (color, 1);
+  ST7735_SendColor565 (lcd, color, 1);
 }
 
 /**
- * @desc    Clear screen
+ * @desc    Clear screen, only clip rectangle if set
  *
+ * @param   ST7735_Display * lcd
  * @param   uint16_t color
  *
  * @return  void
  */
-void ST7735_ClearScreen (uint16_t color)
+void ST7735_ClearScreen (ST7735_Display *lcd, uint16_t color)
 {
-  // set whole window
-  ST7735_SetWindow (0, SIZE_X, 0, SIZE_Y);
-  // draw individual pixels
-  ST7735_SendColor565 (color, CACHE_SIZE_MEM);
+  // whole window by solid fill
+  ST7735_FillRect (lcd, 0, (lcd->width - 1), 0, (lcd->height - 1), color);
 }
 
 /**
  * @desc    Draw line by Bresenham algoritm
  * @surce   https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
  *  
+ * @param   ST7735_Display * lcd
  * @param   uint8_t x start position / 0 <= cols <= MAX_X-1
  * @param   uint8_t x end position   / 0 <= cols <= MAX_X-1
  * @param   uint8_t y start position / 0 <= rows <= MAX_Y-1 
@@ -422,7 +1576,7 @@ void ST7735_ClearScreen (uint16_t color)
  *
  * @return  void
  */
-void ST7735_DrawLine (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint16_t color)
+void ST7735_DrawLine (ST7735_Display *lcd, uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint16_t color)
 {
   // determinant
   int16_t D;
@@ -430,6 +1584,18 @@ void ST7735_DrawLine (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint16_t c
   int16_t delta_x, delta_y;
   // steps
   int16_t trace_x = 1, trace_y = 1;
+  // end points for clipping
+  int16_t xs = x1, ys = y1, xe = x2, ye = y2;
+
+  // visible part of line
+  if (ST7735_Clip_Line (lcd, &xs, &ys, &xe, &ye) == ST7735_ERROR) {
+    return;
+  }
+  // clipped end points are on screen
+  x1 = xs;
+  y1 = ys;
+  x2 = xe;
+  y2 = ye;
 
   // delta x
   delta_x = x2 - x1;
@@ -457,7 +1623,7 @@ void ST7735_DrawLine (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint16_t c
     // calculate determinant
     D = (delta_y << 1) - delta_x;
     // draw first pixel
-    ST7735_DrawPixel (x1, y1, color);
+    ST7735_DrawPixel (lcd, x1, y1, color);
     // check if x1 equal x2
     while (x1 != x2) {
       // update x1
@@ -472,14 +1638,14 @@ void ST7735_DrawLine (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint16_t c
       // update deteminant
       D += 2*delta_y;
       // draw next pixel
-      ST7735_DrawPixel (x1, y1, color);
+      ST7735_DrawPixel (lcd, x1, y1, color);
     }
   // for m > 1 (dy > dx)    
   } else {
     // calculate determinant
     D = delta_y - (delta_x << 1);
     // draw first pixel
-    ST7735_DrawPixel (x1, y1, color);
+    ST7735_DrawPixel (lcd, x1, y1, color);
     // check if y2 equal y1
     while (y1 != y2) {
       // update y1
@@ -494,7 +1660,7 @@ void ST7735_DrawLine (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint16_t c
       // update deteminant
       D -= 2*delta_x;
       // draw next pixel
-      ST7735_DrawPixel (x1, y1, color);
+      ST7735_DrawPixel (lcd, x1, y1, color);
     }
   }
 }
@@ -502,6 +1668,7 @@ void ST7735_DrawLine (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint16_t c
 /**
  * @desc    Fast draw line horizontal
  *
+ * @param   ST7735_Display * lcd
  * @param   uint8_t xs - start position
  * @param   uint8_t xe - end position
  * @param   uint8_t y - position
@@ -509,27 +1676,26 @@ void ST7735_DrawLine (uint8_t x1, uint8_t x2, uint8_t y1, uint8_t y2, uint16_t c
  *
  * @return void
  */
-void ST7735_DrawLineHorizontal (uint8_t xs, uint8_t xe, uint8_t y, uint16_t color)
+void ST7735_DrawLineHorizontal (ST7735_Display *lcd, uint8_t xs, uint8_t xe, uint8_t y, uint16_t color)
 {
   uint8_t temp;
   // check if start is > as end  
   if (xs > xe) {
     // temporary safe
-    temp = xs;
+    temp = xe;
     // start change for end
     xe = xs;
     // end change for start
     xs = temp;
   }
-  // set window
-  ST7735_SetWindow (xs, xe, y, y);
-  // draw pixel by 565 mode
-  ST7735_SendColor565 (color, xe - xs);
+  // clipped one row
+  ST7735_FillRect (lcd, xs, xe, y, y, color);
 }
 
 /**
  * @desc    Fast draw line vertical
  *
+ * @param   ST7735_Display * lcd
  * @param   uint8_t x - position
  * @param   uint8_t ys - start position
  * @param   uint8_t ye - end position
@@ -537,27 +1703,26 @@ void ST7735_DrawLineHorizontal (uint8_t xs, uint8_t xe, uint8_t y, uint16_t colo
  *
  * @return  void
  */
-void ST7735_DrawLineVertical (uint8_t x, uint8_t ys, uint8_t ye, uint16_t color)
+void ST7735_DrawLineVertical (ST7735_Display *lcd, uint8_t x, uint8_t ys, uint8_t ye, uint16_t color)
 {
   uint8_t temp;
   // check if start is > as end
   if (ys > ye) {
     // temporary safe
-    temp = ys;
+    temp = ye;
     // start change for end
     ye = ys;
     // end change for start
     ys = temp;
   }
-  // set window
-  ST7735_SetWindow (x, x, ys, ye);
-  // draw pixel by 565 mode
-  ST7735_SendColor565 (color, ye - ys);
+  // clipped one column
+  ST7735_FillRect (lcd, x, x, ys, ye, color);
 }
 
 /**
  * @desc    Draw rectangle
  *
+ * @param   ST7735_Display * lcd
  * @param   uint8_t x start position
  * @param   uint8_t x end position
  * @param   uint8_t y start position
@@ -566,7 +1731,7 @@ void ST7735_DrawLineVertical (uint8_t x, uint8_t ys, uint8_t ye, uint16_t color)
  *
  * @return  void
  */
-void ST7735_DrawRectangle (uint8_t xs, uint8_t xe, uint8_t ys, uint8_t ye, uint16_t color)
+void ST7735_DrawRectangle (ST7735_Display *lcd, uint8_t xs, uint8_t xe, uint8_t ys, uint8_t ye, uint16_t color)
 {
   uint8_t temp;
   // check if start is > as end  
@@ -587,22 +1752,21 @@ void ST7735_DrawRectangle (uint8_t xs, uint8_t xe, uint8_t ys, uint8_t ye, uint1
     // end change for start
     ys = temp;
   }
-  // set window
-  ST7735_SetWindow (xs, xe, ys, ye);
-  // send color
-  ST7735_SendColor565 (color, (xe-xs+1)*(ye-ys+1));  
+  // solid fill
+  ST7735_FillRect (lcd, xs, xe, ys, ye, color);
 }
 
 /**
  * @desc    Draw character
  *
+ * @param   ST7735_Display * lcd
  * @param   char character
  * @param   uint16_t color
  * @param   enum Size (X1, X2, X3)
  *
  * @return  uint8_t
  */
-uint8_t ST7735_DrawChar (char character, uint16_t color, enum Size size)
+uint8_t ST7735_DrawChar (ST7735_Display *lcd, char character, uint16_t color, enum Size size)
 {
   // variables
   uint8_t letter, idxCol, idxRow;
@@ -630,14 +1794,14 @@ uint8_t ST7735_DrawChar (char character, uint16_t color, enum Size size)
         // check if bit set
         if (letter & (1 << idxRow)) {
           // draw pixel 
-          ST7735_DrawPixel (cacheMemIndexCol + idxCol, cacheMemIndexRow + idxRow, color);
+          ST7735_DrawPixel (lcd, lcd->col + idxCol, lcd->row + idxRow, color);
         }
       }
       // fill index row again
       idxRow = CHARS_ROWS_LEN;
     }
     // update x position
-    cacheMemIndexCol = cacheMemIndexCol + CHARS_COLS_LEN + 1;
+    lcd->col = lcd->col + CHARS_COLS_LEN + 1;
   
   // --------------------------------------
   // SIZE X2 - font 2x higher, normal wide
@@ -653,16 +1817,16 @@ uint8_t ST7735_DrawChar (char character, uint16_t color, enum Size size)
         if (letter & (1 << idxRow)) {
           // draw first left up pixel; 
           // (idxRow << 1) - 2x multiplied 
-          ST7735_DrawPixel (cacheMemIndexCol + idxCol, cacheMemIndexRow + (idxRow << 1), color);
+          ST7735_DrawPixel (lcd, lcd->col + idxCol, lcd->row + (idxRow << 1), color);
           // draw second left down pixel
-          ST7735_DrawPixel (cacheMemIndexCol + idxCol, cacheMemIndexRow + (idxRow << 1) + 1, color);
+          ST7735_DrawPixel (lcd, lcd->col + idxCol, lcd->row + (idxRow << 1) + 1, color);
         }
       }
       // fill index row again
       idxRow = CHARS_ROWS_LEN;
     }
     // update x position
-    cacheMemIndexCol = cacheMemIndexCol + CHARS_COLS_LEN + 1;
+    lcd->col = lcd->col + CHARS_COLS_LEN + 1;
 
   // --------------------------------------
   // SIZE X3 - font 2x higher, 2x wider
@@ -678,13 +1842,13 @@ uint8_t ST7735_DrawChar (char character, uint16_t color, enum Size size)
         if (letter & (1 << idxRow)) {
           // draw first left up pixel; 
           // (idxRow << 1) - 2x multiplied 
-          ST7735_DrawPixel (cacheMemIndexCol + (idxCol << 1), cacheMemIndexRow + (idxRow << 1), color);
+          ST7735_DrawPixel (lcd, lcd->col + (idxCol << 1), lcd->row + (idxRow << 1), color);
           // draw second left down pixel
-          ST7735_DrawPixel (cacheMemIndexCol + (idxCol << 1), cacheMemIndexRow + (idxRow << 1) + 1, color);
+          ST7735_DrawPixel (lcd, lcd->col + (idxCol << 1), lcd->row + (idxRow << 1) + 1, color);
           // draw third right up pixel
-          ST7735_DrawPixel (cacheMemIndexCol + (idxCol << 1) + 1, cacheMemIndexRow + (idxRow << 1), color);
+          ST7735_DrawPixel (lcd, lcd->col + (idxCol << 1) + 1, lcd->row + (idxRow << 1), color);
           // draw fourth right down pixel
-          ST7735_DrawPixel (cacheMemIndexCol + (idxCol << 1) + 1, cacheMemIndexRow + (idxRow << 1) + 1, color);
+          ST7735_DrawPixel (lcd, lcd->col + (idxCol << 1) + 1, lcd->row + (idxRow << 1) + 1, color);
         }
       }
       // fill index row again
@@ -692,38 +1856,239 @@ uint8_t ST7735_DrawChar (char character, uint16_t color, enum Size size)
     }
 
     // update x position
-    cacheMemIndexCol = cacheMemIndexCol + CHARS_COLS_LEN + CHARS_COLS_LEN + 1;
+    lcd->col = lcd->col + CHARS_COLS_LEN + CHARS_COLS_LEN + 1;
   }
 
   // return exit
   return ST7735_SUCCESS;
 }
 
+/**
+ * @desc    Draw opaque character cell in one window burst
+ *          Cell includes spacing column, so consecutive glyphs tile without gaps
+ *
+ * @param   ST7735_Display * lcd
+ * @param   int16_t x position
+ * @param   int16_t y position
+ * @param   char character
+ * @param   uint16_t color
+ * @param   uint16_t background
+ * @param   enum Size (X1, X2, X3)
+ * @param   const ST7735_Rect * clip rectangle / NULL for clip of display
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_DrawGlyph (ST7735_Display *lcd, int16_t x, int16_t y, char character, uint16_t color, uint16_t background, enum Size size, const ST7735_Rect *clip)
+{
+  // variables
+  const uint8_t *glyph;
+  uint8_t shift_x, shift_y;
+  uint8_t mask;
+  uint8_t idxCol;
+  int16_t col, row;
+  int16_t xs, xe, ys, ye;
+
+  // check if character is out of range
+  if (((uint8_t) character < 0x20) ||
+      ((uint8_t) character > 0x7f)) {
+    // out of range
+    return ST7735_ERROR;
+  }
+  // columns of character
+  glyph = FONTS[character - 32];
+  // multipliers are 1 or 2, so use shift instead of division
+  shift_x = GLYPH_SCALE_X (size) - 1;
+  shift_y = GLYPH_SCALE_Y (size) - 1;
+
+  // whole cell
+  xs = x;
+  xe = x + GLYPH_WIDTH (size) - 1;
+  ys = y;
+  ye = y + GLYPH_HEIGHT (size) - 1;
+  // intersect with clip rectangle of call and of display
+  if (clip != NULL) {
+    if (xs < clip->xs) xs = clip->xs;
+    if (xe > clip->xe) xe = clip->xe;
+    if (ys < clip->ys) ys = clip->ys;
+    if (ye > clip->ye) ye = clip->ye;
+  }
+  if (xs < lcd->clip.xs) xs = lcd->clip.xs;
+  if (xe > lcd->clip.xe) xe = lcd->clip.xe;
+  if (ys < lcd->clip.ys) ys = lcd->clip.ys;
+  if (ye > lcd->clip.ye) ye = lcd->clip.ye;
+  // fully clipped - nothing to send
+  if ((xs > xe) || (ys > ye)) {
+    // success
+    return ST7735_SUCCESS;
+  }
+
+  // set window of visible part of cell
+  ST7735_SetWindow (lcd, xs, xe, ys, ye);
+  // access to RAM
+  ST7735_Burst_Begin (lcd);
+  // loop through rows
+  for (row = ys; row <= ye; row++) {
+    // bit of row
+    mask = 1 << ((row - y) >> shift_y);
+    // loop through columns
+    for (col = xs; col <= xe; col++) {
+      // column of character, last one is spacing
+      idxCol = (col - x) >> shift_x;
+      // write color
+      if ((idxCol < CHARS_COLS_LEN) && (glyph[idxCol] & mask)) {
+        ST7735_Pixel (lcd, color);
+      } else {
+        ST7735_Pixel (lcd, background);
+      }
+    }
+  }
+  // 12 bit - odd last pixel
+  ST7735_Burst_End (lcd);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Draw opaque run of characters in one window burst
+ *          Window spans all cells incl. spacing columns, pixels are generated
+ *          row by row across all glyphs into double line buffer
+ *
+ * @param   ST7735_Display * lcd
+ * @param   int16_t x position
+ * @param   int16_t y position
+ * @param   const char * characters
+ * @param   uint8_t number of characters
+ * @param   uint16_t color
+ * @param   uint16_t background
+ * @param   enum Size (X1, X2, X3)
+ * @param   const ST7735_Rect * clip rectangle / NULL for clip of display
+ *
+ * @return  uint8_t
+ */
+uint8_t ST7735_DrawGlyphRun (ST7735_Display *lcd, int16_t x, int16_t y, const char *str, uint8_t length, uint16_t color, uint16_t background, enum Size size, const ST7735_Rect *clip)
+{
+  // variables
+  const uint8_t *glyph;
+  uint8_t *buffer;
+  uint8_t shift_x, shift_y;
+  uint8_t width;
+  uint8_t mask;
+  uint8_t within;
+  uint8_t idxCol;
+  uint8_t bank = 0;
+  uint16_t index;
+  uint16_t first;
+  int16_t col, row;
+  int16_t xs, xe, ys, ye;
+
+  // nothing to draw
+  if (length == 0) {
+    return ST7735_SUCCESS;
+  }
+  // multipliers are 1 or 2, so use shift instead of division
+  shift_x = GLYPH_SCALE_X (size) - 1;
+  shift_y = GLYPH_SCALE_Y (size) - 1;
+  // cell width
+  width = GLYPH_WIDTH (size);
+
+  // whole run
+  xs = x;
+  xe = x + length * width - 1;
+  ys = y;
+  ye = y + GLYPH_HEIGHT (size) - 1;
+  // intersect with clip rectangle of call and of display
+  if (clip != NULL) {
+    if (xs < clip->xs) xs = clip->xs;
+    if (xe > clip->xe) xe = clip->xe;
+    if (ys < clip->ys) ys = clip->ys;
+    if (ye > clip->ye) ye = clip->ye;
+  }
+  if (xs < lcd->clip.xs) xs = lcd->clip.xs;
+  if (xe > lcd->clip.xe) xe = lcd->clip.xe;
+  if (ys < lcd->clip.ys) ys = lcd->clip.ys;
+  if (ye > lcd->clip.ye) ye = lcd->clip.ye;
+  // fully clipped - nothing to send
+  if ((xs > xe) || (ys > ye)) {
+    // success
+    return ST7735_SUCCESS;
+  }
+
+  // first visible character
+  first = (xs - x) / width;
+
+  // set window of visible part of run
+  ST7735_SetWindow (lcd, xs, xe, ys, ye);
+  // RAMWR and hold chip select
+  ST7735_Burst_Begin (lcd);
+  // loop through rows
+  for (row = ys; row <= ye; row++) {
+    // line buffer not sent by DMA
+    buffer = lcd->buffer[bank];
+    // bit of row
+    mask = 1 << ((row - y) >> shift_y);
+    // first visible character and column within its cell
+    index = first;
+    within = (xs - x) - first * width;
+    glyph = ST7735_Font (str[index]);
+    // loop through columns
+    for (col = xs; col <= xe; col++) {
+      // next cell
+      if (within == width) {
+        // first column
+        within = 0;
+        // next character
+        glyph = ST7735_Font (str[++index]);
+      }
+      // column of character, last one is spacing
+      idxCol = within++ >> shift_x;
+      // write color MSB first
+      if ((idxCol < CHARS_COLS_LEN) && (glyph[idxCol] & mask)) {
+        *buffer++ = (uint8_t) (color >> 8);
+        *buffer++ = (uint8_t) color;
+      } else {
+        *buffer++ = (uint8_t) (background >> 8);
+        *buffer++ = (uint8_t) background;
+      }
+    }
+    // send row, meanwhile next row is rendered into other bank
+    ST7735_Burst_Write (lcd, lcd->buffer[bank], buffer - lcd->buffer[bank]);
+    // switch bank
+    bank ^= 1;
+  }
+  // release chip select
+  ST7735_Burst_End (lcd);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
 /**
  * @desc    Set text position x, y
  *
+ * @param   ST7735_Display * lcd
  * @param   uint8_t x - position
  * @param   uint8_t y - position
  *
  * @return  uint8_t
  */
-uint8_t ST7735_SetPosition (uint8_t x, uint8_t y)
+uint8_t ST7735_SetPosition (ST7735_Display *lcd, uint8_t x, uint8_t y)
 {
   // check if coordinates is out of range
-  if ((x > MAX_X) && (y > MAX_Y)) {
+  if ((x > lcd->width) && (y > lcd->height)) {
     // error
     return ST7735_ERROR;
 
-  } else if ((x > MAX_X) && (y <= MAX_Y)) {
+  } else if ((x > lcd->width) && (y <= lcd->height)) {
     // set position y
-    cacheMemIndexRow = y;
+    lcd->row = y;
     // set position x
-    cacheMemIndexCol = 2;
+    lcd->col = 2;
   } else {
     // set position y 
-    cacheMemIndexRow = y;
+    lcd->row = y;
     // set position x
-    cacheMemIndexCol = x;
+    lcd->col = x;
   }
   // success
   return ST7735_SUCCESS;
@@ -732,26 +2097,27 @@ uint8_t ST7735_SetPosition (uint8_t x, uint8_t y)
 /**
  * @desc    Check text position x, y
  *
+ * @param   ST7735_Display * lcd
  * @param   uint8_t x - position
  * @param   uint8_t y - position
  * @param   uint8_t
  *
  * @return  uint8_t
  */
-uint8_t ST7735_CheckPosition (uint8_t x, uint8_t y, uint8_t max_y, enum Size size)
+uint8_t ST7735_CheckPosition (ST7735_Display *lcd, uint8_t x, uint8_t y, uint8_t max_y, enum Size size)
 {
   // check if coordinates is out of range
-  if ((x > MAX_X) && (y > max_y)) {
+  if ((x > lcd->width) && (y > max_y)) {
     // out of range
     return ST7735_ERROR;
 
   }
   // if next line
-  if ((x > MAX_X) && (y <= max_y)) {
+  if ((x > lcd->width) && (y <= max_y)) {
     // set position y
-    cacheMemIndexRow = y;
+    lcd->row = y;
     // set position x
-    cacheMemIndexCol = 2;
+    lcd->col = 2;
   } 
 
   // success
@@ -761,13 +2127,14 @@ uint8_t ST7735_CheckPosition (uint8_t x, uint8_t y, uint8_t max_y, enum Size siz
 /**
  * @desc    Draw string
  *
+ * @param   ST7735_Display * lcd
  * @param   char * string 
  * @param   uint16_t color
  * @param   enum Size (X1, X2, X3)
  *
  * @return  void
  */
-void ST7735_DrawString (char *str, uint16_t color, enum Size size)
+void ST7735_DrawString (ST7735_Display *lcd, char *str, uint16_t color, enum Size size)
 {
   // variables
   uint16_t i = 0;
@@ -780,45 +2147,78 @@ void ST7735_DrawString (char *str, uint16_t color, enum Size size)
   // loop through character of string
   while (str[i] != '\0') {
     // max x position character
-    new_x_pos = cacheMemIndexCol + CHARS_COLS_LEN + (size & 0x0F);
+    new_x_pos = lcd->col + CHARS_COLS_LEN + (size & 0x0F);
     // delta y
     delta_y = CHARS_ROWS_LEN + (size >> 4);
     // max y position character
-    new_y_pos = cacheMemIndexRow + delta_y;
+    new_y_pos = lcd->row + delta_y;
     // max y pos
-    max_y_pos = MAX_Y - delta_y;
+    max_y_pos = lcd->height - delta_y;
     // control if will be in range
-    check = ST7735_CheckPosition (new_x_pos, new_y_pos, max_y_pos, size);
-    // update position
-    if (ST7735_SUCCESS == check) {
-      // read characters and increment index
-      ST7735_DrawChar (str[i++], color, size);
+    check = ST7735_CheckPosition (lcd, new_x_pos, new_y_pos, max_y_pos, size);
+    // character does not fit on last row
+    if (ST7735_ERROR == check) {
+      // stop drawing
+      break;
     }
+    // read characters and increment index
+    ST7735_DrawChar (lcd, str[i++], color, size);
+  }
+}
+
+/**
+ * @desc    Draw opaque string from cursor as one window burst (no wrapping)
+ *          Characters not fitting on the row are clipped, cursor stops at right edge
+ *
+ * @param   ST7735_Display * lcd
+ * @param   char * string
+ * @param   uint16_t color
+ * @param   uint16_t background
+ * @param   enum Size (X1, X2, X3)
+ *
+ * @return  void
+ */
+void ST7735_DrawStringRun (ST7735_Display *lcd, char *str, uint16_t color, uint16_t background, enum Size size)
+{
+  // variables
+  uint16_t length = 0;
+
+  // measure string
+  while ((str[length] != '\0') && (length < 0xFF)) {
+    length++;
+  }
+  // draw whole row at once
+  ST7735_DrawGlyphRun (lcd, lcd->col, lcd->row, str, length, color, background, size, NULL);
+  // update x position
+  lcd->col = lcd->col + length * GLYPH_WIDTH (size);
+  // cursor stops at right edge - uint8_t x of DrawChar / DrawPixel must not wrap
+  if (lcd->col > lcd->width) {
+    lcd->col = lcd->width;
   }
 }
 
 /**
  * @desc    RAM Content Show
  *
- * @param   void
+ * @param   ST7735_Display * lcd
  *
  * @return  void
  */
-void ST7735_RAM_Content_Show (void)
+void ST7735_RAM_Content_Show (ST7735_Display *lcd)
 {
   // display content on
-  ST7735_Command (DISPON);
+  ST7735_Command (lcd, DISPON);
 }
 
 /**
  * @desc    RAM Content Hide
  *
- * @param   void
+ * @param   ST7735_Display * lcd
  *
  * @return  void
  */
-void ST7735_RAM_Content_Hide (void)
+void ST7735_RAM_Content_Hide (ST7735_Display *lcd)
 {
   // display content off
-  ST7735_Command (DISPOFF);
+  ST7735_Command (lcd, DISPOFF);
 }
@@ -12,9 +12,11 @@
  * @version     1.0
  * @tested      stm32f103c6t8
  *
- * @depend      spi.h, font.h, st7735.h, libdelay.h
+ * @depend      spi.h, spibus.h, font.h, st7735.h, libdelay.h
  * --------------------------------------------------------------------------------------------+
- * @descr       1.0 - C library for driving only one LCD 1.8" with st7735 driver
+ * @descr       1.0 - C library for driving LCD 1.8" with st7735 driver
+ *              1.1 - display context, more displays on SPI1 / SPI2
+ *              1.2 - displays share SPI with other devices through bus manager
  * @note        Before calling function Delay_Ms() must be called function Delay_Init()
  * --------------------------------------------------------------------------------------------+
  * @inspir      http://www.displayfuture.com/Display/datasheet/controller/ST7735.pdf
@@ -25,17 +27,26 @@
 #ifndef __ST7735_H__
 #define __ST7735_H__
 
+  #include <stddef.h>
   #include <stm32f10x.h>
   #include "spi.h"
+  #include "spibus.h"
   #include "font.h"
   #include "libdelay.h"
 
-  // PINS
+  // PINS - display on SPI1
   // -----------------------------------
-  #define ST7735_RES            GPIO_BSRR_BS1
-  #define ST7735_DC             GPIO_BSRR_BS2
-  #define ST7735_BL             GPIO_BSRR_BS3
-  #define ST7735_CS             GPIO_BSRR_BS4
+  #define ST7735_RES            GPIO_BSRR_BS1     // GPIOA
+  #define ST7735_DC             GPIO_BSRR_BS2     // GPIOA
+  #define ST7735_BL             GPIO_BSRR_BS3     // GPIOA
+  #define ST7735_CS             GPIO_BSRR_BS4     // GPIOA
+
+  // PINS - display on SPI2
+  // -----------------------------------
+  #define ST7735_2_RES          GPIO_BSRR_BS0     // GPIOB
+  #define ST7735_2_DC           GPIO_BSRR_BS1     // GPIOB
+  #define ST7735_2_BL           GPIO_BSRR_BS10    // GPIOB
+  #define ST7735_2_CS           GPIO_BSRR_BS12    // GPIOB
 
   // Success / Error
   // -----------------------------------
@@ -75,7 +86,9 @@
   #define RAMWR                 0x2C
 
   #define PTLAR                 0x30
+  #define VSCRDEF               0x33
   #define MADCTL                0x36
+  #define VSCRSADD              0x37
   #define COLMOD                0x3A
 
   #define FRMCTR1               0xB1
@@ -112,14 +125,55 @@
 
   // AREA definition
   // -----------------------------------
-  #define MAX_X                 161               // max columns / MV = 0 in MADCTL
-  #define MAX_Y                 130               // max rows / MV = 0 in MADCTL
-  #define SIZE_X                MAX_X - 1         // columns max counter
-  #define SIZE_Y                MAX_Y - 1         // rows max counter
+  #define MAX_X                 161               // max columns / ROTATE_0 (MV = 1 in MADCTL)
+  #define MAX_Y                 130               // max rows / ROTATE_0 (MV = 1 in MADCTL)
   #define CACHE_SIZE_MEM        (MAX_X * MAX_Y)   // whole pixels
+  #define LINE_BUFFER_SIZE      (MAX_X << 1)      // bytes of one RGB565 row / longest side
+  #define MEMORY_ROWS           162               // rows of frame memory, axis of scrolling
   #define CHARS_COLS_LEN        5                 // number of columns for chars
   #define CHARS_ROWS_LEN        8                 // number of rows for chars
 
+  // Color modes - COLMOD parameter
+  // -----------------------------------
+  #define ST7735_COLMOD_12      0x03              // RGB444, 2 pixels in 3 bytes
+  #define ST7735_COLMOD_16      0x05              // RGB565, 1 pixel in 2 bytes
+  #ifndef ST7735_PATTERN_SIZE
+    #define ST7735_PATTERN_SIZE 96                // bytes of 12 bit fill pattern, multiple of 3
+  #endif
+  #ifndef ST7735_FILL_MAX
+    #define ST7735_FILL_MAX     0xFFFF            // items / pattern repeats of one fill transaction
+  #endif
+  #define ST7735_RGB444(color)  ((((color) >> 4) & 0x0F00) | \
+                                 (((color) >> 3) & 0x00F0) | \
+                                 (((color) >> 1) & 0x000F))   // upper 4 bits of channels
+
+  // Memory read - RAMRD
+  // -----------------------------------
+  #define ST7735_READ_CONFIG    (SPIBUS_DIV16 | SPIBUS_MODE0)     // read cycle min 150 ns
+  #define ST7735_READ_DUMMY     1                 // bytes before first pixel
+  #define ST7735_READ_BYTES     3                 // bytes of pixel, 6 upper bits of channel
+
+  // Clipping
+  // -----------------------------------
+  #ifndef ST7735_CLIP_DEPTH
+    #define ST7735_CLIP_DEPTH   4                 // max nested clip rectangles
+  #endif
+
+  // MADCTL bits
+  // -----------------------------------
+  #define MADCTL_MY             0x80              // row address order
+  #define MADCTL_MX             0x40              // column address order
+  #define MADCTL_MV             0x20              // row / column exchange
+  #define MADCTL_ML             0x10              // vertical refresh order
+  #define MADCTL_RGB            0x08              // BGR filter panel
+
+  // Glyph cell definition
+  // -----------------------------------
+  #define GLYPH_SCALE_X(size)   (((size) & 0x0F) + 1)                     // horizontal multiplier
+  #define GLYPH_SCALE_Y(size)   (((size) >> 7) + 1)                       // vertical multiplier
+  #define GLYPH_WIDTH(size)     (CHARS_COLS_LEN * GLYPH_SCALE_X(size) + 1) // columns incl. spacing
+  #define GLYPH_HEIGHT(size)    (CHARS_ROWS_LEN * GLYPH_SCALE_Y(size))     // rows
+
   /** @const Command list ST7735B */
   extern const uint8_t INIT_ST7735B[];
 
@@ -135,14 +189,122 @@
     X3 = 0x81
   };
 
+  /** @enum Rotation - clockwise from default landscape view */
+  enum Rotation {
+    // landscape, MADCTL 0xA0
+    ROTATE_0 = 0,
+    // portrait
+    ROTATE_90 = 1,
+    // landscape upside down
+    ROTATE_180 = 2,
+    // portrait upside down
+    ROTATE_270 = 3
+  };
+
+  /** @struct Rectangle - inclusive start / end coordinates */
+  typedef struct {
+    // x start position
+    int16_t xs;
+    // x end position
+    int16_t xe;
+    // y start position
+    int16_t ys;
+    // y end position
+    int16_t ye;
+  } ST7735_Rect;
+
+  /** @struct Pin - port and BSRR mask */
+  typedef struct {
+    // port
+    GPIO_TypeDef *port;
+    // pin mask
+    uint16_t pin;
+  } ST7735_Pin;
+
+  /** @struct Display list recorder, dlist.h */
+  struct DLIST_List;
+
+  /** @struct Canvas, canvas.h */
+  struct CANVAS_Canvas;
+
+  /** @struct Display - driver context of one panel */
+  typedef struct {
+    // SPI bus shared with other devices
+    SPIBUS_Bus *bus;
+    // chip select and SPI configuration of display
+    SPIBUS_Device device;
+    // reset pin
+    ST7735_Pin res;
+    // data / command pin
+    ST7735_Pin dc;
+    // backlight pin
+    ST7735_Pin bl;
+    // logical width of current rotation
+    uint8_t width;
+    // logical height of current rotation
+    uint8_t height;
+    // memory access order of current rotation
+    uint8_t madctl;
+    // text cursor column
+    uint16_t col;
+    // text cursor row
+    uint16_t row;
+    // last CASET / RASET window
+    ST7735_Rect window;
+    // clip rectangle - intersection of screen and pushed rectangles
+    ST7735_Rect clip;
+    // saved clip rectangles
+    ST7735_Rect clipStack[ST7735_CLIP_DEPTH];
+    // number of saved clip rectangles
+    uint8_t clipDepth;
+    // DMA transaction of burst
+    SPIBUS_Transaction xfer;
+    // DMA transactions of solid fill, max ST7735_FILL_MAX items each
+    SPIBUS_Transaction fill[2];
+    // color of solid fill, source of DMA
+    uint16_t color;
+    // pixel format, ST7735_COLMOD_16 / ST7735_COLMOD_12
+    uint8_t colmod;
+    // 12 bit - first pixel of pair waiting for second one
+    uint8_t pending;
+    // 12 bit - waiting pixel RGB444
+    uint16_t held;
+    // 12 bit - packed pair / last pixel, source of DMA
+    uint8_t pair[3];
+    // 12 bit - pixel pairs of solid fill, source of DMA
+    uint8_t pattern[ST7735_PATTERN_SIZE];
+    // fence of last transaction
+    uint32_t fence;
+    // bytes on bus since init - commands, parameters, pixels and reads, widgets count traffic by it
+    uint32_t bytes;
+    // display list recording drawing calls / NULL
+    struct DLIST_List *record;
+    // double line buffer - one row rendered while other is sent by DMA
+    uint8_t buffer[2][LINE_BUFFER_SIZE];
+  } ST7735_Display;
+
+  /** @def Display on SPI1 - SS PA4, SCK PA5, MISO PA6, MOSI PA7 */
+  #define ST7735_DISPLAY_SPI1   { .bus = &spiBus1,                                            \
+                                  .device = { GPIOA, ST7735_CS, SPIBUS_DIV8 | SPIBUS_MODE0 }, \
+                                  .res = { GPIOA, ST7735_RES },                               \
+                                  .dc  = { GPIOA, ST7735_DC },                                \
+                                  .bl  = { GPIOA, ST7735_BL } }
+
+  /** @def Display on SPI2 - SS PB12, SCK PB13, MISO PB14, MOSI PB15 */
+  #define ST7735_DISPLAY_SPI2   { .bus = &spiBus2,                                              \
+                                  .device = { GPIOB, ST7735_2_CS, SPIBUS_DIV4 | SPIBUS_MODE0 }, \
+                                  .res = { GPIOB, ST7735_2_RES },                               \
+                                  .dc  = { GPIOB, ST7735_2_DC },                                \
+                                  .bl  = { GPIOB, ST7735_2_BL } }
+
   /**
    * @desc    Hardware Reset
    *
-   * @param   void
+   * @param   ST7735_Display * lcd
    *
    * @return  void
    */
-  void ST7735_Reset (void);
+  void ST7735_Reset (ST7735_Display *);
   
   /**
    * @desc    Set pin High
@@ -167,69 +329,185 @@
   /**
    * @desc    Init pins
    *
-   * @param   GPIO_TypeDef
+   * @param   ST7735_Display * lcd
    *
    * @return  void
    */
-  void ST7735_Pins_Init (GPIO_TypeDef *);
+  void ST7735_Pins_Init (ST7735_Display *);
 
   /**
    * @desc    Init SPI communication
    *
-   * @param   SPI_TypeDef *SPIx
+   * @param   ST7735_Display * lcd
    *
    * @return  void
    */
-  void ST7735_Spi_Init (SPI_TypeDef *);
+  void ST7735_Spi_Init (ST7735_Display *);
 
   /**
    * @desc    Init sequence
    *
+   * @param   ST7735_Display * lcd
    * @param   const uint8_t*
    *
    * @return  void
    */
-  void ST7735_Init_Seq (const uint8_t *);
+  void ST7735_Init_Seq (ST7735_Display *, const uint8_t *);
 
   /**
    * @desc    Init st7735 driver
    *
-   * @param   SPI_TypeDef *SPIx
+   * @param   ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void ST7735_Init (ST7735_Display *);
+
+  /**
+   * @desc    Set rotation and mirroring, swaps logical width / height
+   *
+   * @param   ST7735_Display * lcd
+   * @param   enum Rotation (ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270)
+   * @param   uint8_t mirror - 1 mirrored x axis, 0 normal
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_SetRotation (ST7735_Display *, enum Rotation, uint8_t);
+
+  /**
+   * @desc    Set pixel format, colors of API stay RGB565
+   *
+   * @param   ST7735_Display * lcd
+   * @param   uint8_t ST7735_COLMOD_16 / ST7735_COLMOD_12
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_SetColorMode (ST7735_Display *, uint8_t);
+
+  /**
+   * @desc    Hardware scroll of columns xs - xe, only rotations with x along memory rows
+   *
+   * @param   ST7735_Display * lcd
+   * @param   uint8_t x start of scrolled columns
+   * @param   uint8_t x end of scrolled columns
+   * @param   uint8_t offset - column xs + i shows content of xs + (i + offset) % width
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Scroll (ST7735_Display *, uint8_t, uint8_t, uint8_t);
+
+  /**
+   * @desc    Leave hardware scroll, content shown as written
+   *
+   * @param   ST7735_Display * lcd
    *
    * @return  void
    */
-  void ST7735_Init (SPI_TypeDef *);
+  void ST7735_Scroll_Stop (ST7735_Display *);
+
+  /**
+   * @desc    Wait for DMA burst of display
+   *
+   * @param   ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void ST7735_Sync (ST7735_Display *);
+
+  /**
+   * @desc    Forget cached window, next SetWindow sends CASET / RASET
+   *
+   * @param   ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void ST7735_InvalidateWindow (ST7735_Display *);
+
+  /**
+   * @desc    Clip to whole screen, empty stack
+   *
+   * @param   ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void ST7735_Clip_Reset (ST7735_Display *);
+
+  /**
+   * @desc    Save clip rectangle and intersect it with new one
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const ST7735_Rect * rectangle
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Clip_Push (ST7735_Display *, const ST7735_Rect *);
+
+  /**
+   * @desc    Restore previous clip rectangle
+   *
+   * @param   ST7735_Display * lcd
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Clip_Pop (ST7735_Display *);
+
+  /**
+   * @desc    Intersect rectangle with clip rectangle
+   *
+   * @param   ST7735_Display * lcd
+   * @param   ST7735_Rect * rectangle, clipped in place
+   *
+   * @return  uint8_t ST7735_ERROR if nothing visible
+   */
+  uint8_t ST7735_Clip_Rect (ST7735_Display *, ST7735_Rect *);
+
+  /**
+   * @desc    Clip line by Cohen-Sutherland algorithm
+   *
+   * @param   ST7735_Display * lcd
+   * @param   int16_t * x start position
+   * @param   int16_t * y start position
+   * @param   int16_t * x end position
+   * @param   int16_t * y end position
+   *
+   * @return  uint8_t ST7735_ERROR if nothing visible
+   */
+  uint8_t ST7735_Clip_Line (ST7735_Display *, int16_t *, int16_t *, int16_t *, int16_t *);
 
   /**
    * @desc    Command send
    *
+   * @param   ST7735_Display * lcd
    * @param   uint8_t
    *
    * @return  void
    */
-  void ST7735_Command (uint8_t);
+  void ST7735_Command (ST7735_Display *, uint8_t);
 
   /**
    * @desc    8bits data send
    *
+   * @param   ST7735_Display * lcd
    * @param   uint8_t
    *
    * @return  void
    */
-  void ST7735_Data8b (uint8_t);
+  void ST7735_Data8b (ST7735_Display *, uint8_t);
 
   /**
    * @desc    16bits data send
    *
+   * @param   ST7735_Display * lcd
    * @param   uint16_t
    *
    * @return  void
    */
-  void ST7735_Data16b (uint16_t);
+  void ST7735_Data16b (ST7735_Display *, uint16_t);
 
   /**
    * @desc    Set window
    *
+   * @param   ST7735_Display * lcd
    * @param   uint8_t x - start position
    * @param   uint8_t x - end position
    * @param   uint8_t y - start position
@@ -237,42 +515,156 @@
    *
    * @return  uint8_t
    */
-  uint8_t ST7735_SetWindow (uint8_t, uint8_t, uint8_t, uint8_t);
+  uint8_t ST7735_SetWindow (ST7735_Display *, uint8_t, uint8_t, uint8_t, uint8_t);
 
   /**
    * @desc    Write color pixels
    *
+   * @param   ST7735_Display * lcd
    * @param   uint16_t color
    * @param   uint16_t counter
    *
    * @return  void
    */
-  void ST7735_SendColor565 (uint16_t, uint16_t);
+  void ST7735_SendColor565 (ST7735_Display *, uint16_t, uint32_t);
+
+  /**
+   * @desc    Solid fill of current window by DMA, returns immediately
+   *
+   * @param   ST7735_Display * lcd
+   * @param   uint16_t color
+   * @param   uint32_t number of pixels
+   *
+   * @return  uint32_t fence
+   */
+  uint32_t ST7735_Fill (ST7735_Display *, uint16_t, uint32_t);
+
+  /**
+   * @desc    Solid fill inside RAM write burst by DMA, returns immediately
+   *
+   * @param   ST7735_Display * lcd
+   * @param   uint16_t color
+   * @param   uint32_t number of pixels
+   *
+   * @return  uint32_t fence
+   */
+  uint32_t ST7735_Burst_Fill (ST7735_Display *, uint16_t, uint32_t);
+
+  /**
+   * @desc    Solid fill of rectangle by DMA, clipped, returns immediately
+   *
+   * @param   ST7735_Display * lcd
+   * @param   uint8_t x start position
+   * @param   uint8_t x end position
+   * @param   uint8_t y start position
+   * @param   uint8_t y end position
+   * @param   uint16_t color
+   *
+   * @return  uint32_t fence
+   */
+  uint32_t ST7735_FillRect (ST7735_Display *, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t);
+
+  /**
+   * @desc    Check if fence passed - all drawing before it finished
+   *
+   * @param   ST7735_Display * lcd
+   * @param   uint32_t fence
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Done (ST7735_Display *, uint32_t);
+
+  /**
+   * @desc    Start RAM write burst - RAMWR, chip select and data level held
+   *
+   * @param   ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void ST7735_Burst_Begin (ST7735_Display *);
+
+  /**
+   * @desc    Write RGB565 pixels of burst by DMA, waits only for previous buffer
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const uint8_t * buffer
+   * @param   uint16_t number of bytes
+   *
+   * @return  void
+   */
+  void ST7735_Burst_Write (ST7735_Display *, const uint8_t *, uint16_t);
+
+  /**
+   * @desc    Finish RAM write burst
+   *
+   * @param   ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void ST7735_Burst_End (ST7735_Display *);
+
+  /**
+   * @desc    Read window of GRAM into RGB565 pixels MSB first
+   *          Dummy byte and 18 bit format of panel handled, read by slower clock on MISO
+   *
+   * @param   ST7735_Display * lcd
+   * @param   uint8_t x start
+   * @param   uint8_t x end
+   * @param   uint8_t y start
+   * @param   uint8_t y end
+   * @param   uint8_t * buffer of 2 bytes per pixel
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_ReadRect (ST7735_Display *, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t *);
+
+  /**
+   * @desc    Init canvas drawing directly on display, clipped by clip rectangle of display
+   *
+   * @param   struct CANVAS_Canvas * canvas
+   * @param   ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void ST7735_Canvas_Init (struct CANVAS_Canvas *, ST7735_Display *);
+
+  /**
+   * @desc    Send rows of RAM canvas (framebuffer / strip) by DMA directly from its memory
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const struct CANVAS_Canvas * canvas of RAM
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_Canvas_Flush (ST7735_Display *, const struct CANVAS_Canvas *);
 
   /**
    * @desc    Draw pixel
    *
+   * @param   ST7735_Display * lcd
    * @param   uint8_t x position / 0 <= cols <= MAX_X-1
    * @param   uint8_t y position / 0 <= rows <= MAX_Y-1
    * @param   uint16_t color
    *
    * @return  void
    */
-  void ST7735_DrawPixel (uint8_t, uint8_t, uint16_t);
+  void ST7735_DrawPixel (ST7735_Display *, uint8_t, uint8_t, uint16_t);
 
   /**
    * @desc    Clear screen
    *
+   * @param   ST7735_Display * lcd
    * @param   uint16_t color
    *
    * @return  void
    */
-  void ST7735_ClearScreen (uint16_t);
+  void ST7735_ClearScreen (ST7735_Display *, uint16_t);
 
   /**
    * @desc    Draw line by Bresenham algoritm
    * @surce   https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
    *  
+   * @param   ST7735_Display * lcd
    * @param   uint8_t x start position / 0 <= cols <= MAX_X-1
    * @param   uint8_t x end position   / 0 <= cols <= MAX_X-1
    * @param   uint8_t y start position / 0 <= rows <= MAX_Y-1 
@@ -281,11 +673,12 @@
    *
    * @return  uint8_t
    */
-  void ST7735_DrawLine (uint8_t, uint8_t, uint8_t, uint8_t, uint16_t);
+  void ST7735_DrawLine (ST7735_Display *, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t);
 
   /**
    * @desc    Fast draw line horizontal
    *
+   * @param   ST7735_Display * lcd
    * @param   uint8_t xs - start position
    * @param   uint8_t xe - end position
    * @param   uint8_t y - position
@@ -293,11 +686,12 @@
    *
    * @return void
    */
-  void ST7735_DrawLineHorizontal (uint8_t, uint8_t, uint8_t, uint16_t);
+  void ST7735_DrawLineHorizontal (ST7735_Display *, uint8_t, uint8_t, uint8_t, uint16_t);
 
   /**
    * @desc    Fast draw line vertical
    *
+   * @param   ST7735_Display * lcd
    * @param   uint8_t x - position
    * @param   uint8_t ys - start position
    * @param   uint8_t ye - end position
@@ -305,11 +699,12 @@
    *
    * @return  void
    */
-  void ST7735_DrawLineVertical (uint8_t, uint8_t, uint8_t, uint16_t);
+  void ST7735_DrawLineVertical (ST7735_Display *, uint8_t, uint8_t, uint8_t, uint16_t);
 
   /**
    * @desc    Draw rectangle
    *
+   * @param   ST7735_Display * lcd
    * @param   uint8_t x start position
    * @param   uint8_t x end position
    * @param   uint8_t y start position
@@ -318,67 +713,117 @@
    *
    * @return  void
    */
-  void ST7735_DrawRectangle (uint8_t, uint8_t, uint8_t, uint8_t, uint16_t);
+  void ST7735_DrawRectangle (ST7735_Display *, uint8_t, uint8_t, uint8_t, uint8_t, uint16_t);
   
   /**
    * @desc    Draw character
    *
+   * @param   ST7735_Display * lcd
    * @param   char character
    * @param   uint16_t color
    * @param   enum Size (X1, X2, X3)
    *
    * @return  uint8_t
    */
-  uint8_t ST7735_DrawChar (char, uint16_t, enum Size);
+  uint8_t ST7735_DrawChar (ST7735_Display *, char, uint16_t, enum Size);
+
+  /**
+   * @desc    Draw opaque character cell in one window burst
+   *
+   * @param   ST7735_Display * lcd
+   * @param   int16_t x position
+   * @param   int16_t y position
+   * @param   char character
+   * @param   uint16_t color
+   * @param   uint16_t background
+   * @param   enum Size (X1, X2, X3)
+   * @param   const ST7735_Rect * clip rectangle / NULL for clip of display
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_DrawGlyph (ST7735_Display *, int16_t, int16_t, char, uint16_t, uint16_t, enum Size, const ST7735_Rect *);
   
+  /**
+   * @desc    Draw opaque run of characters in one window burst
+   *
+   * @param   ST7735_Display * lcd
+   * @param   int16_t x position
+   * @param   int16_t y position
+   * @param   const char * characters
+   * @param   uint8_t number of characters
+   * @param   uint16_t color
+   * @param   uint16_t background
+   * @param   enum Size (X1, X2, X3)
+   * @param   const ST7735_Rect * clip rectangle / NULL for clip of display
+   *
+   * @return  uint8_t
+   */
+  uint8_t ST7735_DrawGlyphRun (ST7735_Display *, int16_t, int16_t, const char *, uint8_t, uint16_t, uint16_t, enum Size, const ST7735_Rect *);
+
   /**
    * @desc    Set text position x, y
    *
+   * @param   ST7735_Display * lcd
    * @param   uint8_t x - position
    * @param   uint8_t y - position
    *
    * @return  uint8_t
    */
-  uint8_t ST7735_SetPosition (uint8_t, uint8_t);
+  uint8_t ST7735_SetPosition (ST7735_Display *, uint8_t, uint8_t);
   
   /**
    * @desc    Check text position x, y
    *
+   * @param   ST7735_Display * lcd
    * @param   uint8_t x - position
    * @param   uint8_t y - position
    * @param   uint8_t
    *
    * @return  uint8_t
    */
-  uint8_t ST7735_CheckPosition (uint8_t, uint8_t, uint8_t, enum Size);
+  uint8_t ST7735_CheckPosition (ST7735_Display *, uint8_t, uint8_t, uint8_t, enum Size);
   
   /**
    * @desc    Draw string
    *
+   * @param   ST7735_Display * lcd
    * @param   char * string 
    * @param   uint16_t color
    * @param   enum Size (X1, X2, X3)
    *
    * @return  void
    */
-  void ST7735_DrawString (char *, uint16_t, enum Size size);
+  void ST7735_DrawString (ST7735_Display *, char *, uint16_t, enum Size size);
+
+  /**
+   * @desc    Draw opaque string from cursor as one window burst (no wrapping)
+   *
+   * @param   ST7735_Display * lcd
+   * @param   char * string
+   * @param   uint16_t color
+   * @param   uint16_t background
+   * @param   enum Size (X1, X2, X3)
+   *
+   * @return  void
+   */
+  void ST7735_DrawStringRun (ST7735_Display *, char *, uint16_t, uint16_t, enum Size);
 
   /**
    * @desc    RAM Content Show
    *
-   * @param   void
+   * @param   ST7735_Display * lcd
    *
    * @return  void
    */
-  void ST7735_RAM_Content_Show (void);
+  void ST7735_RAM_Content_Show (ST7735_Display *);
 
   /**
    * @desc    RAM Content Hide
    *
-   * @param   void
+   * @param   ST7735_Display * lcd
    *
    * @return  void
    */
-  void ST7735_RAM_Content_Hide (void);
+  void ST7735_RAM_Content_Hide (ST7735_Display *);
 
 #endif
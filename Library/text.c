@@ -0,0 +1,218 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Text layout Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        text.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      text.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Layout pass measures string once and computes line breaks (word wrap,
+ *              alignment, clip rectangle), render pass draws every line in one window burst.
+ *              Layout can be kept and rendered again (static labels).
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "text.h"
+
+/**
+ * @desc    Measure width of n characters in pixels
+ *          Spacing column after last character is not counted
+ *
+ * @param   uint16_t number of characters
+ * @param   enum Size (X1, X2, X3)
+ *
+ * @return  uint16_t
+ */
+uint16_t TEXT_Width (uint16_t length, enum Size size)
+{
+  // empty
+  if (length == 0) {
+    // zero width
+    return 0;
+  }
+  // width without last spacing column
+  return length * GLYPH_WIDTH (size) - 1;
+}
+
+/**
+ * @desc    Measure string and compute line breaks
+ *
+ * @param   TEXT_Layout * layout
+ * @param   const char * string
+ * @param   const ST7735_Rect * box / clip rectangle
+ * @param   enum Size (X1, X2, X3)
+ * @param   uint8_t flags
+ *
+ * @return  uint8_t number of lines
+ */
+uint8_t TEXT_Layout_Compute (TEXT_Layout *layout, const char *str, const ST7735_Rect *box, enum Size size, uint8_t flags)
+{
+  // variables
+  uint16_t i = 0;
+  uint16_t start;
+  uint16_t brk;
+  uint16_t length;
+  uint8_t max_chars;
+  int16_t width;
+  int16_t y;
+  TEXT_Line *line;
+
+  // store parameters
+  layout->str = str;
+  layout->clip = *box;
+  layout->size = size;
+  layout->lines = 0;
+
+  // characters fitting into box
+  width = box->xe - box->xs + 2;
+  max_chars = (width > (int16_t) GLYPH_WIDTH (size)) ? (width / GLYPH_WIDTH (size)) : 1;
+  // first line
+  y = box->ys;
+
+  // loop through lines
+  while ((str[i] != '\0') &&
+         (layout->lines < TEXT_MAX_LINES) &&
+         (y <= box->ye)) {
+    // line start
+    start = i;
+    // no break point
+    brk = start;
+    // empty line
+    length = 0;
+    // measure line
+    while ((str[i] != '\0') && (str[i] != '\n')) {
+      // line is full
+      if ((flags & TEXT_WRAP) && ((i - start) == max_chars)) {
+        // break exactly on space
+        if (str[i] == ' ') {
+          // skip space
+          i++;
+        // break on last space
+        } else if (brk > start) {
+          // line until space
+          length = brk - start;
+          // continue after space
+          i = brk + 1;
+        }
+        // otherwise word is longer than line, split it
+        break;
+      }
+      // remember break point
+      if (str[i] == ' ') {
+        // position of space
+        brk = i;
+      }
+      // next character
+      i++;
+      // line length
+      length = i - start;
+    }
+    // skip new line
+    if (str[i] == '\n') {
+      i++;
+    }
+
+    // store line
+    line = &layout->line[layout->lines++];
+    line->start = start;
+    line->length = length;
+    line->y = y;
+    // alignment
+    switch (flags & TEXT_ALIGN_MASK) {
+      // center
+      case TEXT_ALIGN_CENTER:
+        line->x = box->xs + ((box->xe - box->xs + 1) - (int16_t) TEXT_Width (length, size)) / 2;
+        break;
+      // right
+      case TEXT_ALIGN_RIGHT:
+        line->x = box->xe + 1 - (int16_t) TEXT_Width (length, size);
+        break;
+      // left
+      default:
+        line->x = box->xs;
+        break;
+    }
+    // next line
+    y += GLYPH_HEIGHT (size);
+  }
+
+  // number of lines
+  return layout->lines;
+}
+
+/**
+ * @desc    Render computed layout
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const TEXT_Layout * layout
+ * @param   uint16_t color
+ * @param   uint16_t background
+ *
+ * @return  void
+ */
+void TEXT_Render (ST7735_Display *lcd, const TEXT_Layout *layout, uint16_t color, uint16_t background)
+{
+  // variables
+  const TEXT_Line *line;
+  uint16_t start;
+  uint16_t length;
+  uint16_t skip;
+  int16_t x;
+  uint8_t n;
+
+  // loop through lines
+  for (n = 0; n < layout->lines; n++) {
+    // line
+    line = &layout->line[n];
+    start = line->start;
+    length = line->length;
+    x = line->x;
+    // skip characters left of clip rectangle
+    if (x < layout->clip.xs) {
+      skip = (layout->clip.xs - x) / GLYPH_WIDTH (layout->size);
+      skip = (skip > length) ? length : skip;
+      start += skip;
+      length -= skip;
+      x += skip * GLYPH_WIDTH (layout->size);
+    }
+    // run takes 255 characters at most - rest is behind right edge
+    if (length > 0xFF) {
+      length = 0xFF;
+    }
+    // whole line in one window burst
+    ST7735_DrawGlyphRun (lcd, x, line->y, layout->str + start, length, color, background, layout->size, &layout->clip);
+  }
+}
+
+/**
+ * @desc    Layout and render string in one call
+ *
+ * @param   ST7735_Display * lcd
+ * @param   const char * string
+ * @param   const ST7735_Rect * box / clip rectangle
+ * @param   uint16_t color
+ * @param   uint16_t background
+ * @param   enum Size (X1, X2, X3)
+ * @param   uint8_t flags
+ *
+ * @return  void
+ */
+void TEXT_Draw (ST7735_Display *lcd, const char *str, const ST7735_Rect *box, uint16_t color, uint16_t background, enum Size size, uint8_t flags)
+{
+  // layout
+  TEXT_Layout layout;
+
+  // measure
+  TEXT_Layout_Compute (&layout, str, box, size, flags);
+  // render
+  TEXT_Render (lcd, &layout, color, background);
+}
@@ -0,0 +1,116 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Text layout Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        text.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Layout pass measures string once and computes line breaks (word wrap,
+ *              alignment, clip rectangle), render pass draws every line in one window burst.
+ *              Layout can be kept and rendered again (static labels).
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __TEXT_H__
+#define __TEXT_H__
+
+  #include "st7735.h"
+
+  // Layout definition
+  // -----------------------------------
+  #define TEXT_MAX_LINES        8                 // max lines of one layout
+
+  // Flags
+  // -----------------------------------
+  #define TEXT_ALIGN_LEFT       0x00              // left alignment
+  #define TEXT_ALIGN_CENTER     0x01              // center alignment
+  #define TEXT_ALIGN_RIGHT      0x02              // right alignment
+  #define TEXT_ALIGN_MASK       0x03              // alignment bits
+  #define TEXT_WRAP             0x04              // word wrap, otherwise break only on '\n'
+
+  /** @struct Line of layout */
+  typedef struct {
+    // index of first character in string
+    uint16_t start;
+    // number of characters - line without TEXT_WRAP can exceed 255
+    uint16_t length;
+    // x position of first character
+    int16_t x;
+    // y position of line
+    int16_t y;
+  } TEXT_Line;
+
+  /** @struct Layout */
+  typedef struct {
+    // laid out string
+    const char *str;
+    // clip rectangle / box
+    ST7735_Rect clip;
+    // font size
+    enum Size size;
+    // number of lines
+    uint8_t lines;
+    // lines
+    TEXT_Line line[TEXT_MAX_LINES];
+  } TEXT_Layout;
+
+  /**
+   * @desc    Measure string and compute line breaks
+   *
+   * @param   TEXT_Layout * layout
+   * @param   const char * string
+   * @param   const ST7735_Rect * box / clip rectangle
+   * @param   enum Size (X1, X2, X3)
+   * @param   uint8_t flags
+   *
+   * @return  uint8_t number of lines
+   */
+  uint8_t TEXT_Layout_Compute (TEXT_Layout *, const char *, const ST7735_Rect *, enum Size, uint8_t);
+
+  /**
+   * @desc    Measure width of n characters in pixels
+   *
+   * @param   uint16_t number of characters
+   * @param   enum Size (X1, X2, X3)
+   *
+   * @return  uint16_t
+   */
+  uint16_t TEXT_Width (uint16_t, enum Size);
+
+  /**
+   * @desc    Render computed layout
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const TEXT_Layout * layout
+   * @param   uint16_t color
+   * @param   uint16_t background
+   *
+   * @return  void
+   */
+  void TEXT_Render (ST7735_Display *, const TEXT_Layout *, uint16_t, uint16_t);
+
+  /**
+   * @desc    Layout and render string in one call
+   *
+   * @param   ST7735_Display * lcd
+   * @param   const char * string
+   * @param   const ST7735_Rect * box / clip rectangle
+   * @param   uint16_t color
+   * @param   uint16_t background
+   * @param   enum Size (X1, X2, X3)
+   * @param   uint8_t flags
+   *
+   * @return  void
+   */
+  void TEXT_Draw (ST7735_Display *, const char *, const ST7735_Rect *, uint16_t, uint16_t, enum Size, uint8_t);
+
+#endif
@@ -0,0 +1,231 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Tile diff renderer Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        tile.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      tile.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Tiles are drawn one by one into two RAM buffers. Changed tile is sent by DMA from
+ *              its buffer while next tile is drawn into other one, SetWindow of next sent tile
+ *              waits for previous transfer. Edge tiles are narrower (161 = 10 * 16 + 1), pixels
+ *              of tile are packed without gap and padded by zero to whole 32 bit word for CRC.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "tile.h"
+
+#if defined (CRC) && !defined (TILE_CRC_SOFTWARE)
+
+/**
+ * @desc    CRC-32 of words - CRC unit
+ *
+ * @param   const uint32_t * words
+ * @param   uint16_t number of words
+ *
+ * @return  uint32_t
+ */
+uint32_t TILE_Hash (const uint32_t *words, uint16_t count)
+{
+  // initial value 0xFFFFFFFF
+  CRC->CR = CRC_CR_RESET;
+  // loop through words, one word per 4 cycles
+  while (count--) {
+    CRC->DR = *words++;
+  }
+  // result
+  return CRC->DR;
+}
+
+#else
+
+/** @var Remainders of nibble, polynomial 0x04C11DB7 */
+static const uint32_t TILE_CRC_TABLE[16] = {
+  0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+  0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD
+};
+
+/**
+ * @desc    CRC-32 of words - software, same result as CRC unit
+ *
+ * @param   const uint32_t * words
+ * @param   uint16_t number of words
+ *
+ * @return  uint32_t
+ */
+uint32_t TILE_Hash (const uint32_t *words, uint16_t count)
+{
+  // variables
+  uint32_t crc = 0xFFFFFFFF;
+  uint8_t nibble;
+
+  // loop through words
+  while (count--) {
+    // word MSB first
+    crc ^= *words++;
+    // loop through nibbles
+    for (nibble = 0; nibble < 8; nibble++) {
+      crc = (crc << 4) ^ TILE_CRC_TABLE[crc >> 28];
+    }
+  }
+  // result
+  return crc;
+}
+
+#endif
+
+/**
+ * @desc    Init screen of display, first frame sends every tile
+ *
+ * @param   TILE_Screen * screen
+ * @param   ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void TILE_Init (TILE_Screen *screen, ST7735_Display *lcd)
+{
+#if defined (CRC) && !defined (TILE_CRC_SOFTWARE)
+  // clock of CRC unit
+  RCC->AHBENR |= RCC_AHBENR_CRCEN;
+#endif
+  // display
+  screen->lcd = lcd;
+  // nothing known about display content
+  TILE_Invalidate (screen);
+  // no traffic yet
+  screen->stats.tiles = 0;
+  screen->stats.sent = 0;
+  screen->stats.bytes = 0;
+}
+
+/**
+ * @desc    Forget hashes - display changed by other drawing
+ *
+ * @param   TILE_Screen * screen
+ *
+ * @return  void
+ */
+void TILE_Invalidate (TILE_Screen *screen)
+{
+  // next frame sends every tile
+  screen->known = 0;
+}
+
+/**
+ * @desc    Draw frame tile by tile, send changed tiles only
+ *          Drawing must cover whole screen - background first
+ *
+ * @param   TILE_Screen * screen
+ * @param   TILE_Draw drawing
+ * @param   void * context of drawing
+ *
+ * @return  uint16_t number of sent tiles
+ */
+uint16_t TILE_Render (TILE_Screen *screen, TILE_Draw draw, void *context)
+{
+  // variables
+  ST7735_Display *lcd = screen->lcd;
+  CANVAS_Canvas canvas;
+  CANVAS_Rect tile;
+  ST7735_Rect rect;
+  uint32_t *pixels;
+  uint32_t hash;
+  uint32_t bytes;
+  uint16_t index = 0;
+  uint16_t count;
+  int16_t y;
+  uint8_t bank = 0;
+
+  // other rotation, other tiles
+  if ((screen->width != lcd->width) || (screen->height != lcd->height)) {
+    screen->width = lcd->width;
+    screen->height = lcd->height;
+    screen->known = 0;
+  }
+  // no traffic yet
+  screen->stats.tiles = 0;
+  screen->stats.sent = 0;
+  screen->stats.bytes = 0;
+  // loop through rows of tiles
+  for (tile.ys = 0; tile.ys < lcd->height; tile.ys += TILE_SIZE) {
+    // last row may be lower
+    tile.ye = tile.ys + TILE_SIZE - 1;
+    if (tile.ye > (lcd->height - 1)) {
+      tile.ye = lcd->height - 1;
+    }
+    // loop through tiles of row
+    for (tile.xs = 0; tile.xs < lcd->width; tile.xs += TILE_SIZE, index++) {
+      // last column may be narrower
+      tile.xe = tile.xs + TILE_SIZE - 1;
+      if (tile.xe > (lcd->width - 1)) {
+        tile.xe = lcd->width - 1;
+      }
+      // pixels of tile
+      pixels = screen->pixels[bank];
+      count = (tile.xe - tile.xs + 1) * (tile.ye - tile.ys + 1);
+      // canvas holding only tile
+      CANVAS_RAM_Init (&canvas, (uint8_t *) pixels, lcd->width, lcd->height, TILE_SIZE);
+      CANVAS_RAM_Place (&canvas, &tile);
+      // whole screen clipped to tile
+      draw (&canvas, context);
+      screen->stats.tiles++;
+      // odd number of pixels, pad to whole word
+      if (count & 1) {
+        ((uint16_t *) pixels)[count] = 0x0000;
+      }
+      hash = TILE_Hash (pixels, (count + 1) >> 1);
+      // same as on display
+      if (screen->known && (screen->hash[index] == hash)) {
+        // buffer reused by next tile
+        continue;
+      }
+      // visible part of tile, same clipping as fill
+      rect.xs = tile.xs;
+      rect.xe = tile.xe;
+      rect.ys = tile.ys;
+      rect.ye = tile.ye;
+      if (ST7735_Clip_Rect (lcd, &rect) == ST7735_ERROR) {
+        // not on display, complement never matches so tile is sent again
+        screen->hash[index] = ~hash;
+        continue;
+      }
+      // clipped tile sent again too, whole tile on display
+      screen->hash[index] = ((rect.xs == tile.xs) && (rect.xe == tile.xe) &&
+                             (rect.ys == tile.ys) && (rect.ye == tile.ye)) ? hash : ~hash;
+      bytes = lcd->bytes;
+      // waits for previous tile, other buffer
+      ST7735_SetWindow (lcd, rect.xs, rect.xe, rect.ys, rect.ye);
+      ST7735_Burst_Begin (lcd);
+      // whole rows, one write
+      if ((rect.xs == tile.xs) && (rect.xe == tile.xe)) {
+        ST7735_Burst_Write (lcd, (const uint8_t *) pixels + ((rect.ys - tile.ys) * (tile.xe - tile.xs + 1) << 1),
+                            (rect.xe - rect.xs + 1) * (rect.ye - rect.ys + 1) << 1);
+      } else {
+        // loop through visible rows, part of row each
+        for (y = rect.ys; y <= rect.ye; y++) {
+          ST7735_Burst_Write (lcd, (const uint8_t *) pixels + (((y - tile.ys) * (tile.xe - tile.xs + 1) + rect.xs - tile.xs) << 1),
+                              (rect.xe - rect.xs + 1) << 1);
+        }
+      }
+      ST7735_Burst_End (lcd);
+      // next tile into other buffer
+      bank ^= 1;
+      screen->stats.sent++;
+      screen->stats.bytes += lcd->bytes - bytes;
+    }
+  }
+  // hashes of display content
+  screen->known = 1;
+
+  // sent tiles
+  return screen->stats.sent;
+}
@@ -0,0 +1,116 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Tile diff renderer Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        tile.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      st7735.h, canvas.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Frame diffing without framebuffer - whole screen is redrawn by application into
+ *              canvas tile by tile (16 x 16 pixels), every tile is hashed by CRC unit and sent
+ *              only if hash differs from hash of last frame. CRC-32 of STM32 (polynomial
+ *              0x04C11DB7, 32 bit words) is computed in software when CRC unit is not present
+ *              (host build) or TILE_CRC_SOFTWARE is defined. Tiles are clipped by clip stack of
+ *              display, tile not sent whole is sent again by next frame.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __TILE_H__
+#define __TILE_H__
+
+  #include "st7735.h"
+  #include "canvas.h"
+
+  // Tiles of screen
+  // -----------------------------------
+  #define TILE_SIZE             16                                    // pixels of tile side
+  #define TILE_COLS             ((MAX_X + TILE_SIZE - 1) / TILE_SIZE) // tiles of longer side
+  #define TILE_ROWS             ((MAX_Y + TILE_SIZE - 1) / TILE_SIZE) // tiles of shorter side
+  #define TILE_COUNT            (TILE_COLS * TILE_ROWS)               // same for all rotations
+  #define TILE_WORDS            (TILE_SIZE * TILE_SIZE / 2)           // 32 bit words of tile
+
+  /**
+   * @desc    Drawing of whole screen, clipped to tile by canvas
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   void * context
+   */
+  typedef void (*TILE_Draw) (CANVAS_Canvas *, void *);
+
+  /** @struct Traffic of last frame */
+  typedef struct {
+    // tiles drawn
+    uint16_t tiles;
+    // tiles sent
+    uint16_t sent;
+    // bytes on bus - headers and pixels
+    uint32_t bytes;
+  } TILE_Stats;
+
+  /** @struct Screen - hashes of last frame and tile buffers */
+  typedef struct {
+    // display
+    ST7735_Display *lcd;
+    // hash of every tile, row by row
+    uint32_t hash[TILE_COUNT];
+    // hashes valid, otherwise every tile is sent
+    uint8_t known;
+    // size of screen hashed, other rotation forgets hashes
+    uint8_t width;
+    uint8_t height;
+    // tile drawn while other one is sent by DMA, word aligned for CRC
+    uint32_t pixels[2][TILE_WORDS];
+    // traffic of last frame
+    TILE_Stats stats;
+  } TILE_Screen;
+
+  /**
+   * @desc    Init screen of display, first frame sends every tile
+   *
+   * @param   TILE_Screen * screen
+   * @param   ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void TILE_Init (TILE_Screen *, ST7735_Display *);
+
+  /**
+   * @desc    Forget hashes - display changed by other drawing
+   *
+   * @param   TILE_Screen * screen
+   *
+   * @return  void
+   */
+  void TILE_Invalidate (TILE_Screen *);
+
+  /**
+   * @desc    CRC-32 of words - CRC unit / software
+   *
+   * @param   const uint32_t * words
+   * @param   uint16_t number of words
+   *
+   * @return  uint32_t
+   */
+  uint32_t TILE_Hash (const uint32_t *, uint16_t);
+
+  /**
+   * @desc    Draw frame tile by tile, send changed tiles only
+   *          Drawing must cover whole screen - background first
+   *
+   * @param   TILE_Screen * screen
+   * @param   TILE_Draw drawing
+   * @param   void * context of drawing
+   *
+   * @return  uint16_t number of sent tiles
+   */
+  uint16_t TILE_Render (TILE_Screen *, TILE_Draw, void *);
+
+#endif
@@ -0,0 +1,345 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        SPI trace Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        trace.c
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      trace.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Optional capture of bytes sent on SPI into RAM ring buffer. Bytes of same DC
+ *              level are appended to open record, new record starts on DC change, CS edge or
+ *              DMA fill. Hooks run in thread and interrupt context, ring is updated with
+ *              interrupts disabled. Edges of CS are sampled at next record, start and stop
+ *              write CS record with current level.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "trace.h"
+
+#ifdef SPI_TRACE
+
+/** @var Ring buffer, dumped by debugger */
+TRACE_Buffer traceBuffer = { .magic = TRACE_MAGIC, .size = TRACE_SIZE, .open = TRACE_CLOSED, .flags = TRACE_SHIFT << 8 };
+
+/** @var Watched bus and pins */
+static struct {
+  // bus
+  SPI_TypeDef *spi;
+  // chip select
+  GPIO_TypeDef *csPort;
+  uint16_t csPin;
+  // data / command
+  GPIO_TypeDef *dcPort;
+  uint16_t dcPin;
+} traceBus;
+
+/**
+ * @desc    Byte of ring at free running position
+ *
+ * @param   uint32_t position
+ *
+ * @return  uint8_t *
+ */
+static inline uint8_t * TRACE_At (uint32_t position)
+{
+  // wrap
+  return &traceBuffer.ring[position & (TRACE_SIZE - 1)];
+}
+
+/**
+ * @desc    Write byte at head
+ *
+ * @param   uint8_t byte
+ *
+ * @return  void
+ */
+static inline void TRACE_Put (uint8_t byte)
+{
+  // store and advance
+  *TRACE_At (traceBuffer.head++) = byte;
+}
+
+/**
+ * @desc    Length of record
+ *
+ * @param   uint32_t position of tag
+ *
+ * @return  uint32_t
+ */
+static uint32_t TRACE_Length (uint32_t position)
+{
+  // variables
+  uint8_t tag = *TRACE_At (position);
+
+  // by type
+  switch (tag & TRACE_TAG_MASK) {
+    // tag, time, count, item
+    case TRACE_TAG_REPEAT:
+      return 3 + 2 + (tag & 0x01) + 1;
+    // tag, time
+    case TRACE_TAG_CS:
+      return 3;
+    // tag, time, bytes
+    default:
+      return 3 + (tag & 0x3F) + 1;
+  }
+}
+
+/**
+ * @desc    Free space at head by dropping oldest records
+ *
+ * @param   uint32_t bytes
+ *
+ * @return  void
+ */
+static void TRACE_Reserve (uint32_t bytes)
+{
+  // till bytes fit
+  while ((traceBuffer.head + bytes - traceBuffer.first) > TRACE_SIZE) {
+    // open record dropped
+    if (traceBuffer.first == traceBuffer.open) {
+      traceBuffer.open = TRACE_CLOSED;
+    }
+    // next whole record
+    traceBuffer.first += TRACE_Length (traceBuffer.first);
+  }
+}
+
+/**
+ * @desc    Start record - tag and time since previous record
+ *
+ * @param   uint8_t tag
+ * @param   uint32_t bytes of payload
+ *
+ * @return  void
+ */
+static void TRACE_Record (uint8_t tag, uint32_t bytes)
+{
+  // variables
+  uint32_t delta = (TRACE_CYCLES () - traceBuffer.time) >> TRACE_SHIFT;
+
+  // space for whole record
+  TRACE_Reserve (3 + bytes);
+  // saturated, otherwise remainder kept for next record
+  if (delta > 0xFFFF) {
+    delta = 0xFFFF;
+    traceBuffer.time = TRACE_CYCLES ();
+  } else {
+    traceBuffer.time += delta << TRACE_SHIFT;
+  }
+  // tag and time LE
+  TRACE_Put (tag);
+  TRACE_Put ((uint8_t) delta);
+  TRACE_Put ((uint8_t) (delta >> 8));
+}
+
+/**
+ * @desc    Record edge of CS if level changed
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void TRACE_Edge (void)
+{
+  // variables
+  uint32_t level = (traceBus.csPort->ODR & traceBus.csPin) ? 0x02 : 0x00;
+
+  // changed since last record
+  if (level != (traceBuffer.flags & 0x02)) {
+    traceBuffer.flags ^= 0x02;
+    traceBuffer.open = TRACE_CLOSED;
+    TRACE_Record (TRACE_TAG_CS | (level >> 1), 0);
+  }
+}
+
+/**
+ * @desc    Open record of same type has space for next byte
+ *
+ * @param   uint8_t tag
+ *
+ * @return  uint8_t
+ */
+static uint8_t TRACE_Appendable (uint8_t tag)
+{
+  // variables
+  uint8_t open;
+
+  // no open record
+  if (traceBuffer.open == TRACE_CLOSED) {
+    return 0;
+  }
+  // same DC level and not full
+  open = *TRACE_At (traceBuffer.open);
+  return ((open & TRACE_TAG_MASK) == tag) && ((open & 0x3F) < (TRACE_RUN_MAX - 1));
+}
+
+/**
+ * @desc    Clear ring and start capture of bus
+ *
+ * @param   SPI_TypeDef * spi
+ * @param   GPIO_TypeDef * port of CS
+ * @param   uint16_t pin of CS
+ * @param   GPIO_TypeDef * port of DC
+ * @param   uint16_t pin of DC
+ *
+ * @return  void
+ */
+void TRACE_Start (SPI_TypeDef *spi, GPIO_TypeDef *csPort, uint16_t csPin, GPIO_TypeDef *dcPort, uint16_t dcPin)
+{
+  // variables
+  uint32_t primask = __get_PRIMASK ();
+
+  // no hook runs meanwhile
+  __disable_irq ();
+  // watched bus
+  traceBus.spi = spi;
+  traceBus.csPort = csPort;
+  traceBus.csPin = csPin;
+  traceBus.dcPort = dcPort;
+  traceBus.dcPin = dcPin;
+  // empty ring
+  traceBuffer.head = 0;
+  traceBuffer.first = 0;
+  traceBuffer.open = TRACE_CLOSED;
+  traceBuffer.time = TRACE_CYCLES ();
+  // running, first record is CS level at start
+  traceBuffer.flags = (TRACE_SHIFT << 8) | 0x01 | ((csPort->ODR & csPin) ? 0x00 : 0x02);
+  TRACE_Edge ();
+  __set_PRIMASK (primask);
+}
+
+/**
+ * @desc    Stop capture, ring stays for dump
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void TRACE_Stop (void)
+{
+  // variables
+  uint32_t primask = __get_PRIMASK ();
+
+  // not running
+  if (!(traceBuffer.flags & 0x01)) {
+    return;
+  }
+  __disable_irq ();
+  // end marks time of last transfer completion, also release of CS
+  traceBuffer.flags ^= 0x02;
+  TRACE_Edge ();
+  // stopped
+  traceBuffer.flags &= ~0x01;
+  __set_PRIMASK (primask);
+}
+
+/**
+ * @desc    Bytes sent on bus - hook of spi.c / spiq.c
+ *
+ * @param   SPI_TypeDef * spi
+ * @param   const uint8_t * bytes
+ * @param   uint16_t count
+ *
+ * @return  void
+ */
+void TRACE_Bytes (SPI_TypeDef *spi, const uint8_t *bytes, uint16_t count)
+{
+  // variables
+  uint32_t primask;
+  uint8_t tag;
+
+  // other bus or stopped
+  if (!(traceBuffer.flags & 0x01) || (spi != traceBus.spi)) {
+    return;
+  }
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  // CS edge before bytes
+  TRACE_Edge ();
+  // DC level
+  tag = (traceBus.dcPort->ODR & traceBus.dcPin) ? TRACE_TAG_DATA : TRACE_TAG_COMMAND;
+  // loop through bytes
+  while (count--) {
+    // space for one more byte, may drop open record
+    if (TRACE_Appendable (tag)) {
+      TRACE_Reserve (1);
+    }
+    // append to open record
+    if (TRACE_Appendable (tag)) {
+      (*TRACE_At (traceBuffer.open))++;
+    // new record
+    } else {
+      TRACE_Record (tag, 1);
+      traceBuffer.open = traceBuffer.head - 3;
+    }
+    TRACE_Put (*bytes++);
+  }
+  __set_PRIMASK (primask);
+}
+
+/**
+ * @desc    DMA transfer started on bus - hook of spi.c
+ *
+ * @param   SPI_TypeDef * spi
+ * @param   const void * buffer
+ * @param   uint16_t count of items
+ * @param   uint8_t width of item in bytes (1 / 2)
+ * @param   uint8_t memory increment, otherwise one item repeated
+ *
+ * @return  void
+ */
+void TRACE_Block (SPI_TypeDef *spi, const void *buffer, uint16_t count, uint8_t width, uint8_t increment)
+{
+  // variables
+  const uint16_t *half = (const uint16_t *) buffer;
+  uint8_t item[2];
+  uint32_t primask;
+
+  // other bus or stopped
+  if (!(traceBuffer.flags & 0x01) || (spi != traceBus.spi)) {
+    return;
+  }
+  // sequence of bytes
+  if (increment && (width == 1)) {
+    TRACE_Bytes (spi, (const uint8_t *) buffer, count);
+    return;
+  }
+  // sequence of half words, MSB first on wire
+  if (increment) {
+    while (count--) {
+      item[0] = (uint8_t) (*half >> 8);
+      item[1] = (uint8_t) *half++;
+      TRACE_Bytes (spi, item, 2);
+    }
+    return;
+  }
+  // repeated item
+  primask = __get_PRIMASK ();
+  __disable_irq ();
+  TRACE_Edge ();
+  traceBuffer.open = TRACE_CLOSED;
+  TRACE_Record (TRACE_TAG_REPEAT | (width - 1), 2 + width);
+  // count LE
+  TRACE_Put ((uint8_t) count);
+  TRACE_Put ((uint8_t) (count >> 8));
+  // item MSB first
+  if (width == 2) {
+    TRACE_Put ((uint8_t) (*half >> 8));
+    TRACE_Put ((uint8_t) *half);
+  } else {
+    TRACE_Put (*(const uint8_t *) buffer);
+  }
+  __set_PRIMASK (primask);
+}
+
+#endif
@@ -0,0 +1,132 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        SPI trace Library
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        trace.h
+ * @version     1.0
+ * @tested      stm32f103c6t8
+ *
+ * @depend      stm32f10x.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Optional capture of bytes sent on SPI into RAM ring buffer - level of DC, edges
+ *              of CS, bytes and timestamps. Enabled by -DSPI_TRACE, otherwise hooks in spi.c
+ *              and spiq.c are not compiled and ring takes no RAM. Ring is dumped by debugger
+ *              (gdb: dump binary value trace.bin traceBuffer) and decoded by Tools/trace.
+ *
+ *              Record  = tag, time (16 bit LE, cycles since previous record >> TRACE_SHIFT),
+ *                        payload
+ *              0x00 | n-1 ... n bytes (1 - 64) with DC low follow
+ *              0x40 | n-1 ... n bytes (1 - 64) with DC high follow
+ *              0x80 | w-1 ... DMA repeated item with DC high - count (16 bit LE), item of w bytes
+ *                             (1 - 2) MSB first
+ *              0xC0 | l   ... CS changed to level l, also level at start and stop
+ *
+ *              Oldest records are overwritten, first always points to whole record.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+  #include <stm32f10x.h>
+
+  // Size of ring buffer - power of 2
+  // -----------------------------------
+  #ifndef TRACE_SIZE
+    #define TRACE_SIZE          2048              // bytes
+  #endif
+
+  // Cycle counter - DWT CYCCNT, enabled by application
+  // -----------------------------------
+  #ifndef TRACE_CYCLES
+    #define TRACE_CYCLES()      (*(volatile uint32_t *) 0xE0001004)
+  #endif
+
+  // Encoding
+  // -----------------------------------
+  #define TRACE_MAGIC           0x54495053        // "SPIT"
+  #define TRACE_SHIFT           4                 // time unit 16 cycles
+  #define TRACE_TAG_COMMAND     0x00              // bytes with DC low
+  #define TRACE_TAG_DATA        0x40              // bytes with DC high
+  #define TRACE_TAG_REPEAT      0x80              // DMA repeated item
+  #define TRACE_TAG_CS          0xC0              // CS edge
+  #define TRACE_TAG_MASK        0xC0
+  #define TRACE_RUN_MAX         64                // max bytes of one record
+  #define TRACE_CLOSED          0xFFFFFFFF        // no record open for appending
+
+  /** @struct Ring buffer - layout read by Tools/trace, all fields 32 bit LE */
+  typedef struct {
+    // TRACE_MAGIC
+    uint32_t magic;
+    // bytes of ring
+    uint32_t size;
+    // write position, free running
+    volatile uint32_t head;
+    // oldest whole record, free running
+    volatile uint32_t first;
+    // bytes record open for appending / TRACE_CLOSED
+    uint32_t open;
+    // cycles of last record
+    uint32_t time;
+    // bit 0 - running, bit 1 - last CS level, bits 8..15 - TRACE_SHIFT
+    uint32_t flags;
+    // records
+    uint8_t ring[TRACE_SIZE];
+  } TRACE_Buffer;
+
+  /** @var Ring buffer, dumped by debugger */
+  extern TRACE_Buffer traceBuffer;
+
+  /**
+   * @desc    Clear ring and start capture of bus
+   *
+   * @param   SPI_TypeDef * spi
+   * @param   GPIO_TypeDef * port of CS
+   * @param   uint16_t pin of CS
+   * @param   GPIO_TypeDef * port of DC
+   * @param   uint16_t pin of DC
+   *
+   * @return  void
+   */
+  void TRACE_Start (SPI_TypeDef *, GPIO_TypeDef *, uint16_t, GPIO_TypeDef *, uint16_t);
+
+  /**
+   * @desc    Stop capture, ring stays for dump
+   *
+   * @param   void
+   *
+   * @return  void
+   */
+  void TRACE_Stop (void);
+
+  /**
+   * @desc    Bytes sent on bus - hook of spi.c / spiq.c
+   *
+   * @param   SPI_TypeDef * spi
+   * @param   const uint8_t * bytes
+   * @param   uint16_t count
+   *
+   * @return  void
+   */
+  void TRACE_Bytes (SPI_TypeDef *, const uint8_t *, uint16_t);
+
+  /**
+   * @desc    DMA transfer started on bus - hook of spi.c
+   *
+   * @param   SPI_TypeDef * spi
+   * @param   const void * buffer
+   * @param   uint16_t count of items
+   * @param   uint8_t width of item in bytes (1 / 2)
+   * @param   uint8_t memory increment, otherwise one item repeated
+   *
+   * @return  void
+   */
+  void TRACE_Block (SPI_TypeDef *, const void *, uint16_t, uint8_t, uint8_t);
+
+#endif
@@ -21,6 +21,13 @@
  
 // libraries
 #include "../Library/st7735.h"
+#include "../Library/bar.h"
+
+/** @var Display on SPI1 */
+ST7735_Display lcd = ST7735_DISPLAY_SPI1;
+
+/** @var Loading bar */
+static BAR_Bar loading;
 
 /**
  * @desc    Main
@@ -35,29 +42,33 @@ int main (void)
   uint8_t start = 30;
   // end
   uint8_t end = MAX_X - start;
+  // area of loading bar
+  ST7735_Rect area = { start, end - 1, 30, 40 };
 
   // st7735
   // -------------------------------------------------------
-  ST7735_Init (SPI1);
+  ST7735_Init (&lcd);
 
   // clear screen
-  ST7735_ClearScreen (WHITE);
+  ST7735_ClearScreen (&lcd, WHITE);
   // set position X, Y
-  ST7735_SetPosition (start + 12, 10);  
+  ST7735_SetPosition (&lcd, start + 12, 10);  
   // draw string
-  ST7735_DrawString ("STM32F103C8T6", BLACK, X2);
+  ST7735_DrawString (&lcd, "STM32F103C8T6", BLACK, X2);
 
+  // loading bar on white background
+  BAR_Init (&loading, &lcd, &area, BAR_PROGRESS, BAR_RIGHT, end - start, RED, WHITE);
   // draw Loading
-  for (uint8_t i = start; i < end; i++) {
-    // draw rectangle
-    ST7735_DrawRectangle (start, i, 30, 40, RED);
+  for (uint8_t i = 1; i <= end - start; i++) {
+    // only new column of bar
+    BAR_Set (&loading, i);
     // delay
     Delay_Ms (10);
   }
   // set position
-  ST7735_SetPosition (10, 50);
+  ST7735_SetPosition (&lcd, 10, 50);
   // draw char
-  ST7735_DrawString ("BLACKPILL <=> LCD ST7735", BLACK, X2);
+  ST7735_DrawString (&lcd, "BLACKPILL <=> LCD ST7735", BLACK, X2);
 
   // return
   // -------------------------------------------------------
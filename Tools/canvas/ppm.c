@@ -0,0 +1,116 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        PPM canvas - host backend
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        ppm.c
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      ppm.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Canvas drawing into host memory, written out as binary PPM image (P6)
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      http://netpbm.sourceforge.net/doc/ppm.html
+ */
+
+/** @includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include "ppm.h"
+
+/**
+ * @desc    Allocate image and init canvas on it
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   int16_t width
+ * @param   int16_t height
+ *
+ * @return  uint8_t
+ */
+uint8_t PPM_Init (CANVAS_Canvas *canvas, int16_t width, int16_t height)
+{
+  // variables
+  uint8_t *pixels = calloc ((size_t) width * height, 2);
+
+  // no memory
+  if (pixels == NULL) {
+    return PPM_ERROR;
+  }
+  // whole image in memory
+  CANVAS_RAM_Init (canvas, pixels, width, height, height);
+
+  // success
+  return PPM_SUCCESS;
+}
+
+/**
+ * @desc    Write pixels RGB565 MSB first as PPM file
+ *
+ * @param   const uint8_t * pixels
+ * @param   int16_t width
+ * @param   int16_t height
+ * @param   const char * path
+ *
+ * @return  uint8_t
+ */
+uint8_t PPM_Write (const uint8_t *pixels, int16_t width, int16_t height, const char *path)
+{
+  // variables
+  FILE *file = fopen (path, "wb");
+  uint16_t color;
+  uint8_t rgb[3];
+  int32_t i;
+
+  // not opened
+  if (file == NULL) {
+    return PPM_ERROR;
+  }
+  // header
+  fprintf (file, "P6\n%d %d\n255\n", width, height);
+  // loop through pixels
+  for (i = 0; i < (int32_t) width * height; i++) {
+    // RGB565 MSB first
+    color = (pixels[i << 1] << 8) | pixels[(i << 1) + 1];
+    // expand channels to 8 bits
+    rgb[0] = ((color >> 11) << 3) | (color >> 13);
+    rgb[1] = (((color >> 5) & 0x3F) << 2) | ((color >> 9) & 0x03);
+    rgb[2] = ((color & 0x1F) << 3) | ((color >> 2) & 0x07);
+    fwrite (rgb, 1, 3, file);
+  }
+
+  // close
+  return (fclose (file) == 0) ? PPM_SUCCESS : PPM_ERROR;
+}
+
+/**
+ * @desc    Write image of canvas as PPM file
+ *
+ * @param   const CANVAS_Canvas * canvas
+ * @param   const char * path
+ *
+ * @return  uint8_t
+ */
+uint8_t PPM_Save (const CANVAS_Canvas *canvas, const char *path)
+{
+  // rows in memory
+  return PPM_Write ((const uint8_t *) canvas->target, canvas->width, canvas->rows, path);
+}
+
+/**
+ * @desc    Free image of canvas
+ *
+ * @param   CANVAS_Canvas * canvas
+ *
+ * @return  void
+ */
+void PPM_Free (CANVAS_Canvas *canvas)
+{
+  // image
+  free (canvas->target);
+  canvas->target = NULL;
+}
@@ -0,0 +1,73 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        PPM canvas - host backend
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        ppm.h
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      canvas.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Canvas drawing into host memory, written out as binary PPM image (P6)
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      http://netpbm.sourceforge.net/doc/ppm.html
+ */
+
+#ifndef __PPM_H__
+#define __PPM_H__
+
+  #include "canvas.h"
+
+  // Return codes
+  // -----------------------------------
+  #define PPM_SUCCESS           1
+  #define PPM_ERROR             0
+
+  /**
+   * @desc    Allocate image and init canvas on it
+   *
+   * @param   CANVAS_Canvas * canvas
+   * @param   int16_t width
+   * @param   int16_t height
+   *
+   * @return  uint8_t
+   */
+  uint8_t PPM_Init (CANVAS_Canvas *, int16_t, int16_t);
+
+  /**
+   * @desc    Write pixels RGB565 MSB first as PPM file
+   *
+   * @param   const uint8_t * pixels
+   * @param   int16_t width
+   * @param   int16_t height
+   * @param   const char * path
+   *
+   * @return  uint8_t
+   */
+  uint8_t PPM_Write (const uint8_t *, int16_t, int16_t, const char *);
+
+  /**
+   * @desc    Write image of canvas as PPM file
+   *
+   * @param   const CANVAS_Canvas * canvas
+   * @param   const char * path
+   *
+   * @return  uint8_t
+   */
+  uint8_t PPM_Save (const CANVAS_Canvas *, const char *);
+
+  /**
+   * @desc    Free image of canvas
+   *
+   * @param   CANVAS_Canvas * canvas
+   *
+   * @return  void
+   */
+  void PPM_Free (CANVAS_Canvas *);
+
+#endif
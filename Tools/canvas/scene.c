@@ -0,0 +1,140 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Canvas demo - host tool
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        scene.c
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      canvas.h, ppm.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Draws the same scene into whole image and strip by strip, checks that both
+ *              give identical pixels and writes image as PPM.
+ *
+ *              Usage: scene [output.ppm]
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include <stdio.h>
+#include <string.h>
+#include "canvas.h"
+#include "ppm.h"
+
+// Geometry - same as Library/st7735.h, ROTATE_0
+// -----------------------------------
+#define MAX_X                 161
+#define MAX_Y                 130
+#define STRIP_ROWS            16
+
+// Colors - same as Library/st7735.h
+// -----------------------------------
+#define BLACK                 0x0000
+#define WHITE                 0xFFFF
+#define GREEN                 0x07E0
+#define BLUE                  0x00FF
+#define RED                   0xF000
+
+/**
+ * @desc    Scene with every primitive
+ *
+ * @param   CANVAS_Canvas * canvas
+ *
+ * @return  void
+ */
+static void Scene_Draw (CANVAS_Canvas *canvas)
+{
+  // variables
+  static uint8_t bitmap[16 * 16 * 2];
+  CANVAS_Rect panel = { 100, 150, 70, 100 };
+  uint16_t color;
+  int16_t i;
+
+  // bitmap - diagonal gradient
+  for (i = 0; i < 16 * 16; i++) {
+    color = (((i & 15) << 1) << 11) | (((i >> 4) << 2) << 5) | 0x10;
+    bitmap[i << 1] = (uint8_t) (color >> 8);
+    bitmap[(i << 1) + 1] = (uint8_t) color;
+  }
+
+  // background
+  CANVAS_FillRect (canvas, 0, MAX_X - 1, 0, MAX_Y - 1, WHITE);
+  // header
+  CANVAS_FillRect (canvas, 0, MAX_X - 1, 0, 11, BLUE);
+  CANVAS_DrawText (canvas, 4, 2, "STM32F103C8T6", WHITE, BLUE, CANVAS_X1);
+  // fan of lines
+  for (i = 0; i <= 60; i += 10) {
+    CANVAS_DrawLine (canvas, 10, 70, 20, 20 + i, RED);
+    CANVAS_DrawLine (canvas, 10, 10 + i, 20, 80, GREEN);
+  }
+  // frame and bitmap
+  CANVAS_DrawFrame (canvas, 80, 140, 20, 60, BLACK);
+  CANVAS_DrawBitmap (canvas, 102, 32, 16, 16, bitmap);
+  // text and bitmap clipped by panel
+  CANVAS_SetClip (canvas, &panel);
+  CANVAS_FillRect (canvas, 0, MAX_X - 1, 0, MAX_Y - 1, GREEN);
+  CANVAS_DrawText (canvas, 90, 75, "CLIPPED", BLACK, GREEN, CANVAS_X3);
+  CANVAS_DrawBitmap (canvas, 140, 92, 16, 16, bitmap);
+  CANVAS_SetClip (canvas, NULL);
+  // footer, partly off screen
+  CANVAS_DrawText (canvas, -3, 118, "BLACKPILL <=> LCD ST7735", BLACK, WHITE, CANVAS_X2);
+}
+
+/**
+ * @desc    Main
+ *
+ * @param   int argc
+ * @param   char ** argv
+ *
+ * @return  int
+ */
+int main (int argc, char **argv)
+{
+  // variables
+  static uint8_t memory[MAX_X * STRIP_ROWS * 2];
+  CANVAS_Canvas image;
+  CANVAS_Canvas strip;
+  const uint8_t *pixels;
+  size_t bytes;
+  int16_t origin;
+  int16_t rows;
+  int errors = 0;
+
+  // whole image
+  if (PPM_Init (&image, MAX_X, MAX_Y) == PPM_ERROR) {
+    fprintf (stderr, "scene: no memory\n");
+    return 1;
+  }
+  Scene_Draw (&image);
+
+  // strip by strip
+  CANVAS_RAM_Init (&strip, memory, MAX_X, MAX_Y, STRIP_ROWS);
+  for (origin = 0; origin < MAX_Y; origin += STRIP_ROWS) {
+    CANVAS_RAM_Move (&strip, origin);
+    Scene_Draw (&strip);
+    // compare rows of strip with image
+    rows = (origin + STRIP_ROWS > MAX_Y) ? (MAX_Y - origin) : STRIP_ROWS;
+    pixels = (const uint8_t *) image.target + (origin * MAX_X * 2);
+    bytes = (size_t) rows * MAX_X * 2;
+    if (memcmp (pixels, memory, bytes) != 0) {
+      fprintf (stderr, "scene: strip at row %d differs\n", origin);
+      errors++;
+    }
+  }
+
+  // image
+  if (PPM_Save (&image, (argc > 1) ? argv[1] : "scene.ppm") == PPM_ERROR) {
+    fprintf (stderr, "scene: write failed\n");
+    errors++;
+  }
+  PPM_Free (&image);
+
+  // result
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,309 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Display list compiler - host tool
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        dlistc.c
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      font.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Builds display list (Library/dlist.h format) offline from text script and
+ *              prints it as C array for flash. Script, one command per line, '#' comment:
+ *
+ *              name   identifier
+ *              clear  color
+ *              rect   xs xe ys ye color
+ *              pixel  x y color
+ *              text   x y X1|X2|X3 color background string till end of line
+ *
+ *              Usage: dlistc screen.txt > screen.h
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "font.h"
+
+// Records - same as Library/dlist.h
+// -----------------------------------
+#define DLIST_END             0x00
+#define DLIST_WINDOW          0x01
+#define DLIST_FILL            0x02
+#define DLIST_PIXELS          0x03
+#define DLIST_WRITE           0x05
+#define DLIST_RUN_MIN         4
+
+// Geometry - same as Library/st7735.h, ROTATE_0
+// -----------------------------------
+#define MAX_X                 161
+#define MAX_Y                 130
+#define CHARS_COLS_LEN        5
+#define CHARS_ROWS_LEN        8
+#define LIST_SIZE             65536
+
+/** @var List */
+static uint8_t list[LIST_SIZE];
+/** @var Used bytes */
+static size_t length;
+/** @var Pixels of window */
+static uint16_t pixels[MAX_X * MAX_Y];
+
+/**
+ * @desc    Append byte, exit on overflow
+ *
+ * @param   uint8_t byte
+ *
+ * @return  void
+ */
+static void Put (uint8_t byte)
+{
+  // full
+  if (length >= LIST_SIZE - 1) {
+    fprintf (stderr, "dlistc: list too long\n");
+    exit (1);
+  }
+  // append
+  list[length++] = byte;
+}
+
+/**
+ * @desc    Append 16 bit value MSB first
+ *
+ * @param   uint16_t value
+ *
+ * @return  void
+ */
+static void Put16 (uint16_t value)
+{
+  // MSB, LSB
+  Put (value >> 8);
+  Put (value & 0xFF);
+}
+
+/**
+ * @desc    Append window record and start of RAM write
+ *
+ * @param   int x0, x1, y0, y1
+ *
+ * @return  int 0 - out of screen
+ */
+static int Window (int x0, int x1, int y0, int y1)
+{
+  // check range
+  if ((x0 < 0) || (x0 > x1) || (x1 > MAX_X - 1) ||
+      (y0 < 0) || (y0 > y1) || (y1 > MAX_Y - 1)) {
+    return 0;
+  }
+  // CASET / RASET
+  Put (DLIST_WINDOW);
+  Put (x0);
+  Put (x1);
+  Put (y0);
+  Put (y1);
+  // RAMWR
+  Put (DLIST_WRITE);
+  // success
+  return 1;
+}
+
+/**
+ * @desc    Append pixels of window - runs of DLIST_RUN_MIN equal pixels as fill
+ *
+ * @param   const uint16_t * pixels
+ * @param   size_t count
+ *
+ * @return  void
+ */
+static void Pixels (const uint16_t *pixel, size_t count)
+{
+  // variables
+  size_t i = 0;
+  size_t start;
+  size_t run;
+
+  // loop through pixels
+  while (i < count) {
+    // literal pixels till next long run
+    start = i;
+    while (i < count) {
+      // length of run
+      for (run = 1; (i + run < count) && (run < 0xFFFF) && (pixel[i + run] == pixel[i]); run++);
+      // long run
+      if (run >= DLIST_RUN_MIN) {
+        break;
+      }
+      // literal
+      i += run;
+    }
+    // literal record
+    while (start < i) {
+      // max count
+      size_t n = ((i - start) > 0xFFFF) ? 0xFFFF : (i - start);
+      Put (DLIST_PIXELS);
+      Put16 (n);
+      while (n--) {
+        Put16 (pixel[start++]);
+      }
+    }
+    // fill record
+    if (i < count) {
+      Put (DLIST_FILL);
+      Put16 (pixel[i]);
+      Put16 (run);
+      i += run;
+    }
+  }
+}
+
+/**
+ * @desc    Render text as one window like ST7735_DrawGlyphRun
+ *
+ * @param   int x, y
+ * @param   const char * size X1, X2, X3
+ * @param   uint16_t color, background
+ * @param   const char * string
+ *
+ * @return  int 0 - error
+ */
+static int Text (int x, int y, const char *size, uint16_t color, uint16_t background, const char *str)
+{
+  // scale
+  int sx = (strcmp (size, "X3") == 0) ? 2 : 1;
+  int sy = (strcmp (size, "X1") == 0) ? 1 : 2;
+  int cell = CHARS_COLS_LEN * sx + 1;
+  int len = strlen (str);
+  int width = len * cell;
+  int height = CHARS_ROWS_LEN * sy;
+  int col, row;
+  const uint8_t *glyph;
+  char c;
+
+  // window of whole string
+  if ((len == 0) || !Window (x, x + width - 1, y, y + height - 1)) {
+    return 0;
+  }
+  // expand rows
+  for (row = 0; row < height; row++) {
+    for (col = 0; col < width; col++) {
+      // character, out of range as space
+      c = str[col / cell];
+      glyph = FONTS[((c < 0x20) || (c > 0x7f)) ? 0 : (c - 0x20)];
+      // column of character, spacing column empty
+      int idx = (col % cell) / sx;
+      int on = (idx < CHARS_COLS_LEN) && (glyph[idx] & (1 << (row / sy)));
+      pixels[row * width + col] = on ? color : background;
+    }
+  }
+  // pixels
+  Pixels (pixels, (size_t) width * height);
+  // success
+  return 1;
+}
+
+/**
+ * @desc    Main
+ *
+ * @param   int argc
+ * @param   char ** argv
+ *
+ * @return  int
+ */
+int main (int argc, char **argv)
+{
+  // variables
+  char line[512];
+  char name[64] = "dlist";
+  char size[8];
+  char cmd[16];
+  int a, b, c, d, e, f;
+  int n = 0;
+  int offset;
+  size_t i;
+  FILE *in;
+
+  // arguments
+  if (argc != 2) {
+    fprintf (stderr, "usage: dlistc script.txt > list.h\n");
+    return 1;
+  }
+  // open script
+  in = fopen (argv[1], "r");
+  if (in == NULL) {
+    perror (argv[1]);
+    return 1;
+  }
+  // loop through lines
+  while (fgets (line, sizeof (line), in) != NULL) {
+    // line number
+    n++;
+    // strip new line
+    line[strcspn (line, "\r\n")] = '\0';
+    // empty line or comment
+    if ((sscanf (line, "%15s", cmd) != 1) || (cmd[0] == '#')) {
+      continue;
+    }
+    // name of array
+    if (strcmp (cmd, "name") == 0) {
+      if (sscanf (line, "%*s %63s", name) == 1) {
+        continue;
+      }
+    // whole screen
+    } else if (strcmp (cmd, "clear") == 0) {
+      if ((sscanf (line, "%*s %i", &a) == 1) && Window (0, MAX_X - 1, 0, MAX_Y - 1)) {
+        Put (DLIST_FILL);
+        Put16 (a);
+        Put16 (MAX_X * MAX_Y);
+        continue;
+      }
+    // rectangle
+    } else if (strcmp (cmd, "rect") == 0) {
+      if ((sscanf (line, "%*s %i %i %i %i %i", &a, &b, &c, &d, &e) == 5) && Window (a, b, c, d)) {
+        Put (DLIST_FILL);
+        Put16 (e);
+        Put16 ((b - a + 1) * (d - c + 1));
+        continue;
+      }
+    // pixel
+    } else if (strcmp (cmd, "pixel") == 0) {
+      if ((sscanf (line, "%*s %i %i %i", &a, &b, &c) == 3) && Window (a, a, b, b)) {
+        Put (DLIST_PIXELS);
+        Put16 (1);
+        Put16 (c);
+        continue;
+      }
+    // text
+    } else if (strcmp (cmd, "text") == 0) {
+      if ((sscanf (line, "%*s %i %i %7s %i %i %n", &a, &b, size, &e, &f, &offset) == 5) &&
+          Text (a, b, size, e, f, line + offset)) {
+        continue;
+      }
+    }
+    // not recognized
+    fprintf (stderr, "%s:%d: invalid command: %s\n", argv[1], n, line);
+    return 1;
+  }
+  fclose (in);
+  // terminate
+  list[length++] = DLIST_END;
+
+  // C array
+  printf ("/** @const Display list %s - generated by dlistc from %s */\n", name, argv[1]);
+  printf ("const uint8_t %s[%zu] = {", name, length);
+  for (i = 0; i < length; i++) {
+    printf ("%s0x%02X%s", (i % 12) ? " " : "\n  ", list[i], (i < length - 1) ? "," : "");
+  }
+  printf ("\n};\n");
+
+  // success
+  return 0;
+}
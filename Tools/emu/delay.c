@@ -0,0 +1,60 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Fake delay - host emulator
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        delay.c
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      libdelay.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Replaces Library/libdelay.c on host, delays of init sequence take no time
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include <stm32f10x.h>
+#include "libdelay.h"
+
+/**
+ * @desc    SysTick interrupt Handler
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void SysTick_Handler (void)
+{
+}
+
+/**
+ * @desc    Delay init
+ *
+ * @param   void
+ *
+ * @return  ErrorStatus
+ */
+ErrorStatus Delay_Init (void)
+{
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Delay ms - returns at once
+ *
+ * @param   uint32_t
+ *
+ * @return  void
+ */
+void Delay_Ms (uint32_t time)
+{
+  // unused
+  (void) time;
+}
@@ -0,0 +1,339 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7735 emulator - host tool
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        emu.c
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      emu.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Fake GPIO / SPI / DMA of STM32F103 - bytes on bus go to selected panels, DC
+ *              level is read from pins. Transfers finish immediately, interrupts are
+ *              delivered as soon as they are enabled.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      http://www.displayfuture.com/Display/datasheet/controller/ST7735.pdf
+ */
+
+/** @includes */
+#include "emu.h"
+
+/** @var Peripherals */
+GPIO_TypeDef emuGPIOA, emuGPIOB, emuGPIOC;
+SPI_TypeDef emuSPI1, emuSPI2;
+RCC_TypeDef emuRCC;
+uint32_t SystemCoreClock = 72000000;
+
+/** @var Attached panels */
+static EMU_Panel *emuPanel[EMU_PANELS];
+
+/** @var Pending DMA interrupts - channel 3 (SPI1), channel 5 (SPI2) */
+static uint8_t emuDMA[2];
+
+/** @var Pending TXE interrupts - SPI1, SPI2 */
+static uint8_t emuTXE[2];
+
+/** @var Interrupts disabled */
+static uint8_t emuMasked;
+
+/** @var Inside of interrupt handler */
+static uint8_t emuInside;
+
+/** @var Cycles spent on bus */
+static uint32_t emuCycles;
+
+/** @var Interrupt handlers of Library */
+#ifndef SPIBUS_NO_DMA
+extern void DMA1_Channel3_IRQHandler (void);
+extern void DMA1_Channel5_IRQHandler (void);
+#endif
+extern void SPI1_IRQHandler (void);
+extern void SPI2_IRQHandler (void);
+
+/**
+ * @desc    Run TXE interrupt of bus while enabled, byte written to DR goes out
+ *
+ * @param   SPI_TypeDef * spi
+ * @param   void (*handler) (void)
+ *
+ * @return  void
+ */
+static void EMU_TXE_Run (SPI_TypeDef *spi, void (*handler) (void))
+{
+  // interrupt stops itself
+  while (spi->CR2 & SPI_CR2_TXEIE) {
+    // mark register
+    spi->DR = EMU_UNTOUCHED;
+    // transmit buffer empty
+    handler ();
+    // byte written
+    if (spi->DR != EMU_UNTOUCHED) {
+      EMU_Byte (spi, (uint8_t) spi->DR);
+    }
+  }
+}
+
+/**
+ * @desc    Deliver pending interrupts, handler may start next transfer
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void EMU_Deliver (void)
+{
+  // masked or nested
+  if (emuMasked || emuInside) {
+    return;
+  }
+  emuInside = 1;
+  // till nothing is pending
+  while (emuDMA[0] || emuDMA[1] || emuTXE[0] || emuTXE[1]) {
+#ifndef SPIBUS_NO_DMA
+    // SPI1 TX
+    if (emuDMA[0]) {
+      emuDMA[0] = 0;
+      DMA1_Channel3_IRQHandler ();
+    }
+    // SPI2 TX
+    if (emuDMA[1]) {
+      emuDMA[1] = 0;
+      DMA1_Channel5_IRQHandler ();
+    }
+#endif
+    // SPI1 transmit buffer empty
+    if (emuTXE[0]) {
+      emuTXE[0] = 0;
+      EMU_TXE_Run (SPI1, SPI1_IRQHandler);
+    }
+    // SPI2 transmit buffer empty
+    if (emuTXE[1]) {
+      emuTXE[1] = 0;
+      EMU_TXE_Run (SPI2, SPI2_IRQHandler);
+    }
+  }
+  emuInside = 0;
+}
+
+/**
+ * @desc    Disable interrupts
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void __disable_irq (void)
+{
+  // mask
+  emuMasked = 1;
+}
+
+/**
+ * @desc    Enable interrupts, pending ones run immediately
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void __enable_irq (void)
+{
+  // unmask
+  emuMasked = 0;
+  // deliver
+  EMU_Deliver ();
+}
+
+/**
+ * @desc    Interrupt mask
+ *
+ * @param   void
+ *
+ * @return  uint32_t
+ */
+uint32_t __get_PRIMASK (void)
+{
+  // 1 - disabled
+  return emuMasked;
+}
+
+/**
+ * @desc    Restore interrupt mask
+ *
+ * @param   uint32_t primask
+ *
+ * @return  void
+ */
+void __set_PRIMASK (uint32_t primask)
+{
+  // enable delivers pending ones
+  if (primask) {
+    __disable_irq ();
+  } else {
+    __enable_irq ();
+  }
+}
+
+/**
+ * @desc    DMA transfer complete of bus - delivered when interrupts enabled
+ *
+ * @param   SPI_TypeDef * spi
+ *
+ * @return  void
+ */
+void EMU_Pending (SPI_TypeDef *spi)
+{
+  // channel of bus
+  emuDMA[spi == SPI2] = 1;
+  // deliver
+  EMU_Deliver ();
+}
+
+/**
+ * @desc    Run TXE interrupt of bus till it is disabled
+ *
+ * @param   SPI_TypeDef * spi
+ *
+ * @return  void
+ */
+void EMU_TXE (SPI_TypeDef *spi)
+{
+  // interrupt of bus
+  emuTXE[spi == SPI2] = 1;
+  // deliver
+  EMU_Deliver ();
+}
+
+/**
+ * @desc    Cycles of 72 MHz core spent on bus so far
+ *
+ * @param   void
+ *
+ * @return  uint32_t
+ */
+uint32_t EMU_Cycles (void)
+{
+  // counter
+  return emuCycles;
+}
+
+/**
+ * @desc    Set bits of register, BSRR / BRR move pin levels
+ *
+ * @param   volatile uint32_t * reg
+ * @param   uint32_t bits
+ *
+ * @return  void
+ */
+void EMU_Set_Bit (__IO uint32_t *reg, uint32_t bits)
+{
+  // variables
+  GPIO_TypeDef *port[3] = { GPIOA, GPIOB, GPIOC };
+  EMU_Panel *panel;
+  uint32_t odr;
+  uint8_t i;
+  uint8_t j;
+
+  // loop through ports
+  for (i = 0; i < 3; i++) {
+    // set / reset register
+    if (reg == &port[i]->BSRR) {
+      odr = (port[i]->ODR | (bits & 0xFFFF)) & ~(bits >> 16);
+    // reset register
+    } else if (reg == &port[i]->BRR) {
+      odr = port[i]->ODR & ~(bits & 0xFFFF);
+    // other register of port
+    } else {
+      continue;
+    }
+    // rising chip select restarts interface of panel
+    for (j = 0; j < EMU_PANELS; j++) {
+      panel = emuPanel[j];
+      if ((panel != NULL) &&
+          (panel->cs.port == port[i]) &&
+          (odr & panel->cs.pin) &&
+          !(port[i]->ODR & panel->cs.pin)) {
+        panel->count = 0;
+      }
+    }
+    // new levels
+    port[i]->ODR = odr;
+    return;
+  }
+  // plain register
+  *reg |= bits;
+}
+
+/**
+ * @desc    Pin at low level
+ *
+ * @param   const ST7735_Pin * pin
+ *
+ * @return  uint8_t
+ */
+static uint8_t EMU_Pin_Low (const ST7735_Pin *pin)
+{
+  // output data register
+  return (pin->port->ODR & pin->pin) == 0;
+}
+
+/**
+ * @desc    Byte shifted out on bus - fake SPI
+ *
+ * @param   SPI_TypeDef * spi
+ * @param   uint8_t byte
+ *
+ * @return  uint8_t byte shifted in from MISO
+ */
+uint8_t EMU_Byte (SPI_TypeDef *spi, uint8_t byte)
+{
+  // variables
+  EMU_Panel *panel;
+  uint8_t miso = 0;
+  uint8_t i;
+
+  // 8 clocks of f PCLK / (2 << BR)
+  emuCycles += 8 * (2 << ((spi->CR1 & SPI_CR1_BR) >> 3));
+  // selected panels on bus
+  for (i = 0; i < EMU_PANELS; i++) {
+    panel = emuPanel[i];
+    if ((panel != NULL) && (panel->spi == spi) && EMU_Pin_Low (&panel->cs)) {
+      miso |= EMU_Receive (panel, byte, !EMU_Pin_Low (&panel->dc));
+    }
+  }
+  // wired to MISO
+  return miso;
+}
+
+/**
+ * @desc    Attach model to pins and bus of display
+ *
+ * @param   EMU_Panel * panel
+ * @param   const ST7735_Display * lcd
+ *
+ * @return  void
+ */
+void EMU_Attach (EMU_Panel *panel, const ST7735_Display *lcd)
+{
+  // variables
+  uint8_t i;
+
+  // wiring
+  panel->spi = lcd->bus->spi;
+  panel->cs.port = lcd->device.port;
+  panel->cs.pin = lcd->device.pin;
+  panel->dc = lcd->dc;
+  // state after reset
+  EMU_Reset (panel);
+  // free slot
+  for (i = 0; i < EMU_PANELS; i++) {
+    if ((emuPanel[i] == NULL) || (emuPanel[i] == panel)) {
+      emuPanel[i] = panel;
+      return;
+    }
+  }
+}
@@ -0,0 +1,174 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7735 emulator - host tool
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        emu.h
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      st7735.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Fake GPIO / SPI / DMA of STM32F103 and model of ST7735 decoding bytes on bus -
+ *              CASET, RASET, RAMWR, MADCTL and COLMOD into GRAM 132 x 162. Library runs
+ *              unchanged on Linux, GRAM is written out as PPM image.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      http://www.displayfuture.com/Display/datasheet/controller/ST7735.pdf
+ */
+
+#ifndef __EMU_H__
+#define __EMU_H__
+
+  #include "st7735.h"
+
+  // Model definition
+  // -----------------------------------
+  #define EMU_COLS              132               // physical columns of GRAM
+  #define EMU_ROWS              162               // physical rows of GRAM
+  #define EMU_WIDTH             MAX_X             // landscape view (ROTATE_0)
+  #define EMU_HEIGHT            MAX_Y             // landscape view (ROTATE_0)
+  #define EMU_PANELS            2                 // max attached panels
+  #define EMU_UNTOUCHED         0x10000           // DR not written by interrupt
+
+  /** @struct Traffic of panel */
+  typedef struct {
+    // bytes while selected
+    uint32_t bytes;
+    // command bytes
+    uint32_t commands;
+    // CASET and RASET commands
+    uint32_t windows;
+    // RAMWR commands
+    uint32_t writes;
+    // pixels written into GRAM
+    uint32_t pixels;
+    // pixels outside of GRAM
+    uint32_t dropped;
+    // pixels read from GRAM
+    uint32_t read;
+  } EMU_Stats;
+
+  /** @struct Panel model */
+  typedef struct {
+    // bus
+    SPI_TypeDef *spi;
+    // chip select
+    ST7735_Pin cs;
+    // data / command
+    ST7735_Pin dc;
+    // memory RGB565
+    uint16_t gram[EMU_ROWS][EMU_COLS];
+    // memory access control
+    uint8_t madctl;
+    // pixel format
+    uint8_t colmod;
+    // window
+    uint16_t xs, xe, ys, ye;
+    // address counters
+    uint16_t x, y;
+    // vertical scroll - on, top fixed rows, scrolled rows, first shown row
+    uint8_t scroll;
+    uint16_t tfa, vsa, ssa;
+    // last command
+    uint8_t command;
+    // bytes of parameter / pixel
+    uint8_t param[6];
+    uint8_t count;
+    // traffic
+    EMU_Stats stats;
+  } EMU_Panel;
+
+  /**
+   * @desc    Attach model to pins and bus of display
+   *
+   * @param   EMU_Panel * panel
+   * @param   const ST7735_Display * lcd
+   *
+   * @return  void
+   */
+  void EMU_Attach (EMU_Panel *, const ST7735_Display *);
+
+  /**
+   * @desc    State after hardware reset, black GRAM
+   *
+   * @param   EMU_Panel * panel
+   *
+   * @return  void
+   */
+  void EMU_Reset (EMU_Panel *);
+
+  /**
+   * @desc    Fill GRAM by color, reset traffic counters
+   *
+   * @param   EMU_Panel * panel
+   * @param   uint16_t color
+   *
+   * @return  void
+   */
+  void EMU_Clear (EMU_Panel *, uint16_t);
+
+  /**
+   * @desc    Byte received by panel
+   *
+   * @param   EMU_Panel * panel
+   * @param   uint8_t byte
+   * @param   uint8_t data (DC high) / command (DC low)
+   *
+   * @return  uint8_t byte driven on MISO at same time
+   */
+  uint8_t EMU_Receive (EMU_Panel *, uint8_t, uint8_t);
+
+  /**
+   * @desc    Byte shifted out on bus - fake SPI
+   *
+   * @param   SPI_TypeDef * spi
+   * @param   uint8_t byte
+   *
+   * @return  uint8_t byte shifted in from MISO
+   */
+  uint8_t EMU_Byte (SPI_TypeDef *, uint8_t);
+
+  /**
+   * @desc    DMA transfer complete of bus - delivered when interrupts enabled
+   *
+   * @param   SPI_TypeDef * spi
+   *
+   * @return  void
+   */
+  void EMU_Pending (SPI_TypeDef *);
+
+  /**
+   * @desc    Run TXE interrupt of bus till it is disabled
+   *
+   * @param   SPI_TypeDef * spi
+   *
+   * @return  void
+   */
+  void EMU_TXE (SPI_TypeDef *);
+
+  /**
+   * @desc    Pixel of landscape view (ROTATE_0) as shown, scroll applied
+   *
+   * @param   const EMU_Panel * panel
+   * @param   uint16_t x
+   * @param   uint16_t y
+   *
+   * @return  uint16_t
+   */
+  uint16_t EMU_Pixel (const EMU_Panel *, uint16_t, uint16_t);
+
+  /**
+   * @desc    Landscape view (ROTATE_0) as PPM file
+   *
+   * @param   const EMU_Panel * panel
+   * @param   const char * path
+   *
+   * @return  uint8_t
+   */
+  uint8_t EMU_Save (const EMU_Panel *, const char *);
+
+#endif
@@ -0,0 +1,1507 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7735 emulator - golden images of canonical scenes
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        main.c
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      emu.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Draws canonical scenes by unchanged Library through emulated bus and panel.
+ *              Every scene is written as <out>/<name>.ppm, compared with <ref>/<name>.ppm if
+ *              reference directory is given and its bytes on bus are checked against budget.
+ *              Display list scenes, clipped widgets and clipped canvas lines are compared with
+ *              live drawing of same screen pixel for pixel, byte counter of driver (traffic of
+ *              widgets) with bytes decoded by panel.
+ *              Exit code is 1 if any image differs or any budget is exceeded.
+ *
+ *              ./emu -o out              ... images of current tree
+ *              ./emu -o out -r golden    ... compare with images of known good tree
+ *              ./emu -o out -t           ... dump of SPI trace too, <out>/<name>.trace
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include <stdio.h>
+#include <unistd.h>
+#include "emu.h"
+#include "dlist.h"
+#include "glyph.h"
+#include "text.h"
+#include "pattern.h"
+#include "canvas.h"
+#include "spiq.h"
+#include "tile.h"
+#include "bar.h"
+#include "console.h"
+#include "chart.h"
+#include "arc.h"
+#include "needle.h"
+#include "gram.h"
+#include "sprite.h"
+#include "map.h"
+#include "trace.h"
+
+/** @struct Scene */
+typedef struct {
+  // file name
+  const char *name;
+  // drawing
+  void (*draw) (void);
+  // max bytes on bus
+  uint32_t budget;
+} EMU_Scene;
+
+/** @var Display on SPI1 */
+static ST7735_Display lcd = ST7735_DISPLAY_SPI1;
+
+/** @var Model of panel */
+static EMU_Panel panel;
+
+/** @var Buffer of display list */
+static uint8_t listBuffer[4096];
+
+/** @var Screen drawn live, reference of replay */
+static uint16_t liveBuffer[EMU_HEIGHT][EMU_WIDTH];
+
+/** @var Pixels of scene different from its own reference */
+static uint32_t sceneMismatch;
+
+/** @var Byte counter of driver when traffic of panel was reset */
+static uint32_t sceneBytes;
+
+/** @var Strip of canvas, 16 rows */
+static uint8_t stripBuffer[MAX_X * 16 * 2];
+
+/** @var Queue of interrupt driven transfers */
+static SPIQ_Queue queue;
+
+/** @var Tiles of screen */
+static TILE_Screen screen;
+
+/** @struct Dial face of needle scene */
+typedef struct {
+  // center
+  int16_t x;
+  int16_t y;
+  // radius
+  int16_t radius;
+} Scene_Face;
+
+/** @var Text console */
+static CONSOLE_Console console;
+
+/**
+ * @desc    Background and header
+ *
+ * @param   const char * title
+ *
+ * @return  void
+ */
+static void Scene_Header (const char *title)
+{
+  // background
+  ST7735_ClearScreen (&lcd, WHITE);
+  // header
+  ST7735_DrawRectangle (&lcd, 0, lcd.width - 1, 0, 11, BLUE);
+  ST7735_SetPosition (&lcd, 4, 2);
+  ST7735_DrawStringRun (&lcd, (char *) title, WHITE, BLUE, X1);
+}
+
+/**
+ * @desc    Solid fill of whole screen
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Clear (void)
+{
+  // one window, one fill
+  ST7735_ClearScreen (&lcd, GREEN);
+}
+
+/**
+ * @desc    Rectangles - fills, frames, edges of screen
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Rects (void)
+{
+  // header
+  Scene_Header ("RECTANGLES");
+  // filled
+  ST7735_DrawRectangle (&lcd, 10, 50, 20, 60, RED);
+  ST7735_FillRect (&lcd, 60, 100, 20, 60, GREEN);
+  ST7735_DrawRectangle (&lcd, 110, 150, 20, 60, YELLOW);
+  // one pixel wide / high
+  ST7735_DrawRectangle (&lcd, 10, 10, 70, 120, BLACK);
+  ST7735_DrawRectangle (&lcd, 20, 150, 70, 70, BLACK);
+  // corners of screen
+  ST7735_DrawPixel (&lcd, 0, lcd.height - 1, RED);
+  ST7735_DrawPixel (&lcd, lcd.width - 1, lcd.height - 1, RED);
+  ST7735_FillRect (&lcd, lcd.width - 5, lcd.width - 1, 80, 90, BLUE);
+}
+
+/**
+ * @desc    Lines - all octants, reversed horizontal / vertical lines
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Lines (void)
+{
+  // variables
+  uint8_t i;
+
+  // header
+  Scene_Header ("LINES");
+  // fan around center, all octants
+  for (i = 0; i <= 100; i += 20) {
+    ST7735_DrawLine (&lcd, 80, 30 + i, 70, 20, RED);
+    ST7735_DrawLine (&lcd, 80, 30 + i, 70, 120, BLUE);
+  }
+  for (i = 0; i <= 100; i += 25) {
+    ST7735_DrawLine (&lcd, 80, 30, 70, 20 + i, BLACK);
+    ST7735_DrawLine (&lcd, 80, 130, 70, 20 + i, GREEN);
+  }
+  // reversed end points
+  ST7735_DrawLineHorizontal (&lcd, 150, 135, 20, BLACK);
+  ST7735_DrawLineVertical (&lcd, 155, 60, 20, BLACK);
+  ST7735_DrawLine (&lcd, 150, 135, 120, 120, RED);
+}
+
+/**
+ * @desc    Text - sizes, pixel and run drawing
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Text (void)
+{
+  // header
+  Scene_Header ("TEXT");
+  // pixel by pixel
+  ST7735_SetPosition (&lcd, 4, 20);
+  ST7735_DrawString (&lcd, "SIZE X1 0123456789", BLACK, X1);
+  ST7735_SetPosition (&lcd, 4, 32);
+  ST7735_DrawString (&lcd, "SIZE X2", RED, X2);
+  ST7735_SetPosition (&lcd, 4, 52);
+  ST7735_DrawString (&lcd, "SIZE X3", BLUE, X3);
+  // one window per string
+  ST7735_SetPosition (&lcd, 4, 76);
+  ST7735_DrawStringRun (&lcd, "RUN X1 ABCDEFGHIJ", WHITE, BLACK, X1);
+  ST7735_SetPosition (&lcd, 4, 88);
+  ST7735_DrawStringRun (&lcd, "RUN X2", BLACK, YELLOW, X2);
+  ST7735_SetPosition (&lcd, 4, 106);
+  ST7735_DrawStringRun (&lcd, "RUN X3", WHITE, RED, X3);
+}
+
+/**
+ * @desc    Glyphs - cache hits, glyph run, layout
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Glyphs (void)
+{
+  // variables
+  ST7735_Rect box = { 80, 156, 20, 110 };
+  ST7735_Rect tail = { 4, 75, 76, 83 };
+  char line[301];
+  uint16_t i;
+
+  // header
+  Scene_Header ("GLYPHS");
+  // same cells twice, second from cache
+  GLYPH_DrawString (&lcd, 4, 20, "CACHE", BLACK, WHITE, X2);
+  GLYPH_DrawString (&lcd, 4, 40, "CACHE", BLACK, WHITE, X2);
+  // run of glyphs in one window
+  ST7735_DrawGlyphRun (&lcd, 4, 60, "GLYPH RUN", 9, WHITE, BLUE, X1, NULL);
+  // wrapped and centered layout
+  ST7735_DrawRectangle (&lcd, box.xs, box.xe, box.ys, box.ye, YELLOW);
+  TEXT_Draw (&lcd, "WRAPPED TEXT IN CENTERED BOX", &box, BLACK, YELLOW, X1, TEXT_ALIGN_CENTER | TEXT_WRAP);
+  // line of 300 characters aligned right - only its end is seen
+  for (i = 0; i < 300; i++) {
+    line[i] = '0' + (i % 10);
+  }
+  line[300] = '\0';
+  line[296] = 'E';
+  line[297] = 'N';
+  line[298] = 'D';
+  line[299] = '.';
+  TEXT_Draw (&lcd, line, &tail, WHITE, BLACK, X1, TEXT_ALIGN_RIGHT);
+}
+
+/**
+ * @desc    Rotation - portrait drawing seen in landscape view
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Rotate (void)
+{
+  // portrait
+  ST7735_SetRotation (&lcd, ROTATE_90, 0);
+  Scene_Header ("ROTATE 90");
+  ST7735_DrawRectangle (&lcd, 10, 40, 20, 50, RED);
+  ST7735_DrawLine (&lcd, 0, lcd.width - 1, 12, lcd.height - 1, BLACK);
+  // landscape upside down
+  ST7735_SetRotation (&lcd, ROTATE_180, 0);
+  ST7735_DrawRectangle (&lcd, 0, 30, 0, 10, GREEN);
+  ST7735_SetPosition (&lcd, 2, 2);
+  ST7735_DrawStringRun (&lcd, "180", BLACK, GREEN, X1);
+  // back to default
+  ST7735_SetRotation (&lcd, ROTATE_0, 0);
+}
+
+/**
+ * @desc    Clip stack - primitives crossing nested clip rectangles
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Clip (void)
+{
+  // variables
+  ST7735_Rect outer = { 20, 140, 20, 110 };
+  ST7735_Rect inner = { 60, 180, 50, 140 };
+  uint8_t i;
+
+  // header
+  Scene_Header ("CLIP");
+  // outer window
+  ST7735_DrawRectangle (&lcd, outer.xs, outer.xe, outer.ys, outer.ye, YELLOW);
+  ST7735_Clip_Push (&lcd, &outer);
+  for (i = 0; i < 160; i += 16) {
+    ST7735_DrawLine (&lcd, i, 160 - i, 0, 129, BLACK);
+  }
+  ST7735_FillRect (&lcd, 0, 40, 0, 40, RED);
+  ST7735_SetPosition (&lcd, 4, 100);
+  ST7735_DrawStringRun (&lcd, "CLIPPED STRING RUN", WHITE, BLUE, X2);
+  // cursor past right edge - following text stays clipped, no wrap to left
+  ST7735_DrawStringRun (&lcd, "MORE TEXT PAST END", WHITE, BLUE, X3);
+  ST7735_DrawChar (&lcd, 'X', WHITE, X2);
+  // inner window - intersection
+  ST7735_Clip_Push (&lcd, &inner);
+  ST7735_ClearScreen (&lcd, GREEN);
+  GLYPH_DrawString (&lcd, 50, 60, "GLYPHS", BLACK, GREEN, X3);
+  ST7735_Clip_Pop (&lcd);
+  ST7735_Clip_Pop (&lcd);
+}
+
+/**
+ * @desc    Pattern fills in quadrants
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Pattern (void)
+{
+  // variables
+  static const uint8_t tile[8] = { 0x18, 0x3C, 0x7E, 0xFF, 0xFF, 0x7E, 0x3C, 0x18 };
+  ST7735_Rect gradient = { 0, 79, 0, 64 };
+  ST7735_Rect checker = { 80, 160, 0, 64 };
+  ST7735_Rect stripes = { 0, 79, 65, 129 };
+  ST7735_Rect pattern = { 80, 160, 65, 129 };
+
+  // quadrants
+  PATTERN_Gradient (&lcd, &gradient, BLUE, WHITE, PATTERN_VERTICAL);
+  PATTERN_Checker (&lcd, &checker, BLACK, WHITE, 8);
+  PATTERN_Stripes (&lcd, &stripes, RED, YELLOW, 4, PATTERN_DIAGONAL);
+  PATTERN_Tile (&lcd, &pattern, tile, GREEN, BLACK);
+}
+
+/**
+ * @desc    Scene drawn through canvas
+ *
+ * @param   CANVAS_Canvas * canvas
+ *
+ * @return  void
+ */
+static void Scene_Canvas_Draw (CANVAS_Canvas *canvas)
+{
+  // variables
+  int16_t i;
+
+  // background and header
+  CANVAS_FillRect (canvas, 0, MAX_X - 1, 0, MAX_Y - 1, WHITE);
+  CANVAS_FillRect (canvas, 0, MAX_X - 1, 0, 11, BLUE);
+  CANVAS_DrawText (canvas, 4, 2, "CANVAS", WHITE, BLUE, CANVAS_X1);
+  // fan of lines
+  for (i = 0; i <= 60; i += 10) {
+    CANVAS_DrawLine (canvas, 10, 70, 20, 20 + i, RED);
+  }
+  // frame and text across strips
+  CANVAS_DrawFrame (canvas, 80, 140, 20, 60, BLACK);
+  CANVAS_DrawText (canvas, 80, 90, "STRIP", BLACK, YELLOW, CANVAS_X3);
+}
+
+/** @array End points of lines crossing clip rectangle - xs, xe, ys, ye (uint8_t of ST7735_DrawLine) */
+static const int16_t lineClip[][4] = {
+  { 0, 200, 10, 120 }, { 0, 200, 120, 10 }, { 0, 160, 0, 150 },
+  { 160, 0, 0, 150 }, { 30, 130, 0, 190 }, { 130, 30, 0, 190 },
+  { 0, 255, 60, 70 }, { 70, 90, 0, 230 }, { 10, 150, 30, 31 },
+  { 5, 15, 0, 129 }, { 50, 110, 100, 140 }, { 145, 155, 20, 110 },
+  { 250, 10, 5, 255 }, { 80, 81, 255, 0 }
+};
+
+/**
+ * @desc    Header and frame around clip rectangle
+ *
+ * @param   const ST7735_Rect * clip rectangle
+ *
+ * @return  void
+ */
+static void Scene_LineClip_Header (const ST7735_Rect *area)
+{
+  // header
+  Scene_Header ("LINE CLIP");
+  // frame one pixel outside
+  ST7735_DrawLine (&lcd, area->xs - 1, area->xe + 1, area->ys - 1, area->ys - 1, BLUE);
+  ST7735_DrawLine (&lcd, area->xs - 1, area->xe + 1, area->ye + 1, area->ye + 1, BLUE);
+  ST7735_DrawLine (&lcd, area->xs - 1, area->xs - 1, area->ys - 1, area->ye + 1, BLUE);
+  ST7735_DrawLine (&lcd, area->xe + 1, area->xe + 1, area->ys - 1, area->ye + 1, BLUE);
+}
+
+/**
+ * @desc    Clipped lines - ST7735_DrawLine, RAM strips and display canvas compared pixel for pixel
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_LineClip (void)
+{
+  // variables
+  ST7735_Rect area = { 20, 140, 24, 110 };
+  CANVAS_Rect clip = { 20, 140, 24, 110 };
+  CANVAS_Canvas canvas;
+  int16_t origin;
+  uint16_t x;
+  uint16_t y;
+  uint8_t i;
+
+  // reference - lines clipped by driver
+  Scene_LineClip_Header (&area);
+  ST7735_Clip_Push (&lcd, &area);
+  for (i = 0; i < sizeof (lineClip) / sizeof (lineClip[0]); i++) {
+    ST7735_DrawLine (&lcd, lineClip[i][0], lineClip[i][1], lineClip[i][2], lineClip[i][3], BLACK);
+  }
+  ST7735_Clip_Pop (&lcd);
+  ST7735_Sync (&lcd);
+  for (y = 0; y < EMU_HEIGHT; y++) {
+    for (x = 0; x < EMU_WIDTH; x++) {
+      liveBuffer[y][x] = EMU_Pixel (&panel, x, y);
+    }
+  }
+
+  // RAM strips - line crossing strips keeps its pixels
+  CANVAS_RAM_Init (&canvas, stripBuffer, lcd.width, lcd.height, 16);
+  for (origin = 0; origin < lcd.height; origin += 16) {
+    ST7735_Sync (&lcd);
+    CANVAS_RAM_Move (&canvas, origin);
+    CANVAS_SetClip (&canvas, NULL);
+    CANVAS_FillRect (&canvas, 0, lcd.width - 1, origin, origin + 15, WHITE);
+    CANVAS_SetClip (&canvas, &clip);
+    for (i = 0; i < sizeof (lineClip) / sizeof (lineClip[0]); i++) {
+      CANVAS_DrawLine (&canvas, lineClip[i][0], lineClip[i][1], lineClip[i][2], lineClip[i][3], BLACK);
+    }
+    ST7735_Canvas_Flush (&lcd, &canvas);
+  }
+  ST7735_Sync (&lcd);
+  // inside clip rectangle only, strips cover header
+  for (y = area.ys; y <= area.ye; y++) {
+    for (x = area.xs; x <= area.xe; x++) {
+      sceneMismatch += (liveBuffer[y][x] != EMU_Pixel (&panel, x, y));
+    }
+  }
+
+  // display canvas - clip rectangle of display
+  Scene_LineClip_Header (&area);
+  ST7735_Clip_Push (&lcd, &area);
+  ST7735_Canvas_Init (&canvas, &lcd);
+  for (i = 0; i < sizeof (lineClip) / sizeof (lineClip[0]); i++) {
+    CANVAS_DrawLine (&canvas, lineClip[i][0], lineClip[i][1], lineClip[i][2], lineClip[i][3], BLACK);
+  }
+  ST7735_Clip_Pop (&lcd);
+  ST7735_Sync (&lcd);
+  // whole screen
+  for (y = 0; y < EMU_HEIGHT; y++) {
+    for (x = 0; x < EMU_WIDTH; x++) {
+      sceneMismatch += (liveBuffer[y][x] != EMU_Pixel (&panel, x, y));
+    }
+  }
+}
+
+/**
+ * @desc    Canvas - RAM strips flushed to display
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Canvas (void)
+{
+  // variables
+  CANVAS_Canvas canvas;
+  int16_t origin;
+
+  // strips of 16 rows
+  CANVAS_RAM_Init (&canvas, stripBuffer, lcd.width, lcd.height, 16);
+  for (origin = 0; origin < lcd.height; origin += 16) {
+    ST7735_Sync (&lcd);
+    CANVAS_RAM_Move (&canvas, origin);
+    Scene_Canvas_Draw (&canvas);
+    ST7735_Canvas_Flush (&lcd, &canvas);
+  }
+}
+
+/**
+ * @desc    Screen of display list scene
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_DisplayList_Draw (void)
+{
+  // header, frame of thick lines
+  Scene_Header ("DISPLAY LIST");
+  ST7735_DrawRectangle (&lcd, 30, 130, 30, 31, BLACK);
+  ST7735_DrawRectangle (&lcd, 30, 130, 60, 61, BLACK);
+  ST7735_DrawLine (&lcd, 30, 30, 30, 61, BLACK);
+  ST7735_DrawLine (&lcd, 130, 130, 30, 61, BLACK);
+}
+
+/**
+ * @desc    Screen drawn live, then recorded and replayed, compared pixel for pixel
+ *
+ * @param   void (*) (void) drawing
+ *
+ * @return  void
+ */
+static void Scene_Replay (void (*draw) (void))
+{
+  // variables
+  DLIST_List list;
+  uint16_t x;
+  uint16_t y;
+
+  // live drawing
+  draw ();
+  ST7735_Sync (&lcd);
+  for (y = 0; y < EMU_HEIGHT; y++) {
+    for (x = 0; x < EMU_WIDTH; x++) {
+      liveBuffer[y][x] = EMU_Pixel (&panel, x, y);
+    }
+  }
+  // same start for replay, traffic of replay only
+  EMU_Clear (&panel, BLACK);
+  sceneBytes = lcd.bytes;
+  // record without drawing
+  DLIST_Init (&list, listBuffer, sizeof (listBuffer));
+  DLIST_Begin (&lcd, &list);
+  draw ();
+  DLIST_End (&lcd);
+  // replay
+  DLIST_Replay (&lcd, list.data);
+  ST7735_Sync (&lcd);
+  // pixel for pixel
+  for (y = 0; y < EMU_HEIGHT; y++) {
+    for (x = 0; x < EMU_WIDTH; x++) {
+      sceneMismatch += (liveBuffer[y][x] != EMU_Pixel (&panel, x, y));
+    }
+  }
+}
+
+/**
+ * @desc    Display list - recorded screen replayed, compared with live drawing
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_DisplayList (void)
+{
+  // header and frame
+  Scene_Replay (Scene_DisplayList_Draw);
+}
+
+/**
+ * @desc    Screen of partial writes - RAM writes into cached window start at its origin
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Rewrite_Draw (void)
+{
+  // variables
+  static uint8_t pixels[40 * 2];
+  uint8_t i;
+
+  // gradient of pixels
+  for (i = 0; i < 40; i++) {
+    pixels[2 * i] = (uint8_t) ((i * 6) << 3);
+    pixels[2 * i + 1] = (uint8_t) (i << 1);
+  }
+  Scene_Header ("REWRITE");
+  // part of window, then same window again - no CASET / RASET
+  ST7735_SetWindow (&lcd, 20, 59, 30, 49);
+  ST7735_Fill (&lcd, RED, 500);
+  ST7735_SetWindow (&lcd, 20, 59, 30, 49);
+  ST7735_Fill (&lcd, BLUE, 130);
+  // pixels written twice from origin
+  ST7735_SetWindow (&lcd, 80, 119, 30, 39);
+  ST7735_Burst_Begin (&lcd);
+  ST7735_Burst_Write (&lcd, pixels, sizeof (pixels));
+  ST7735_Burst_Fill (&lcd, GREEN, 70);
+  ST7735_Burst_End (&lcd);
+  ST7735_SetWindow (&lcd, 80, 119, 30, 39);
+  ST7735_Burst_Begin (&lcd);
+  ST7735_Burst_Fill (&lcd, BLACK, 25);
+  ST7735_Burst_Write (&lcd, pixels, 20);
+  ST7735_Burst_End (&lcd);
+}
+
+/**
+ * @desc    Display list of partial writes into same window, compared with live drawing
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Rewrite (void)
+{
+  // two RAM writes per window
+  Scene_Replay (Scene_Rewrite_Draw);
+}
+
+/**
+ * @desc    Interrupt driven queue
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Queue (void)
+{
+  // variables
+  static uint8_t image[12 * 12 * 2];
+  uint8_t i;
+
+  // checkerboard of 3 x 3 squares
+  for (i = 0; i < 144; i++) {
+    image[i << 1] = ((i / 3 + i / 36) & 1) ? 0x07 : 0xFF;
+    image[(i << 1) + 1] = ((i / 3 + i / 36) & 1) ? 0xE0 : 0xFF;
+  }
+  // queue of display
+  SPIQ_Init (&queue, &lcd);
+  // rectangles and pixels
+  SPIQ_FillRect (&queue, 0, lcd.width - 1, 0, lcd.height - 1, BLACK);
+  for (i = 0; i < 8; i++) {
+    SPIQ_FillRect (&queue, 10 + i * 18, 24 + i * 18, 20 + i * 10, 40 + i * 10, i & 1 ? RED : YELLOW);
+  }
+  for (i = 0; i < 150; i += 3) {
+    SPIQ_DrawPixel (&queue, 5 + i, 125, WHITE);
+  }
+  // lines, text and image
+  SPIQ_DrawLine (&queue, 0, 160, 0, 129, WHITE);
+  SPIQ_DrawLine (&queue, 150, 140, 5, 110, GREEN);
+  SPIQ_DrawString (&queue, 4, 2, "QUEUE", BLACK, WHITE, X1);
+  SPIQ_DrawImage (&queue, 140, 100, 12, 12, image);
+  SPIQ_Flush (&queue);
+  // window of display unknown after queue
+  ST7735_InvalidateWindow (&lcd);
+}
+
+/**
+ * @desc    12 bit pixel format - odd spans of all pixel paths
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Color444 (void)
+{
+  // variables
+  ST7735_Rect gradient = { 101, 155, 75, 115 };
+  CANVAS_Canvas canvas;
+
+  // 2 pixels in 3 bytes
+  ST7735_SetColorMode (&lcd, ST7735_COLMOD_12);
+  Scene_Header ("COLOR 444");
+  // fills of odd pixel count, gray and colored
+  ST7735_FillRect (&lcd, 4, 44, 16, 56, RED);
+  ST7735_FillRect (&lcd, 48, 88, 16, 56, 0x8410);
+  ST7735_DrawPixel (&lcd, 92, 16, BLACK);
+  // glyphs - pixel by pixel, clipped cell, cache, run of odd width
+  ST7735_SetPosition (&lcd, 96, 16);
+  ST7735_DrawString (&lcd, "X1", BLUE, X1);
+  ST7735_DrawGlyph (&lcd, 150, 16, 'C', WHITE, BLUE, X2, NULL);
+  GLYPH_DrawString (&lcd, 96, 28, "444", BLACK, YELLOW, X1);
+  ST7735_DrawGlyphRun (&lcd, 96, 40, "ODD", 3, WHITE, RED, X1, NULL);
+  // canvas spans of odd width in one window
+  ST7735_Canvas_Init (&canvas, &lcd);
+  CANVAS_DrawText (&canvas, 4, 62, "CANVAS", BLACK, GREEN, CANVAS_X1);
+  CANVAS_DrawLine (&canvas, 4, 96, 72, 120, BLUE);
+  // rasterized lines
+  PATTERN_Gradient (&lcd, &gradient, BLUE, WHITE, PATTERN_HORIZONTAL);
+  // interrupt driven fill
+  SPIQ_Init (&queue, &lcd);
+  SPIQ_FillRect (&queue, 60, 94, 62, 70, GREEN);
+  SPIQ_Flush (&queue);
+  ST7735_InvalidateWindow (&lcd);
+  // back to RGB565
+  ST7735_SetColorMode (&lcd, ST7735_COLMOD_16);
+}
+
+/**
+ * @desc    Dashboard drawn into tile - value as bar and number
+ *
+ * @param   CANVAS_Canvas * canvas
+ * @param   void * context - value 0 - 100
+ *
+ * @return  void
+ */
+static void Scene_Tiles_Draw (CANVAS_Canvas *canvas, void *context)
+{
+  // variables
+  uint8_t value = *(uint8_t *) context;
+  char number[4] = { '0' + value / 100, '0' + (value / 10) % 10, '0' + value % 10, '\0' };
+
+  // background and header
+  CANVAS_FillRect (canvas, 0, MAX_X - 1, 0, MAX_Y - 1, WHITE);
+  CANVAS_FillRect (canvas, 0, MAX_X - 1, 0, 11, BLUE);
+  CANVAS_DrawText (canvas, 4, 2, "TILES", WHITE, BLUE, CANVAS_X1);
+  // static frame and label
+  CANVAS_DrawFrame (canvas, 10, 150, 30, 50, BLACK);
+  CANVAS_DrawText (canvas, 10, 60, "LEVEL", BLACK, WHITE, CANVAS_X2);
+  // value
+  CANVAS_FillRect (canvas, 12, 12 + value * 136 / 100, 32, 48, GREEN);
+  CANVAS_DrawText (canvas, 10, 90, number, RED, WHITE, CANVAS_X3);
+}
+
+/**
+ * @desc    Tiles - whole frame, then only tiles of changed value
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Tiles (void)
+{
+  // variables
+  uint8_t value = 40;
+
+  // first frame sends every tile
+  TILE_Init (&screen, &lcd);
+  TILE_Render (&screen, Scene_Tiles_Draw, &value);
+  // number and end of bar changed
+  value = 47;
+  TILE_Render (&screen, Scene_Tiles_Draw, &value);
+}
+
+/**
+ * @desc    Bar widgets - animations drawn as deltas, all kinds and directions
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Bars (void)
+{
+  // variables
+  ST7735_Rect areas[5] = {
+    { 10, 150, 18, 26 }, { 10, 150, 32, 40 }, { 10, 80, 46, 54 }, { 10, 20, 60, 120 }, { 30, 40, 60, 120 }
+  };
+  BAR_Bar bars[5];
+  uint16_t i;
+
+  Scene_Header ("BARS");
+  // loading bar, gauge with alarm, bar from right edge, meters up and down
+  BAR_Init (&bars[0], &lcd, &areas[0], BAR_PROGRESS, BAR_RIGHT, 100, RED, WHITE);
+  BAR_Init (&bars[1], &lcd, &areas[1], BAR_GAUGE, BAR_RIGHT, 100, GREEN, BLACK);
+  BAR_SetAlarm (&bars[1], 80, RED);
+  BAR_Init (&bars[2], &lcd, &areas[2], BAR_PROGRESS, BAR_LEFT, 10, BLUE, YELLOW);
+  BAR_Init (&bars[3], &lcd, &areas[3], BAR_METER, BAR_UP, 100, GREEN, BLACK);
+  BAR_SetAlarm (&bars[3], 75, RED);
+  BAR_SetSegments (&bars[3], 3, 1);
+  BAR_Init (&bars[4], &lcd, &areas[4], BAR_METER, BAR_DOWN, 100, BLUE, BLACK);
+  // animation up
+  for (i = 0; i <= 100; i++) {
+    BAR_Set (&bars[0], i);
+    BAR_Set (&bars[1], i);
+    BAR_Set (&bars[2], i / 10);
+    BAR_Set (&bars[3], i);
+    BAR_Set (&bars[4], i);
+  }
+  // decrease erased by background, gauge back under alarm
+  for (i = 100; i >= 60; i--) {
+    BAR_Set (&bars[1], i);
+    BAR_Set (&bars[2], i / 20);
+    BAR_Set (&bars[3], i - 20);
+    BAR_Set (&bars[4], i - 30);
+  }
+}
+
+/**
+ * @desc    Diagnostics page written wholesale into console
+ *
+ * @param   unsigned int seconds of uptime
+ * @param   int temperature
+ *
+ * @return  void
+ */
+static void Scene_Console_Page (unsigned int uptime, int temperature)
+{
+  // header
+  CONSOLE_SetCursor (&console, 0, 0);
+  CONSOLE_SetColor (&console, CONSOLE_WHITE, CONSOLE_BLUE);
+  CONSOLE_Puts (&console, " DIAGNOSTICS");
+  CONSOLE_ClearEol (&console);
+  // empty row, values
+  CONSOLE_SetColor (&console, CONSOLE_WHITE, CONSOLE_BLACK);
+  CONSOLE_SetCursor (&console, 0, 1);
+  CONSOLE_ClearEol (&console);
+  CONSOLE_SetCursor (&console, 0, 2);
+  CONSOLE_Printf (&console, "UPTIME  %6u s\n", uptime);
+  CONSOLE_Printf (&console, "TEMP    %6d C\n", temperature);
+  CONSOLE_Printf (&console, "SPI     %6u kHz\n", 18000u);
+  // state
+  CONSOLE_SetColor (&console, temperature > 40 ? CONSOLE_RED : CONSOLE_GREEN, CONSOLE_BLACK);
+  CONSOLE_Puts (&console, temperature > 40 ? "STATE   HOT" : "STATE   OK");
+  CONSOLE_ClearEol (&console);
+}
+
+/**
+ * @desc    Console - whole page, then page rewritten with few changed values
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Console (void)
+{
+  // variables
+  uint8_t i;
+
+  // grid 156 x 128 in middle of screen
+  CONSOLE_Init (&console, &lcd, 2, 1);
+  Scene_Console_Page (1234, 38);
+  // log scrolls page 2 rows up
+  CONSOLE_SetColor (&console, CONSOLE_YELLOW, CONSOLE_BLACK);
+  CONSOLE_SetCursor (&console, 0, 8);
+  for (i = 0; i < 10; i++) {
+    CONSOLE_Printf (&console, "\nLOG %u", i);
+  }
+  CONSOLE_Flush (&console);
+  // page rewritten at its place, only changed cells sent
+  Scene_Console_Page (1235, 41);
+  CONSOLE_Flush (&console);
+}
+
+/**
+ * @desc    Test signal - triangle with pseudo random noise
+ *
+ * @param   uint16_t index of sample
+ *
+ * @return  int16_t -100 .. 100
+ */
+static int16_t Scene_Signal (uint16_t index)
+{
+  // variables
+  static uint32_t seed = 12345;
+  int16_t phase = index % 80;
+
+  // linear congruential noise -8 .. 7
+  seed = seed * 1103515245 + 12345;
+  // triangle -80 .. 80
+  return ((phase < 40) ? (phase * 4 - 80) : (240 - phase * 4)) + (int16_t) ((seed >> 16) & 0x0F) - 8;
+}
+
+/**
+ * @desc    Strip charts - hardware scroll left, sweep right, one column per sample
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Chart (void)
+{
+  // variables
+  ST7735_Rect left = { 0, 79, 0, lcd.height - 1 };
+  ST7735_Rect right = { 82, lcd.width - 1, 14, lcd.height - 1 };
+  CHART_Chart scroll;
+  CHART_Chart sweep;
+  uint16_t i;
+
+  // header of sweep chart, gap between charts
+  ST7735_FillRect (&lcd, 80, lcd.width - 1, 0, 13, BLUE);
+  ST7735_FillRect (&lcd, 80, 81, 14, lcd.height - 1, WHITE);
+  GLYPH_DrawString (&lcd, 84, 3, "CHART", WHITE, BLUE, X1);
+  // scroll chart over whole height of its columns
+  CHART_Init (&scroll, &lcd, &left, -100, 100, YELLOW, BLACK);
+  CHART_SetGrid (&scroll, 20, 16, 0x4208);
+  CHART_SetMode (&scroll, CHART_SCROLL);
+  CHART_Init (&sweep, &lcd, &right, -100, 100, GREEN, BLACK);
+  CHART_SetGrid (&sweep, 16, 16, 0x4208);
+  CHART_Draw (&sweep);
+  // more samples than columns - wrapped sweep, scrolled chart
+  for (i = 0; i < 200; i++) {
+    CHART_Push (&scroll, Scene_Signal (i));
+    CHART_Push (&sweep, Scene_Signal (i) / 2);
+  }
+}
+
+/**
+ * @desc    Widget sending its own windows - tiles, console or sweep chart
+ *
+ * @param   uint8_t widget 0 - 2
+ *
+ * @return  void
+ */
+static void Scene_Widget_Draw (uint8_t widget)
+{
+  // variables
+  ST7735_Rect area = { 10, 150, 20, 120 };
+  CHART_Chart chart;
+  uint8_t value = 47;
+  uint16_t i;
+
+  // tiles of whole frame
+  if (widget == 0) {
+    TILE_Render (&screen, Scene_Tiles_Draw, &value);
+  // page of console
+  } else if (widget == 1) {
+    CONSOLE_Init (&console, &lcd, 2, 1);
+    Scene_Console_Page (1234, 38);
+    CONSOLE_Flush (&console);
+  // wrapped sweep chart, same samples every time
+  } else {
+    CHART_Init (&chart, &lcd, &area, -100, 100, GREEN, BLACK);
+    CHART_SetGrid (&chart, 16, 16, 0x4208);
+    CHART_Draw (&chart);
+    for (i = 0; i < 180; i++) {
+      CHART_Push (&chart, (int16_t) ((i * 37) % 200) - 100);
+    }
+  }
+}
+
+/**
+ * @desc    Widgets inside clip rectangle - compared with unclipped drawing pixel for pixel
+ *          Tiles clipped by previous frame sent again, both pixel formats
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Widgets (void)
+{
+  // variables
+  ST7735_Rect clip = { 23, 118, 17, 101 };
+  uint16_t color;
+  uint8_t widget;
+  uint16_t x;
+  uint16_t y;
+
+  // loop through widgets, 16 bit then 12 bit - odd parts of rows
+  for (widget = 0; widget < 6; widget++) {
+    if (widget == 3) {
+      ST7735_SetColorMode (&lcd, ST7735_COLMOD_12);
+    }
+    // unclipped, whole frame of tiles
+    EMU_Clear (&panel, BLACK);
+    TILE_Init (&screen, &lcd);
+    Scene_Widget_Draw (widget % 3);
+    ST7735_Sync (&lcd);
+    for (y = 0; y < EMU_HEIGHT; y++) {
+      for (x = 0; x < EMU_WIDTH; x++) {
+        liveBuffer[y][x] = EMU_Pixel (&panel, x, y);
+      }
+    }
+    // clipped, traffic of last drawing only
+    EMU_Clear (&panel, BLACK);
+    sceneBytes = lcd.bytes;
+    TILE_Init (&screen, &lcd);
+    ST7735_Clip_Push (&lcd, &clip);
+    Scene_Widget_Draw (widget % 3);
+    ST7735_Clip_Pop (&lcd);
+    ST7735_Sync (&lcd);
+    // same pixels inside, nothing outside
+    for (y = 0; y < EMU_HEIGHT; y++) {
+      for (x = 0; x < EMU_WIDTH; x++) {
+        color = ((x < clip.xs) || (x > clip.xe) || (y < clip.ys) || (y > clip.ye)) ? BLACK : liveBuffer[y][x];
+        sceneMismatch += (color != EMU_Pixel (&panel, x, y));
+      }
+    }
+    // next frame of same tiles completes clipped ones
+    if ((widget % 3) == 0) {
+      Scene_Widget_Draw (0);
+      ST7735_Sync (&lcd);
+      for (y = 0; y < EMU_HEIGHT; y++) {
+        for (x = 0; x < EMU_WIDTH; x++) {
+          sceneMismatch += (liveBuffer[y][x] != EMU_Pixel (&panel, x, y));
+        }
+      }
+    }
+  }
+  // default format
+  ST7735_SetColorMode (&lcd, ST7735_COLMOD_16);
+}
+
+/**
+ * @desc    Arcs - sectors, rings, ring gauges updated by slices
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Arcs (void)
+{
+  // variables
+  ARC_Ring rings[4];
+  uint16_t i;
+
+  Scene_Header ("ARCS");
+  // filled sector, whole ring with sector inside, ring cut by right edge of screen
+  ARC_Fill (&lcd, 26, 42, 20, 0, 0, ARC_DEGREE (270), RED, NULL);
+  ARC_Fill (&lcd, 72, 42, 20, 13, 0, ARC_FULL, BLUE, NULL);
+  ARC_Fill (&lcd, 72, 42, 12, 0, ARC_DEGREE (45), ARC_DEGREE (135), GREEN, NULL);
+  ARC_Fill (&lcd, 150, 42, 26, 18, ARC_DEGREE (200), ARC_DEGREE (340), BLACK, NULL);
+  // gauges of 270 degrees from 7:30, pie gauge of full turn, small ring
+  ARC_Init (&rings[0], &lcd, 26, 96, 22, 15, 100, GREEN, BLACK);
+  ARC_SetSweep (&rings[0], ARC_DEGREE (225), ARC_DEGREE (270));
+  ARC_Init (&rings[1], &lcd, 78, 96, 22, 18, 100, RED, YELLOW);
+  ARC_SetSweep (&rings[1], ARC_DEGREE (225), ARC_DEGREE (270));
+  ARC_Init (&rings[2], &lcd, 130, 96, 22, 0, 100, BLUE, BLACK);
+  ARC_Init (&rings[3], &lcd, 113, 42, 9, 5, 10, RED, BLACK);
+  // animation up
+  for (i = 0; i <= 100; i++) {
+    ARC_Set (&rings[0], i);
+    ARC_Set (&rings[1], i);
+    ARC_Set (&rings[2], i);
+    ARC_Set (&rings[3], i / 10);
+  }
+  // decrease erased by background
+  for (i = 100; i >= 40; i--) {
+    ARC_Set (&rings[0], i);
+    ARC_Set (&rings[1], i + 5);
+    ARC_Set (&rings[2], i - 10);
+    ARC_Set (&rings[3], i / 14);
+  }
+}
+
+/**
+ * @desc    Dial face - rim, ticks every 27 degrees of 270 from 7:30, last two red
+ *
+ * @param   void * context
+ * @param   uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width in pixels
+ *
+ * @return  void
+ */
+static void Scene_Dial (void *context, uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+  // variables
+  Scene_Face *face = (Scene_Face *) context;
+  int32_t r = face->radius;
+  int32_t dy = y - face->y;
+  int32_t dx, d2, s, c, cross;
+  uint16_t angle;
+  uint16_t color;
+  uint8_t k;
+
+  // loop through pixels
+  for (; width > 0; width--, x++) {
+    dx = x - face->x;
+    d2 = dx * dx + dy * dy;
+    // outside, rim, face
+    if (d2 > r * r + r) {
+      color = WHITE;
+    } else if (d2 > (r - 3) * (r - 3) + (r - 3)) {
+      color = BLACK;
+    } else {
+      color = 0xDEFB;
+      // ticks - distance from ray below 3/4 of pixel
+      if ((d2 > (r - 11) * (r - 11)) && (d2 <= (r - 5) * (r - 5))) {
+        for (k = 0; k <= 10; k++) {
+          angle = ARC_DEGREE (225) + k * ARC_DEGREE (27);
+          s = ARC_Sin (angle);
+          c = ARC_Cos (angle);
+          cross = s * dy + c * dx;
+          if ((cross > -24576) && (cross < 24576) && ((s * dx - c * dy) > 0)) {
+            color = (k < 9) ? BLACK : RED;
+          }
+        }
+      }
+    }
+    // MSB first
+    *line++ = (uint8_t) (color >> 8);
+    *line++ = (uint8_t) color;
+  }
+}
+
+/**
+ * @desc    Needles - dial face restored by rasterizer, clock hand on solid background
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Needles (void)
+{
+  // variables
+  Scene_Face face = { 50, 74, 50 };
+  ST7735_Rect dial = { 0, 100, 24, 124 };
+  NEEDLE_Needle needles[2];
+  uint16_t i;
+
+  Scene_Header ("NEEDLES");
+  // static faces drawn once
+  SCAN_Render (&lcd, &dial, Scene_Dial, &face, NULL);
+  ARC_Fill (&lcd, 132, 74, 26, 0, 0, ARC_FULL, BLACK, NULL);
+  // needle of dial, hand of seconds
+  NEEDLE_Init (&needles[0], &lcd, face.x, face.y, 42, 5, 100, RED, WHITE);
+  NEEDLE_SetSweep (&needles[0], ARC_DEGREE (225), ARC_DEGREE (270));
+  NEEDLE_SetFace (&needles[0], Scene_Dial, &face);
+  NEEDLE_Init (&needles[1], &lcd, 132, 74, 24, 3, 60, YELLOW, BLACK);
+  // sweep up, hand over full turn
+  for (i = 0; i <= 100; i++) {
+    NEEDLE_Set (&needles[0], i);
+    NEEDLE_Set (&needles[1], i % 60);
+  }
+  // sweep down
+  for (i = 100; i >= 35; i--) {
+    NEEDLE_Set (&needles[0], i);
+  }
+}
+
+/**
+ * @desc    Screenshot sink - compares row with emulated GRAM
+ *
+ * @param   void * context
+ * @param   const uint8_t * line
+ * @param   uint8_t y row
+ * @param   uint8_t x start column
+ * @param   uint8_t width in pixels
+ *
+ * @return  void
+ */
+static void Scene_Readback_Sink (void *context, const uint8_t *line, uint8_t y, uint8_t x, uint8_t width)
+{
+  // variables
+  uint16_t color;
+  uint8_t i;
+
+  // unused
+  (void) context;
+  // loop through row
+  for (i = 0; i < width; i++) {
+    // RGB565, high byte first
+    color = (line[i << 1] << 8) | line[(i << 1) + 1];
+    // pixels read back must match panel
+    sceneMismatch += (color != EMU_Pixel (&panel, x + i, y));
+  }
+}
+
+/**
+ * @desc    Readback - overlays blended over content, sprite area saved and restored, copy, screenshot
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Readback (void)
+{
+  // variables
+  ST7735_Rect shadow = { 24, 139, 44, 103 };
+  ST7735_Rect dialog = { 20, 135, 40, 99 };
+  ST7735_Rect sprite = { 60, 75, 20, 35 };
+  ST7735_Rect source = { 4, 43, 106, 125 };
+  uint8_t under[16 * 16 * 2];
+  uint8_t i;
+
+  Scene_Header ("READBACK");
+  // content - color stripes and text
+  for (i = 0; i < 8; i++) {
+    ST7735_FillRect (&lcd, i * 20, i * 20 + 19, 14, 104, (i & 1) ? RED : (i & 2) ? GREEN : BLUE);
+  }
+  ST7735_SetPosition (&lcd, 4, 108);
+  ST7735_DrawString (&lcd, (char *) "RAMRD", BLACK, X2);
+  // sprite drawn over saved area and moved away
+  GRAM_Save (&lcd, &sprite, under, NULL);
+  ST7735_FillRect (&lcd, sprite.xs, sprite.xe, sprite.ys, sprite.ye, YELLOW);
+  GRAM_Restore (&lcd, &sprite, under, NULL);
+  // shadow and translucent dialog over content
+  GRAM_Blend (&lcd, &shadow, BLACK, 96, NULL);
+  GRAM_Blend (&lcd, &dialog, WHITE, 160, NULL);
+  ST7735_SetPosition (&lcd, 28, 64);
+  ST7735_DrawString (&lcd, (char *) "ALPHA 160", BLACK, X1);
+  // label duplicated, overlapping areas moved by 8 pixels
+  GRAM_Copy (&lcd, &source, 110, 106, NULL);
+  source.xs = 110;
+  source.xe = 149;
+  GRAM_Copy (&lcd, &source, 118, 104, NULL);
+  // whole screen read back row by row
+  GRAM_Screenshot (&lcd, NULL, Scene_Readback_Sink, NULL, NULL);
+}
+
+/**
+ * @desc    Ball of sprite - disc with dark rim, transparent corners
+ *
+ * @param   uint8_t * bitmap of 16 x 16 pixels
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+static void Scene_Ball (uint8_t *bitmap, uint16_t color)
+{
+  // variables
+  int16_t d2;
+  int16_t x;
+  int16_t y;
+  uint16_t pixel;
+
+  // loop through pixels, distance from center 7.5 in half pixels
+  for (y = -15; y <= 15; y += 2) {
+    for (x = -15; x <= 15; x += 2) {
+      d2 = x * x + y * y;
+      pixel = (d2 > 256) ? SPRITE_KEY : ((d2 > 160) ? BLACK : color);
+      // MSB first
+      *bitmap++ = (uint8_t) (pixel >> 8);
+      *bitmap++ = (uint8_t) pixel;
+    }
+  }
+}
+
+/**
+ * @desc    Sprites - balls crossing each other over content by readback,
+ *          ball orbiting dial restored by rasterizer of face
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Sprites (void)
+{
+  // variables
+  static uint8_t bitmaps[4][16 * 16 * 2];
+  static SPRITE_Sprite balls[4];
+  static SPRITE_Layer layers[2];
+  Scene_Face face = { 120, 78, 38 };
+  ST7735_Rect dial = { 82, 158, 40, 116 };
+  uint8_t i;
+
+  Scene_Header ("SPRITES");
+  // content under first layer
+  for (i = 0; i < 4; i++) {
+    ST7735_FillRect (&lcd, 0, 79, 14 + i * 29, 42 + i * 29, (i & 1) ? GREEN : BLUE);
+  }
+  ST7735_SetPosition (&lcd, 8, 60);
+  ST7735_DrawString (&lcd, (char *) "SAVE", WHITE, X2);
+  SCAN_Render (&lcd, &dial, Scene_Dial, &face, NULL);
+  // bitmaps
+  Scene_Ball (bitmaps[0], RED);
+  Scene_Ball (bitmaps[1], YELLOW);
+  Scene_Ball (bitmaps[2], WHITE);
+  Scene_Ball (bitmaps[3], RED);
+  // three balls by readback, one by rasterizer of dial
+  SPRITE_Init (&layers[0], &lcd);
+  SPRITE_Init (&layers[1], &lcd);
+  SPRITE_SetBackground (&layers[1], Scene_Dial, &face);
+  for (i = 0; i < 3; i++) {
+    SPRITE_Add (&layers[0], &balls[i], bitmaps[i], 16, 16, SPRITE_KEY);
+  }
+  SPRITE_Add (&layers[1], &balls[3], bitmaps[3], 16, 16, SPRITE_KEY);
+  SPRITE_Show (&layers[0], &balls[0], 2, 16);
+  SPRITE_Show (&layers[0], &balls[1], 60, 16);
+  SPRITE_Show (&layers[0], &balls[2], 2, 110);
+  SPRITE_Show (&layers[1], &balls[3], 112, 42);
+  // paths crossing in middle of content, ball around dial
+  for (i = 0; i < 30; i++) {
+    SPRITE_Move (&layers[0], &balls[0], 2 + i * 2, 16 + i * 3);
+    SPRITE_Move (&layers[0], &balls[1], 60 - i * 2, 16 + i * 3);
+    SPRITE_Move (&layers[0], &balls[2], 2 + i * 2, 110 - i * 2);
+    SPRITE_Move (&layers[1], &balls[3], face.x - 8 + ARC_Sin (i * 24) * 28 / 32768, face.y - 8 - ARC_Cos (i * 24) * 28 / 32768);
+  }
+  // hidden and shown at other place
+  SPRITE_Hide (&layers[0], &balls[2]);
+  SPRITE_Show (&layers[0], &balls[2], 32, 40);
+}
+
+/** @const Palette of tilemap - sky, clouds, ground, grass, bricks, ball */
+static const uint16_t mapPalette[16] = {
+  0x0000, 0x5D1F, 0xFFFF, 0xCE79, 0x8200, 0xA3A5, 0x2444, 0x07E0,
+  0xC800, 0xF9E7, 0x8410, 0xFFE0, 0xFD20, 0x001F, 0xF81F, 0x4208
+};
+
+/**
+ * @desc    Tilemap - scrolled tile layer with sprites, frame by frame
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+static void Scene_Tilemap (void)
+{
+  // variables
+  static uint8_t tiles[5 * MAP_TILE_BYTES];
+  static uint8_t ball[8 * 8 / 2];
+  static MAP_Map map;
+  MAP_Sprite balls[3];
+  int16_t dx, dy;
+  uint8_t col;
+  uint8_t row;
+  uint8_t i;
+
+  // tiles - sky, cloud, ground, grass, bricks, left pixel in upper nibble
+  for (i = 0; i < MAP_TILE_BYTES; i++) {
+    row = i / (MAP_TILE / 2);
+    col = (i % (MAP_TILE / 2)) * 2;
+    tiles[i] = 0x11;
+    tiles[MAP_TILE_BYTES + i] = ((row > 1) && (row < 6)) ? 0x22 : ((row == 6) ? 0x33 : 0x11);
+    tiles[2 * MAP_TILE_BYTES + i] = ((row + col) & 2) ? 0x45 : 0x54;
+    tiles[3 * MAP_TILE_BYTES + i] = (row < 2) ? ((col & 2) ? 0x76 : 0x67) : 0x44;
+    tiles[4 * MAP_TILE_BYTES + i] = ((row == 3) || (row == 7) || (((row < 3) ? col : (col + 4)) % 8 == 0)) ? 0xAA : 0x88;
+  }
+  // ball 8 x 8, transparent corners
+  for (i = 0; i < 8 * 8 / 2; i++) {
+    row = i / 4;
+    col = (i % 4) * 2;
+    dx = 2 * col - 7;
+    dy = 2 * row - 7;
+    ball[i] = ((dx * dx + dy * dy) < 56) ? 0xCC : (((dx + 2) * (dx + 2) + dy * dy) < 60) ? 0x0C : 0x00;
+  }
+  // sky with clouds, wall of bricks, grass over ground
+  MAP_Init (&map, &lcd, tiles, mapPalette);
+  for (row = 0; row < MAP_ROWS; row++) {
+    for (col = 0; col < MAP_COLS; col++) {
+      MAP_SetTile (&map, col, row, (row > 13) ? 2 : (row == 13) ? 3 : ((row > 9) && (col > 11) && (col < 17)) ? 4 : (((col * 5 + row * 3) % 13) == 0) ? 1 : 0);
+    }
+  }
+  for (i = 0; i < 3; i++) {
+    MAP_AddSprite (&map, &balls[i], ball, 8, 8);
+  }
+  balls[2].visible = 0;
+  // frames - map scrolled right and down with wrap, balls moving
+  for (i = 0; i < 3; i++) {
+    MAP_Scroll (&map, i * 52, -i * 3);
+    balls[0].x = 20 + i * 30;
+    balls[0].y = 90 - i * 12;
+    balls[1].x = 140 - i * 10;
+    balls[1].y = 40;
+    MAP_Render (&map, NULL);
+  }
+}
+
+/** @const Canonical scenes, budget of bytes on bus */
+static const EMU_Scene scenes[] = {
+  { "clear",    Scene_Clear,        44000 },
+  { "rects",    Scene_Rects,        60000 },
+  { "lines",    Scene_Lines,        64000 },
+  { "text",     Scene_Text,         64000 },
+  { "glyphs",   Scene_Glyphs,       69000 },
+  { "rotate",   Scene_Rotate,       53000 },
+  { "clip",     Scene_Clip,        100000 },
+  { "pattern",  Scene_Pattern,      44000 },
+  { "canvas",   Scene_Canvas,       44000 },
+  { "lineclip", Scene_LineClip,    175000 },
+  { "dlist",    Scene_DisplayList,  51000 },
+  { "rewrite",  Scene_Rewrite,      51000 },
+  { "queue",    Scene_Queue,        53000 },
+  { "color444", Scene_Color444,     48000 },
+  { "tiles",    Scene_Tiles,        47000 },
+  { "bars",     Scene_Bars,         78000 },
+  { "console",  Scene_Console,      52000 },
+  { "chart",    Scene_Chart,       156000 },
+  { "widgets",  Scene_Widgets,      31000 },
+  { "arcs",     Scene_Arcs,        107000 },
+  { "needles",  Scene_Needles,      219000 },
+  { "readback", Scene_Readback,     237000 },
+  { "sprites",  Scene_Sprites,      266000 },
+  { "tilemap",  Scene_Tilemap,      132000 }
+};
+
+/**
+ * @desc    Compare two files
+ *
+ * @param   const char * path
+ * @param   const char * reference
+ *
+ * @return  int32_t different bytes, -1 if not comparable
+ */
+static int32_t EMU_Compare (const char *path, const char *reference)
+{
+  // variables
+  FILE *a = fopen (path, "rb");
+  FILE *b = fopen (reference, "rb");
+  int32_t diff = 0;
+  int ca;
+  int cb;
+
+  // missing file
+  if ((a == NULL) || (b == NULL)) {
+    diff = -1;
+  } else {
+    // byte by byte
+    do {
+      ca = fgetc (a);
+      cb = fgetc (b);
+      if (ca != cb) {
+        // different length
+        if ((ca == EOF) || (cb == EOF)) {
+          diff = -1;
+          break;
+        }
+        diff++;
+      }
+    } while (ca != EOF);
+  }
+  // close
+  if (a != NULL) {
+    fclose (a);
+  }
+  if (b != NULL) {
+    fclose (b);
+  }
+  // result
+  return diff;
+}
+
+/**
+ * @desc    Main
+ *
+ * @param   int argc
+ * @param   char ** argv
+ *
+ * @return  int
+ */
+int main (int argc, char **argv)
+{
+  // variables
+  const char *out = ".";
+  const char *ref = NULL;
+  char path[256];
+  char reference[256];
+  const EMU_Scene *scene;
+  FILE *dump;
+  uint8_t trace = 0;
+  int32_t diff;
+  int failed = 0;
+  int opt;
+  size_t i;
+
+  // options
+  while ((opt = getopt (argc, argv, "o:r:t")) != -1) {
+    if (opt == 'o') {
+      out = optarg;
+    } else if (opt == 'r') {
+      ref = optarg;
+    } else if (opt == 't') {
+      trace = 1;
+    } else {
+      fprintf (stderr, "usage: %s [-o outdir] [-r refdir] [-t]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  // display on emulated bus
+  EMU_Attach (&panel, &lcd);
+  ST7735_Init (&lcd);
+
+  // scenes
+  printf ("%-10s %8s %8s %6s %6s %6s %8s  %s\n", "scene", "bytes", "budget", "cmds", "wins", "rams", "pixels", "image");
+  for (i = 0; i < sizeof (scenes) / sizeof (scenes[0]); i++) {
+    scene = &scenes[i];
+    // capture from default state
+    if (trace) {
+      TRACE_Start (lcd.bus->spi, lcd.device.port, lcd.device.pin, lcd.dc.port, lcd.dc.pin);
+    }
+    // same state before every scene
+    ST7735_SetRotation (&lcd, ROTATE_0, 0);
+    ST7735_Clip_Reset (&lcd);
+    ST7735_InvalidateWindow (&lcd);
+    ST7735_Scroll_Stop (&lcd);
+    EMU_Clear (&panel, BLACK);
+    sceneMismatch = 0;
+    sceneBytes = lcd.bytes;
+    // draw
+    scene->draw ();
+    ST7735_Sync (&lcd);
+    // ring as dumped by debugger
+    if (trace) {
+      TRACE_Stop ();
+      snprintf (path, sizeof (path), "%s/%s.trace", out, scene->name);
+      dump = fopen (path, "wb");
+      if ((dump == NULL) || (fwrite (&traceBuffer, sizeof (traceBuffer), 1, dump) != 1)) {
+        fprintf (stderr, "%s: cannot write\n", path);
+        return 2;
+      }
+      fclose (dump);
+    }
+    // image
+    snprintf (path, sizeof (path), "%s/%s.ppm", out, scene->name);
+    if (EMU_Save (&panel, path) != ST7735_SUCCESS) {
+      fprintf (stderr, "%s: cannot write\n", path);
+      return 2;
+    }
+    // traffic
+    printf ("%-10s %8u %8u %6u %6u %6u %8u  ", scene->name,
+            panel.stats.bytes, scene->budget, panel.stats.commands,
+            panel.stats.windows, panel.stats.writes, panel.stats.pixels);
+    if (panel.stats.bytes > scene->budget) {
+      printf ("OVER BUDGET ");
+      failed = 1;
+    }
+    if (lcd.bytes - sceneBytes != panel.stats.bytes) {
+      printf ("DRIVER COUNTED %u ", lcd.bytes - sceneBytes);
+      failed = 1;
+    }
+    if (sceneMismatch) {
+      printf ("%u PIXELS DIFFER ", sceneMismatch);
+      failed = 1;
+    }
+    if (panel.stats.dropped) {
+      printf ("%u PIXELS OUTSIDE ", panel.stats.dropped);
+      failed = 1;
+    }
+    // golden image
+    if (ref != NULL) {
+      snprintf (reference, sizeof (reference), "%s/%s.ppm", ref, scene->name);
+      diff = EMU_Compare (path, reference);
+      if (diff < 0) {
+        printf ("NO REFERENCE\n");
+        failed = 1;
+      } else if (diff > 0) {
+        printf ("DIFFERS (%d bytes)\n", diff);
+        failed = 1;
+      } else {
+        printf ("ok\n");
+      }
+    } else {
+      printf ("%s\n", path);
+    }
+  }
+
+  // result
+  return failed;
+}
@@ -0,0 +1,379 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        ST7735 emulator - host tool
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        panel.c
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      emu.h, ppm.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Model of ST7735 - decodes CASET, RASET, RAMWR, RAMRD, MADCTL and COLMOD (16, 18 and
+ *              12 bit pixels) into GRAM 132 x 162, VSCRDEF and VSCRSADD move shown rows.
+ *              Used by emulator and by trace decoder.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir      http://www.displayfuture.com/Display/datasheet/controller/ST7735.pdf
+ */
+
+/** @includes */
+#include "emu.h"
+#include "ppm.h"
+
+/**
+ * @desc    Cell of GRAM at address by memory access control
+ *
+ * @param   EMU_Panel * panel
+ * @param   uint8_t madctl
+ * @param   uint16_t column address
+ * @param   uint16_t row address
+ *
+ * @return  uint16_t * / NULL outside of memory
+ */
+static uint16_t * EMU_Cell (const EMU_Panel *panel, uint8_t madctl, uint16_t col, uint16_t row)
+{
+  // variables
+  uint16_t swap;
+
+  // row / column exchange
+  if (madctl & MADCTL_MV) {
+    swap = col;
+    col = row;
+    row = swap;
+  }
+  // outside of memory
+  if ((col >= EMU_COLS) || (row >= EMU_ROWS)) {
+    return NULL;
+  }
+  // mirrors
+  if (madctl & MADCTL_MX) {
+    col = EMU_COLS - 1 - col;
+  }
+  if (madctl & MADCTL_MY) {
+    row = EMU_ROWS - 1 - row;
+  }
+  // cell
+  return (uint16_t *) &panel->gram[row][col];
+}
+
+/**
+ * @desc    Write pixel at address counters, advance counters inside window
+ *
+ * @param   EMU_Panel * panel
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+static void EMU_Put (EMU_Panel *panel, uint16_t color)
+{
+  // variables
+  uint16_t *cell = EMU_Cell (panel, panel->madctl, panel->x, panel->y);
+
+  // inside of memory
+  if (cell != NULL) {
+    *cell = color;
+    panel->stats.pixels++;
+  } else {
+    panel->stats.dropped++;
+  }
+  // next column, wrap to next row, wrap to window start
+  if (++panel->x > panel->xe) {
+    panel->x = panel->xs;
+    if (++panel->y > panel->ye) {
+      panel->y = panel->ys;
+    }
+  }
+}
+
+/**
+ * @desc    Read pixel at address counters into parameters as RGB666, advance counters
+ *
+ * @param   EMU_Panel * panel
+ *
+ * @return  void
+ */
+static void EMU_Get (EMU_Panel *panel)
+{
+  // variables
+  uint16_t *cell = EMU_Cell (panel, panel->madctl, panel->x, panel->y);
+  uint16_t color = (cell != NULL) ? *cell : 0;
+  uint8_t r = (color >> 11) & 0x1F;
+  uint8_t b = color & 0x1F;
+
+  // channels left aligned, 5 bit red and blue widened by upper bit
+  panel->param[0] = ((r << 1) | (r >> 4)) << 2;
+  panel->param[1] = ((color >> 5) & 0x3F) << 2;
+  panel->param[2] = ((b << 1) | (b >> 4)) << 2;
+  panel->stats.read++;
+  // next column, wrap to next row, wrap to window start
+  if (++panel->x > panel->xe) {
+    panel->x = panel->xs;
+    if (++panel->y > panel->ye) {
+      panel->y = panel->ys;
+    }
+  }
+}
+
+/**
+ * @desc    RGB444 expanded to RGB565
+ *
+ * @param   uint16_t color
+ *
+ * @return  uint16_t
+ */
+static uint16_t EMU_444 (uint16_t color)
+{
+  // variables
+  uint16_t r = (color >> 8) & 0x0F;
+  uint16_t g = (color >> 4) & 0x0F;
+  uint16_t b = color & 0x0F;
+
+  // upper bits repeated into lower ones
+  return (((r << 1) | (r >> 3)) << 11) | (((g << 2) | (g >> 2)) << 5) | ((b << 1) | (b >> 3));
+}
+
+/**
+ * @desc    Byte received by panel
+ *
+ * @param   EMU_Panel * panel
+ * @param   uint8_t byte
+ * @param   uint8_t data (DC high) / command (DC low)
+ *
+ * @return  uint8_t byte driven on MISO at same time
+ */
+uint8_t EMU_Receive (EMU_Panel *panel, uint8_t byte, uint8_t data)
+{
+  // variables
+  uint8_t *param = panel->param;
+
+  // traffic
+  panel->stats.bytes++;
+
+  // command
+  if (!data) {
+    panel->stats.commands++;
+    panel->command = byte;
+    panel->count = 0;
+    // window
+    if ((byte == CASET) || (byte == RASET)) {
+      panel->stats.windows++;
+    // memory write from window start
+    } else if (byte == RAMWR) {
+      panel->stats.writes++;
+      panel->x = panel->xs;
+      panel->y = panel->ys;
+    // memory read from window start
+    } else if (byte == RAMRD) {
+      panel->x = panel->xs;
+      panel->y = panel->ys;
+    // defaults
+    } else if (byte == SWRESET) {
+      panel->madctl = 0x00;
+      panel->colmod = 0x06;
+      panel->scroll = 0;
+    // end of scroll
+    } else if (byte == NORON) {
+      panel->scroll = 0;
+    }
+    return 0;
+  }
+
+  // parameters of last command
+  switch (panel->command) {
+    // column / row address, 2 x 16 bit
+    case CASET:
+    case RASET:
+      if (panel->count < 4) {
+        param[panel->count++] = byte;
+      }
+      if (panel->count == 4) {
+        if (panel->command == CASET) {
+          panel->xs = (param[0] << 8) | param[1];
+          panel->xe = (param[2] << 8) | param[3];
+        } else {
+          panel->ys = (param[0] << 8) | param[1];
+          panel->ye = (param[2] << 8) | param[3];
+        }
+        panel->count = 5;
+      }
+      break;
+    // scroll area - top fixed, scrolled, bottom fixed rows, 3 x 16 bit
+    case VSCRDEF:
+      if (panel->count < 6) {
+        param[panel->count++] = byte;
+      }
+      if (panel->count == 6) {
+        panel->tfa = (param[0] << 8) | param[1];
+        panel->vsa = (param[2] << 8) | param[3];
+        panel->count = 7;
+      }
+      break;
+    // first shown row of scroll area, 16 bit
+    case VSCRSADD:
+      if (panel->count < 2) {
+        param[panel->count++] = byte;
+      }
+      if (panel->count == 2) {
+        panel->ssa = (param[0] << 8) | param[1];
+        panel->scroll = (panel->vsa > 0);
+        panel->count = 3;
+      }
+      break;
+    // memory access control
+    case MADCTL:
+      panel->madctl = byte;
+      break;
+    // pixel format
+    case COLMOD:
+      panel->colmod = byte & 0x07;
+      break;
+    // pixels
+    case RAMWR:
+      param[panel->count++] = byte;
+      // 16 bit - RGB565 MSB first
+      if (panel->colmod == 0x05) {
+        if (panel->count == 2) {
+          EMU_Put (panel, (param[0] << 8) | param[1]);
+          panel->count = 0;
+        }
+      // 12 bit - 2 pixels RGB444 in 3 bytes, each written after its 12 bits
+      } else if (panel->colmod == 0x03) {
+        if (panel->count == 2) {
+          EMU_Put (panel, EMU_444 ((param[0] << 4) | (param[1] >> 4)));
+        } else if (panel->count == 3) {
+          EMU_Put (panel, EMU_444 (((param[1] & 0x0F) << 8) | param[2]));
+          panel->count = 0;
+        }
+      // 18 bit - 3 bytes, 6 upper bits of channel
+      } else if (panel->count == 3) {
+        EMU_Put (panel, ((param[0] >> 3) << 11) | ((param[1] >> 2) << 5) | (param[2] >> 3));
+        panel->count = 0;
+      }
+      break;
+    // pixels read - dummy byte, then 3 bytes R, G, B of 6 upper bits whatever is colmod
+    case RAMRD:
+      if (panel->count == 0) {
+        panel->count = 1;
+        return 0;
+      }
+      // next pixel
+      if (panel->count == 1) {
+        EMU_Get (panel);
+      }
+      byte = param[panel->count - 1];
+      panel->count = (panel->count == 3) ? 1 : panel->count + 1;
+      return byte;
+    // other command
+    default:
+      break;
+  }
+  // nothing driven
+  return 0;
+}
+
+/**
+ * @desc    State after hardware reset, black GRAM
+ *
+ * @param   EMU_Panel * panel
+ *
+ * @return  void
+ */
+void EMU_Reset (EMU_Panel *panel)
+{
+  // registers
+  panel->madctl = 0x00;
+  panel->colmod = 0x06;
+  panel->command = NOP;
+  panel->count = 0;
+  panel->scroll = 0;
+  // whole memory
+  panel->xs = panel->x = 0;
+  panel->ys = panel->y = 0;
+  panel->xe = EMU_COLS - 1;
+  panel->ye = EMU_ROWS - 1;
+  // content and counters
+  EMU_Clear (panel, BLACK);
+}
+
+/**
+ * @desc    Fill GRAM by color, reset traffic counters
+ *
+ * @param   EMU_Panel * panel
+ * @param   uint16_t color
+ *
+ * @return  void
+ */
+void EMU_Clear (EMU_Panel *panel, uint16_t color)
+{
+  // variables
+  uint16_t col;
+  uint16_t row;
+
+  // whole memory
+  for (row = 0; row < EMU_ROWS; row++) {
+    for (col = 0; col < EMU_COLS; col++) {
+      panel->gram[row][col] = color;
+    }
+  }
+  // counters
+  panel->stats = (EMU_Stats) { 0 };
+}
+
+/**
+ * @desc    Pixel of landscape view (ROTATE_0) as shown, scroll applied
+ *
+ * @param   const EMU_Panel * panel
+ * @param   uint16_t x
+ * @param   uint16_t y
+ *
+ * @return  uint16_t
+ */
+uint16_t EMU_Pixel (const EMU_Panel *panel, uint16_t x, uint16_t y)
+{
+  // variables
+  uint16_t row = EMU_ROWS - 1 - x;
+
+  // outside of memory is black
+  if ((x >= EMU_ROWS) || (y >= EMU_COLS)) {
+    return BLACK;
+  }
+  // row of scroll area shows other memory row
+  if (panel->scroll && (row >= panel->tfa) && (row < panel->tfa + panel->vsa)) {
+    row = panel->tfa + (row - panel->tfa + panel->ssa + panel->vsa - panel->tfa) % panel->vsa;
+  }
+  // shown row, MY and MV of view
+  return panel->gram[row][y];
+}
+
+/**
+ * @desc    Landscape view (ROTATE_0) as PPM file
+ *
+ * @param   const EMU_Panel * panel
+ * @param   const char * path
+ *
+ * @return  uint8_t
+ */
+uint8_t EMU_Save (const EMU_Panel *panel, const char *path)
+{
+  // variables
+  uint8_t pixels[EMU_WIDTH * EMU_HEIGHT * 2];
+  uint8_t *pixel = pixels;
+  uint16_t color;
+  uint16_t x;
+  uint16_t y;
+
+  // RGB565 MSB first
+  for (y = 0; y < EMU_HEIGHT; y++) {
+    for (x = 0; x < EMU_WIDTH; x++) {
+      color = EMU_Pixel (panel, x, y);
+      *pixel++ = (uint8_t) (color >> 8);
+      *pixel++ = (uint8_t) color;
+    }
+  }
+  // image
+  return PPM_Write (pixels, EMU_WIDTH, EMU_HEIGHT, path) == PPM_SUCCESS ? ST7735_SUCCESS : ST7735_ERROR;
+}
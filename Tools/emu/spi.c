@@ -0,0 +1,318 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Fake SPI - host emulator
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        spi.c
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      spi.h, emu.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Replaces Library/spi.c on host. Every byte goes to display model, DMA transfer
+ *              finishes at once and its complete interrupt is delivered when enabled.
+ *              SPIBUS_NO_DMA - DMA functions are not built, any use of them fails to link.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include "emu.h"
+
+#ifdef SPI_TRACE
+  #include "trace.h"
+#endif
+
+/**
+ * @desc    Init pins - nothing on host
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_Pins_Init (SPI_TypeDef *SPIx)
+{
+  // unused
+  (void) SPIx;
+}
+
+/**
+ * @desc    Init master, f PCLK / 8, mode 0
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_Master_Init (SPI_TypeDef *SPIx)
+{
+  // master enabled
+  SPIx->CR1 = SPI_CR1_MSTR | SPI_CR1_BR_1 | SPI_CR1_SPE;
+  SPIx->CR2 = 0;
+}
+
+/**
+ * @desc    Slave deselect
+ *
+ * @param   GPIO_TypeDef *
+ * @param   uint16_t
+ *
+ * @return  uint8_t
+ */
+uint8_t SPI_SS_High (GPIO_TypeDef *GPIOx, uint16_t pin)
+{
+  // set pin
+  SET_BIT (GPIOx->BSRR, pin);
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Slave select
+ *
+ * @param   GPIO_TypeDef *
+ * @param   uint16_t
+ *
+ * @return  uint8_t
+ */
+uint8_t SPI_SS_Low (GPIO_TypeDef *GPIOx, uint16_t pin)
+{
+  // reset pin
+  SET_BIT (GPIOx->BRR, pin);
+  // success
+  return SUCCESS;
+}
+
+/**
+ * @desc    Transmit / receive 8 bits
+ *
+ * @param   SPI_TypeDef *SPIx
+ * @param   uint8_t
+ *
+ * @return  uint8_t
+ */
+uint8_t SPI_TRX_8b (SPI_TypeDef *SPIx, uint8_t data)
+{
+#ifdef SPI_TRACE
+  // capture
+  TRACE_Bytes (SPIx, &data, 1);
+#endif
+  // to display model, byte of panel back
+  return EMU_Byte (SPIx, data);
+}
+
+/**
+ * @desc    Transmit / receive 16 bits, MSB first
+ *
+ * @param   SPI_TypeDef *SPIx
+ * @param   uint16_t
+ *
+ * @return  uint16_t
+ */
+uint16_t SPI_TRX_16b (SPI_TypeDef *SPIx, uint16_t data)
+{
+  // variables
+  uint16_t rxbuff;
+
+#ifdef SPI_TRACE
+  // capture MSB first
+  uint8_t bytes[2] = { (uint8_t) (data >> 8), (uint8_t) data };
+  TRACE_Bytes (SPIx, bytes, 2);
+#endif
+  // to display model, first byte received into low byte as on target
+  rxbuff = EMU_Byte (SPIx, (uint8_t) (data >> 8));
+  rxbuff |= EMU_Byte (SPIx, (uint8_t) data) << 8;
+  // return data
+  return rxbuff;
+}
+
+/**
+ * @desc    Polled transmit of block
+ *
+ * @param   SPI_TypeDef *SPIx
+ * @param   const void * buffer
+ * @param   uint16_t count of items
+ * @param   uint32_t flags
+ *
+ * @return  void
+ */
+void SPI_Transmit (SPI_TypeDef *SPIx, const void *buffer, uint16_t count, uint32_t flags)
+{
+  // variables
+  const uint8_t *byte = (const uint8_t *) buffer;
+  const uint16_t *half = (const uint16_t *) buffer;
+  uint16_t i;
+
+#ifdef SPI_TRACE
+  // capture
+  TRACE_Block (SPIx, buffer, count, (SPIx->CR1 & SPI_CR1_DFF) ? 2 : 1, (flags & SPI_DMA_MINC) != 0);
+#endif
+  // loop through items
+  for (i = 0; i < count; i++) {
+    // 16 bit frame - half word, MSB first on wire
+    if (SPIx->CR1 & SPI_CR1_DFF) {
+      EMU_Byte (SPIx, (uint8_t) (half[(flags & SPI_DMA_MINC) ? i : 0] >> 8));
+      EMU_Byte (SPIx, (uint8_t) half[(flags & SPI_DMA_MINC) ? i : 0]);
+    // 8 bit frame
+    } else {
+      EMU_Byte (SPIx, byte[(flags & SPI_DMA_MINC) ? i : 0]);
+    }
+  }
+}
+
+#ifndef SPIBUS_NO_DMA
+
+/**
+ * @desc    Init DMA channel - nothing on host
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_DMA_Init (SPI_TypeDef *SPIx)
+{
+  // unused
+  (void) SPIx;
+}
+
+/**
+ * @desc    DMA transmit, finished before return
+ *
+ * @param   SPI_TypeDef *SPIx
+ * @param   const void * buffer
+ * @param   uint16_t count of items
+ * @param   uint32_t flags
+ *
+ * @return  void
+ */
+void SPI_DMA_Transmit (SPI_TypeDef *SPIx, const void *buffer, uint16_t count, uint32_t flags)
+{
+  // nothing to send
+  if (count == 0) {
+    return;
+  }
+  // same bytes as polled transmit
+  SPI_Transmit (SPIx, buffer, count, flags);
+  // transfer complete
+  if (flags & SPI_DMA_IRQ) {
+    EMU_Pending (SPIx);
+  }
+}
+
+/**
+ * @desc    DMA busy - never on host
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  uint8_t
+ */
+uint8_t SPI_DMA_Busy (SPI_TypeDef *SPIx)
+{
+  // finished at start
+  (void) SPIx;
+  return 0;
+}
+
+/**
+ * @desc    Wait for DMA - nothing on host
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_DMA_Wait (SPI_TypeDef *SPIx)
+{
+  // unused
+  (void) SPIx;
+}
+
+/**
+ * @desc    Finish DMA - nothing on host
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_DMA_Finish (SPI_TypeDef *SPIx)
+{
+  // unused
+  (void) SPIx;
+}
+
+/**
+ * @desc    Enable DMA interrupt - nothing on host
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_DMA_IRQ_Enable (SPI_TypeDef *SPIx)
+{
+  // unused
+  (void) SPIx;
+}
+
+#endif
+
+/**
+ * @desc    Change baud rate, frame format and clock mode
+ *
+ * @param   SPI_TypeDef *SPIx
+ * @param   uint16_t config
+ *
+ * @return  void
+ */
+void SPI_Configure (SPI_TypeDef *SPIx, uint16_t config)
+{
+  // replace configuration bits
+  SPIx->CR1 = (SPIx->CR1 & ~(SPI_CR1_BR | SPI_CR1_DFF | SPI_CR1_CPOL | SPI_CR1_CPHA)) | config;
+}
+
+/**
+ * @desc    Enable / disable TXE interrupt, enabled one runs till it disables itself
+ *
+ * @param   SPI_TypeDef *SPIx
+ * @param   uint8_t enable
+ *
+ * @return  void
+ */
+void SPI_TXE_Interrupt (SPI_TypeDef *SPIx, uint8_t enable)
+{
+  // disable
+  if (!enable) {
+    CLEAR_BIT (SPIx->CR2, SPI_CR2_TXEIE);
+    return;
+  }
+  // enable, transmit buffer is empty
+  SPIx->CR2 |= SPI_CR2_TXEIE;
+  EMU_TXE (SPIx);
+}
+
+/**
+ * @desc    Wait till shift register empty - nothing on host
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_Wait_Idle (SPI_TypeDef *SPIx)
+{
+  // unused
+  (void) SPIx;
+}
+
+/**
+ * @desc    Disable SPI
+ *
+ * @param   SPI_TypeDef *SPIx
+ *
+ * @return  void
+ */
+void SPI_Disable (SPI_TypeDef *SPIx)
+{
+  // peripheral off
+  CLEAR_BIT (SPIx->CR1, SPI_CR1_SPE);
+}
@@ -0,0 +1,133 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        Fake device header - host emulator
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        stm32f10x.h
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      emu.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Replaces CMSIS header of STM32F10x when Library is compiled on host. Peripherals
+ *              are plain structures in RAM, SET_BIT is routed through emulator, so writes of
+ *              BSRR / BRR move pin levels seen by display model.
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+#ifndef __STM32F10x_H
+#define __STM32F10x_H
+
+  #include <stdint.h>
+  #include <stddef.h>
+
+  #define __IO                  volatile
+
+  /** @enum Status */
+  typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+  typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+  typedef enum { ERROR = 0, SUCCESS = !ERROR } ErrorStatus;
+
+  /** @struct GPIO */
+  typedef struct {
+    __IO uint32_t CRL;
+    __IO uint32_t CRH;
+    __IO uint32_t IDR;
+    __IO uint32_t ODR;
+    __IO uint32_t BSRR;
+    __IO uint32_t BRR;
+    __IO uint32_t LCKR;
+  } GPIO_TypeDef;
+
+  /** @struct SPI - 32 bit registers, DR keeps mark of untouched register */
+  typedef struct {
+    __IO uint32_t CR1;
+    __IO uint32_t CR2;
+    __IO uint32_t SR;
+    __IO uint32_t DR;
+  } SPI_TypeDef;
+
+  /** @struct RCC */
+  typedef struct {
+    __IO uint32_t CR;
+    __IO uint32_t CFGR;
+    __IO uint32_t APB2ENR;
+    __IO uint32_t APB1ENR;
+    __IO uint32_t AHBENR;
+  } RCC_TypeDef;
+
+  /** @var Peripherals */
+  extern GPIO_TypeDef emuGPIOA, emuGPIOB, emuGPIOC;
+  extern SPI_TypeDef emuSPI1, emuSPI2;
+  extern RCC_TypeDef emuRCC;
+  extern uint32_t SystemCoreClock;
+
+  #define GPIOA                 (&emuGPIOA)
+  #define GPIOB                 (&emuGPIOB)
+  #define GPIOC                 (&emuGPIOC)
+  #define SPI1                  (&emuSPI1)
+  #define SPI2                  (&emuSPI2)
+  #define RCC                   (&emuRCC)
+
+  // Register access - pin levels through emulator
+  // -----------------------------------
+  void EMU_Set_Bit (__IO uint32_t *, uint32_t);
+  #define SET_BIT(REG, BIT)     EMU_Set_Bit (&(REG), (BIT))
+  #define CLEAR_BIT(REG, BIT)   ((REG) &= ~(BIT))
+  #define READ_BIT(REG, BIT)    ((REG) & (BIT))
+
+  // Cycle counter - replaces DWT CYCCNT (SCAN_CYCLES)
+  // -----------------------------------
+  uint32_t EMU_Cycles (void);
+
+  // Interrupts - pending ones delivered when enabled
+  // -----------------------------------
+  void __disable_irq (void);
+  void __enable_irq (void);
+  uint32_t __get_PRIMASK (void);
+  void __set_PRIMASK (uint32_t);
+
+  // Bits used by Library
+  // -----------------------------------
+  #define GPIO_BSRR_BS0         ((uint32_t) 0x0001)
+  #define GPIO_BSRR_BS1         ((uint32_t) 0x0002)
+  #define GPIO_BSRR_BS2         ((uint32_t) 0x0004)
+  #define GPIO_BSRR_BS3         ((uint32_t) 0x0008)
+  #define GPIO_BSRR_BS4         ((uint32_t) 0x0010)
+  #define GPIO_BSRR_BS5         ((uint32_t) 0x0020)
+  #define GPIO_BSRR_BS6         ((uint32_t) 0x0040)
+  #define GPIO_BSRR_BS7         ((uint32_t) 0x0080)
+  #define GPIO_BSRR_BS8         ((uint32_t) 0x0100)
+  #define GPIO_BSRR_BS9         ((uint32_t) 0x0200)
+  #define GPIO_BSRR_BS10        ((uint32_t) 0x0400)
+  #define GPIO_BSRR_BS11        ((uint32_t) 0x0800)
+  #define GPIO_BSRR_BS12        ((uint32_t) 0x1000)
+  #define GPIO_BSRR_BS13        ((uint32_t) 0x2000)
+  #define GPIO_BSRR_BS14        ((uint32_t) 0x4000)
+  #define GPIO_BSRR_BS15        ((uint32_t) 0x8000)
+  #define GPIO_BRR_BR4          ((uint16_t) 0x0010)
+  #define GPIO_BRR_BR12         ((uint16_t) 0x1000)
+
+  #define RCC_APB2ENR_IOPAEN    ((uint32_t) 0x0004)
+  #define RCC_APB2ENR_IOPBEN    ((uint32_t) 0x0008)
+
+  #define SPI_CR1_CPHA          ((uint16_t) 0x0001)
+  #define SPI_CR1_CPOL          ((uint16_t) 0x0002)
+  #define SPI_CR1_MSTR          ((uint16_t) 0x0004)
+  #define SPI_CR1_BR            ((uint16_t) 0x0038)
+  #define SPI_CR1_BR_0          ((uint16_t) 0x0008)
+  #define SPI_CR1_BR_1          ((uint16_t) 0x0010)
+  #define SPI_CR1_BR_2          ((uint16_t) 0x0020)
+  #define SPI_CR1_SPE           ((uint16_t) 0x0040)
+  #define SPI_CR1_DFF           ((uint16_t) 0x0800)
+  #define SPI_CR2_TXEIE         ((uint16_t) 0x0080)
+
+  #define DMA_CCR1_TCIE         ((uint16_t) 0x0002)
+  #define DMA_CCR1_MINC         ((uint16_t) 0x0080)
+
+#endif
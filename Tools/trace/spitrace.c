@@ -0,0 +1,459 @@
+/**
+ * --------------------------------------------------------------------------------------------+
+ * @name        SPI trace decoder - host tool
+ * --------------------------------------------------------------------------------------------+
+ *              Copyright (C) 2020 Marian Hrinko.
+ *              Written by Marian Hrinko (mato.hrinko@gmail.com)
+ *
+ * @author      Marian Hrinko
+ * @datum       18.10.2026
+ * @file        spitrace.c
+ * @version     1.0
+ * @tested      linux gcc
+ *
+ * @depend      trace.h, emu.h
+ * --------------------------------------------------------------------------------------------+
+ * @descr       Decodes dump of trace ring (Library/trace.h) into display operations - CASET,
+ *              RASET, RAMWR and others - with header bytes (command and parameters), payload
+ *              bytes (pixels) and time of every operation. Bytes are replayed into model of
+ *              ST7735 (Tools/emu), resulting frame is written as PPM image. Two traces are
+ *              compared operation totals and pixel by pixel (A/B).
+ *
+ *              Panel starts as after ST7735_Init - COLMOD 0x05, MADCTL of ROTATE_0, black.
+ *
+ *              spitrace [-v] [-o frame.ppm [-r ref.ppm]] a.trace [b.trace]
+ *
+ *              gdb:    dump binary value a.trace traceBuffer
+ *              emu:    ./emu -o out -t   ... out/<scene>.trace
+ * --------------------------------------------------------------------------------------------+
+ * @inspir
+ */
+
+/** @includes */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "emu.h"
+#include "trace.h"
+
+// Byte of ring at free running position
+// -----------------------------------
+#define RING(p)               ring[(p) & (size - 1)]
+
+/** @struct Totals of one command */
+typedef struct {
+  // operations
+  uint32_t count;
+  // command and parameter bytes
+  uint32_t header;
+  // pixel bytes
+  uint32_t payload;
+  // cycles from command to next command
+  uint32_t cycles;
+} TRACE_Totals;
+
+/** @struct Decoded trace */
+typedef struct {
+  // file
+  const char *path;
+  // model of panel
+  EMU_Panel panel;
+  // totals by command
+  TRACE_Totals totals[256];
+  // current command, 0x100 before first one
+  uint16_t command;
+  // cycles at current command
+  uint32_t start;
+  // bytes of current operation
+  uint32_t bytes;
+  // CS selections
+  uint32_t selections;
+  // cycles of whole trace
+  uint32_t cycles;
+  // bytes dropped from ring
+  uint32_t lost;
+  // print operations
+  uint8_t verbose;
+} TRACE_Decoder;
+
+/**
+ * @desc    Name of command
+ *
+ * @param   uint8_t command
+ *
+ * @return  const char *
+ */
+static const char * TRACE_Name (uint8_t command)
+{
+  // variables
+  static char hex[8];
+
+  // known ones
+  switch (command) {
+    case NOP:     return "NOP";
+    case SWRESET: return "SWRESET";
+    case SLPOUT:  return "SLPOUT";
+    case NORON:   return "NORON";
+    case INVOFF:  return "INVOFF";
+    case DISPON:  return "DISPON";
+    case CASET:   return "CASET";
+    case RASET:   return "RASET";
+    case RAMWR:   return "RAMWR";
+    case RAMRD:   return "RAMRD";
+    case MADCTL:  return "MADCTL";
+    case COLMOD:  return "COLMOD";
+    default:      break;
+  }
+  // hex
+  snprintf (hex, sizeof (hex), "0x%02X", command);
+  return hex;
+}
+
+/**
+ * @desc    Close current operation at time
+ *
+ * @param   TRACE_Decoder * decoder
+ * @param   uint32_t cycles
+ *
+ * @return  void
+ */
+static void TRACE_Close (TRACE_Decoder *decoder, uint32_t cycles)
+{
+  // variables
+  TRACE_Totals *totals;
+
+  // no operation yet
+  if (decoder->command > 0xFF) {
+    return;
+  }
+  totals = &decoder->totals[decoder->command];
+  totals->cycles += cycles - decoder->start;
+  // operation
+  if (decoder->verbose) {
+    printf ("%10u  %-8s %6u B %8u cycles\n", decoder->start, TRACE_Name (decoder->command),
+            decoder->bytes, cycles - decoder->start);
+  }
+}
+
+/**
+ * @desc    Byte on bus
+ *
+ * @param   TRACE_Decoder * decoder
+ * @param   uint8_t byte
+ * @param   uint8_t data (DC high) / command (DC low)
+ * @param   uint32_t cycles
+ *
+ * @return  void
+ */
+static void TRACE_Byte (TRACE_Decoder *decoder, uint8_t byte, uint8_t data, uint32_t cycles)
+{
+  // variables
+  TRACE_Totals *totals;
+
+  // new operation
+  if (!data) {
+    TRACE_Close (decoder, cycles);
+    decoder->command = byte;
+    decoder->start = cycles;
+    decoder->bytes = 0;
+    decoder->totals[byte].count++;
+  }
+  // bytes of operation
+  decoder->bytes++;
+  if (decoder->command <= 0xFF) {
+    totals = &decoder->totals[decoder->command];
+    // pixels are payload, everything else is header
+    if (data && (decoder->command == RAMWR)) {
+      totals->payload++;
+    } else {
+      totals->header++;
+    }
+  }
+  // model of panel
+  EMU_Receive (&decoder->panel, byte, data);
+}
+
+/**
+ * @desc    Load dump and decode records
+ *
+ * @param   TRACE_Decoder * decoder
+ *
+ * @return  uint8_t
+ */
+static uint8_t TRACE_Decode (TRACE_Decoder *decoder)
+{
+  // variables
+  FILE *file = fopen (decoder->path, "rb");
+  uint32_t header[7];
+  uint8_t *ring;
+  uint32_t size, head, first, shift;
+  uint32_t position;
+  uint32_t cycles = 0;
+  uint32_t count;
+  uint8_t item[2];
+  uint8_t level;
+  uint8_t tag;
+  uint8_t n;
+  uint8_t i;
+
+  // header - magic, size, head, first, open, time, flags
+  if ((file == NULL) || (fread (header, sizeof (header), 1, file) != 1) || (header[0] != TRACE_MAGIC)) {
+    fprintf (stderr, "%s: not a trace dump\n", decoder->path);
+    return ST7735_ERROR;
+  }
+  size = header[1];
+  head = header[2];
+  first = header[3];
+  shift = (header[6] >> 8) & 0xFF;
+  level = 0xFF;
+  // ring
+  ring = malloc (size);
+  if ((ring == NULL) || (size & (size - 1)) || (fread (ring, size, 1, file) != 1)) {
+    fprintf (stderr, "%s: truncated dump\n", decoder->path);
+    return ST7735_ERROR;
+  }
+  fclose (file);
+
+  // panel as after ST7735_Init
+  EMU_Reset (&decoder->panel);
+  decoder->panel.colmod = 0x05;
+  decoder->panel.madctl = MADCTL_MY | MADCTL_MV;
+  decoder->command = 0x100;
+  // older records overwritten
+  decoder->lost = first;
+
+  // loop through records
+  for (position = first; position != head; ) {
+    tag = RING (position);
+    cycles += (RING (position + 1) | (RING (position + 2) << 8)) << shift;
+    position += 3;
+    switch (tag & TRACE_TAG_MASK) {
+      // bytes
+      case TRACE_TAG_COMMAND:
+      case TRACE_TAG_DATA:
+        n = (tag & 0x3F) + 1;
+        while (n--) {
+          TRACE_Byte (decoder, RING (position++), tag & TRACE_TAG_DATA, cycles);
+        }
+        break;
+      // DMA repeated item
+      case TRACE_TAG_REPEAT:
+        count = RING (position) | (RING (position + 1) << 8);
+        n = (tag & 0x01) + 1;
+        item[0] = RING (position + 2);
+        item[1] = RING (position + 3);
+        position += 2 + n;
+        while (count--) {
+          for (i = 0; i < n; i++) {
+            TRACE_Byte (decoder, item[i], 1, cycles);
+          }
+        }
+        break;
+      // CS level - interface of panel restarts on release
+      default:
+        if (tag & 0x01) {
+          decoder->panel.count = 0;
+        } else if (level == 1) {
+          decoder->selections++;
+        }
+        level = tag & 0x01;
+        break;
+    }
+  }
+  // last operation
+  TRACE_Close (decoder, cycles);
+  decoder->cycles = cycles;
+  free (ring);
+
+  // success
+  return ST7735_SUCCESS;
+}
+
+/**
+ * @desc    Print totals
+ *
+ * @param   const TRACE_Decoder * decoder
+ *
+ * @return  void
+ */
+static void TRACE_Report (const TRACE_Decoder *decoder)
+{
+  // variables
+  const TRACE_Totals *totals;
+  uint32_t header = 0;
+  uint32_t payload = 0;
+  uint16_t i;
+
+  // source
+  printf ("%s\n", decoder->path);
+  if (decoder->lost) {
+    printf ("  ring wrapped, first %u bytes of trace lost - frame incomplete\n", decoder->lost);
+  }
+  // by command
+  printf ("  %-8s %8s %10s %10s %8s %12s\n", "command", "count", "header B", "payload B", "B/op", "cycles");
+  for (i = 0; i < 256; i++) {
+    totals = &decoder->totals[i];
+    if (totals->count) {
+      printf ("  %-8s %8u %10u %10u %8.1f %12u\n", TRACE_Name (i), totals->count, totals->header,
+              totals->payload, (double) (totals->header + totals->payload) / totals->count, totals->cycles);
+      header += totals->header;
+      payload += totals->payload;
+    }
+  }
+  // whole trace
+  printf ("  bytes %u = header %u (%.1f %%) + payload %u, %u pixels, %u selections, %.0f us\n",
+          header + payload, header, (header + payload) ? 100.0 * header / (header + payload) : 0.0,
+          payload, decoder->panel.stats.pixels, decoder->selections, decoder->cycles / 72.0);
+}
+
+/**
+ * @desc    Compare frames of two traces
+ *
+ * @param   const TRACE_Decoder * a
+ * @param   const TRACE_Decoder * b
+ *
+ * @return  uint32_t different pixels
+ */
+static uint32_t TRACE_Compare (const TRACE_Decoder *a, const TRACE_Decoder *b)
+{
+  // variables
+  uint32_t diff = 0;
+  uint16_t x;
+  uint16_t y;
+
+  // landscape view
+  for (y = 0; y < EMU_HEIGHT; y++) {
+    for (x = 0; x < EMU_WIDTH; x++) {
+      diff += EMU_Pixel (&a->panel, x, y) != EMU_Pixel (&b->panel, x, y);
+    }
+  }
+  // result
+  return diff;
+}
+
+/**
+ * @desc    Compare two files
+ *
+ * @param   const char * path
+ * @param   const char * reference
+ *
+ * @return  int32_t different bytes, -1 if not comparable
+ */
+static int32_t TRACE_Compare_File (const char *path, const char *reference)
+{
+  // variables
+  FILE *a = fopen (path, "rb");
+  FILE *b = fopen (reference, "rb");
+  int32_t diff = 0;
+  int ca;
+  int cb;
+
+  // missing file
+  if ((a == NULL) || (b == NULL)) {
+    diff = -1;
+  } else {
+    // byte by byte
+    do {
+      ca = fgetc (a);
+      cb = fgetc (b);
+      if (ca != cb) {
+        // different length
+        if ((ca == EOF) || (cb == EOF)) {
+          diff = -1;
+          break;
+        }
+        diff++;
+      }
+    } while (ca != EOF);
+  }
+  // close
+  if (a != NULL) {
+    fclose (a);
+  }
+  if (b != NULL) {
+    fclose (b);
+  }
+  // result
+  return diff;
+}
+
+/** @var Decoded traces A / B */
+static TRACE_Decoder trace[2];
+
+/**
+ * @desc    Main
+ *
+ * @param   int argc
+ * @param   char ** argv
+ *
+ * @return  int
+ */
+int main (int argc, char **argv)
+{
+  // variables
+  const char *out = NULL;
+  const char *ref = NULL;
+  uint8_t verbose = 0;
+  int32_t diff;
+  int count;
+  int opt;
+  int i;
+
+  // options
+  while ((opt = getopt (argc, argv, "vo:r:")) != -1) {
+    if (opt == 'v') {
+      verbose = 1;
+    } else if (opt == 'o') {
+      out = optarg;
+    } else if (opt == 'r') {
+      ref = optarg;
+    } else {
+      break;
+    }
+  }
+  count = argc - optind;
+  if ((count < 1) || (count > 2) || (ref && !out)) {
+    fprintf (stderr, "usage: %s [-v] [-o frame.ppm [-r ref.ppm]] a.trace [b.trace]\n", argv[0]);
+    return 2;
+  }
+
+  // decode
+  for (i = 0; i < count; i++) {
+    trace[i].path = argv[optind + i];
+    trace[i].verbose = verbose;
+    if (TRACE_Decode (&trace[i]) != ST7735_SUCCESS) {
+      return 2;
+    }
+    TRACE_Report (&trace[i]);
+  }
+
+  // frame of first trace
+  if (out != NULL) {
+    if (EMU_Save (&trace[0].panel, out) != ST7735_SUCCESS) {
+      fprintf (stderr, "%s: cannot write\n", out);
+      return 2;
+    }
+    // golden image
+    if (ref != NULL) {
+      diff = TRACE_Compare_File (out, ref);
+      printf ("%s: %s\n", ref, diff == 0 ? "same frame" : "frame differs");
+      if (diff != 0) {
+        return 1;
+      }
+    }
+  }
+
+  // A/B
+  if (count == 2) {
+    diff = TRACE_Compare (&trace[0], &trace[1]);
+    printf ("A/B: bytes %+d, pixels different %d\n",
+            (int32_t) (trace[1].panel.stats.bytes - trace[0].panel.stats.bytes), diff);
+    if (diff != 0) {
+      return 1;
+    }
+  }
+
+  // success
+  return 0;
+}